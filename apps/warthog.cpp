@@ -7,16 +7,45 @@
 // @created: 2016-11-23
 //
 
+#include <warthog/anya/anya_search.h>
+#include <warthog/block_astar/block_astar.h>
 #include <warthog/constants.h>
+#include <warthog/cpd/cpd.h>
+#include <warthog/cpd/cpd_builder.h>
+#include <warthog/cpd/cpd_search.h>
+#include <warthog/dead_end/dead_end_expansion_policy.h>
+#include <warthog/dead_end/dead_end_map.h>
 #include <warthog/domain/gridmap.h>
 #include <warthog/domain/labelled_gridmap.h>
+#include <warthog/flow/flow_field_service.h>
+#include <warthog/goal_bounding/gb_builder.h>
+#include <warthog/goal_bounding/gb_expansion_policy.h>
+#include <warthog/goal_bounding/gb_table.h>
+#include <warthog/heuristic/differential_heuristic.h>
+#include <warthog/heuristic/differential_heuristic_builder.h>
+#include <warthog/heuristic/euclidean_heuristic.h>
+#include <warthog/heuristic/lazy_heuristic.h>
 #include <warthog/heuristic/manhattan_heuristic.h>
 #include <warthog/heuristic/octile_heuristic.h>
 #include <warthog/heuristic/zero_heuristic.h>
+#include <warthog/hpa/hpa_graph.h>
+#include <warthog/hpa/hpa_search.h>
+#include <warthog/rsr/rect_decomposition.h>
+#include <warthog/rsr/rsr_expansion_policy.h>
+#include <warthog/search/beam_search.h>
+#include <warthog/search/fringe_search.h>
+#include <warthog/search/frontier_search.h>
 #include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/hda_star.h>
+#include <warthog/search/ida_star.h>
 #include <warthog/search/search.h>
+#include <warthog/search/search_tree_cache.h>
+#include <warthog/search/theta_star.h>
 #include <warthog/search/unidirectional_search.h>
 #include <warthog/search/vl_gridmap_expansion_policy.h>
+#include <warthog/subgoal/subgoal_graph.h>
+#include <warthog/subgoal/subgoal_graph_builder.h>
+#include <warthog/subgoal/subgoal_search.h>
 #include <warthog/util/pqueue.h>
 #include <warthog/util/scenario_manager.h>
 #include <warthog/util/timer.h>
@@ -32,6 +61,7 @@
 #include <iomanip>
 #include <memory>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 
 // #include "time_constraints.h"
@@ -69,7 +99,22 @@ help(std::ostream& out)
 	    << "Invoking the program this way solves all instances in [scen "
 	       "file] with algorithm [alg]\n"
 	    << "Currently recognised values for [alg]:\n"
-	    << "\tastar, astar_wgm, astar4c, dijkstra\n";
+	    << "\tanya, astar, astar_de, astar_dh, astar_dh_lazy, astar_gb, "
+	       "astar_wgm, astar4c, beam, block_astar, cpd, dijkstra, flow_field, "
+	       "fringe, frontier, hda, hpa, idastar, lazy_theta_star, rsr, ssg, "
+	       "theta_star, tree_cache, tsg\n"
+	    << "cpd, astar_dh, astar_gb, rsr, ssg and tsg load [map file].cpd, "
+	       "[map file].dh, [map file].gb, [map file].rsr, [map file].ssg "
+	       "and [map file].tsg, building and saving them first if they do "
+	       "not exist\n"
+	    << "astar_dh_lazy uses the table of astar_dh, only for nodes at "
+	       "the top of OPEN\n"
+	    << "theta_star and lazy_theta_star return any-angle paths, which "
+	       "are shorter than the octile distances in scenario files; "
+	       "--checkopt is ignored for them\n"
+	    << "anya returns Euclidean shortest paths between cell corners; "
+	       "with --checkopt it expects Euclidean distances in [scen "
+	       "file]\n";
 }
 
 bool
@@ -171,6 +216,157 @@ run_astar(
 	return 0;
 }
 
+// A* which reopens closed nodes, for heuristics which are admissible
+// but not consistent
+template<class H>
+using reopening_astar = warthog::search::unidirectional_search<
+    H, warthog::search::gridmap_expansion_policy, warthog::util::pqueue_min,
+    warthog::search::dummy_listener,
+    warthog::search::admissibility_criteria::any,
+    warthog::search::feasibility_criteria::until_exhaustion,
+    warthog::search::reopen_policy::yes>;
+
+int
+run_astar_dh(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	const uint32_t num_pivots = 16;
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::search::gridmap_expansion_policy expander(&map);
+	warthog::heuristic::differential_heuristic heuristic(
+	    map.width(), map.height());
+	warthog::util::pqueue_min open;
+
+	std::string dhfile = mapname + ".dh";
+	if(!heuristic.load(dhfile.c_str(), map))
+	{
+		warthog::heuristic::differential_heuristic_builder builder(&map);
+		builder.build(num_pivots);
+		size_t bytes = builder.save(dhfile.c_str());
+		if(bytes == 0)
+		{
+			std::cerr << "err; cannot write " << dhfile << "\n";
+			return 1;
+		}
+		std::cerr << "differential heuristic built. pivots: "
+		          << builder.get_pivots().size() << " build time (s): "
+		          << builder.get_build_time().count() * 1e-9
+		          << " file size (bytes): " << bytes << "\n";
+		if(!heuristic.load(dhfile.c_str(), map))
+		{
+			std::cerr << "err; cannot load " << dhfile << "\n";
+			return 1;
+		}
+	}
+
+	// the bounds of the pivots are admissible but can break consistency,
+	// so a node closed early may be reached again more cheaply
+	int ret;
+	size_t mem;
+	if(alg_name == "astar_dh_lazy")
+	{
+		// keyed on octile distance until a node reaches the top of OPEN
+		warthog::heuristic::octile_heuristic octile(map.width(), map.height());
+		warthog::heuristic::lazy_heuristic lazy(&octile, &heuristic);
+		reopening_astar<decltype(lazy)> astar(&lazy, &expander, &open);
+		ret = run_experiments(
+		    astar, alg_name, scenmgr, verbose, checkopt, std::cout);
+		mem = astar.mem();
+	}
+	else
+	{
+		reopening_astar<decltype(heuristic)> astar(
+		    &heuristic, &expander, &open);
+		ret = run_experiments(
+		    astar, alg_name, scenmgr, verbose, checkopt, std::cout);
+		mem = astar.mem();
+	}
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << mem + scenmgr.mem() << "\n";
+	return 0;
+}
+
+int
+run_astar_de(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::heuristic::octile_heuristic heuristic(map.width(), map.height());
+	warthog::util::pqueue_min open;
+
+	warthog::util::timer t;
+	t.start();
+	warthog::dead_end::dead_end_map regions(&map);
+	std::cerr << "dead ends found. runs: " << regions.get_num_runs()
+	          << " cells in regions: " << regions.get_num_cells()
+	          << " build time (s): " << t.elapsed_time_sec() << "\n";
+
+	warthog::dead_end::dead_end_expansion_policy<> expander(&regions, &map);
+	warthog::search::unidirectional_search astar(&heuristic, &expander, &open);
+
+	int ret = run_experiments(
+	    astar, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << astar.mem() + scenmgr.mem() << "\n";
+	return 0;
+}
+
+int
+run_astar_gb(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::heuristic::octile_heuristic heuristic(map.width(), map.height());
+	warthog::util::pqueue_min open;
+
+	std::string gbfile = mapname + ".gb";
+	warthog::goal_bounding::gb_table table;
+	if(!table.load(gbfile.c_str(), map))
+	{
+		warthog::goal_bounding::gb_builder builder(&map);
+		builder.build();
+		size_t bytes = builder.save(gbfile.c_str());
+		if(bytes == 0)
+		{
+			std::cerr << "err; cannot write " << gbfile << "\n";
+			return 1;
+		}
+		std::cerr << "goal bounding table built. nodes: "
+		          << builder.get_num_nodes() << " build time (s): "
+		          << builder.get_build_time().count() * 1e-9
+		          << " file size (bytes): " << bytes << "\n";
+		if(!table.load(gbfile.c_str(), map))
+		{
+			std::cerr << "err; cannot load " << gbfile << "\n";
+			return 1;
+		}
+	}
+
+	warthog::goal_bounding::gb_expansion_policy expander(&map, &table);
+	warthog::search::unidirectional_search astar(&heuristic, &expander, &open);
+
+	int ret = run_experiments(
+	    astar, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << astar.mem() + scenmgr.mem() << "\n";
+	return 0;
+}
+
 int
 run_astar4c(
     warthog::util::scenario_manager& scenmgr, std::string mapname,
@@ -218,6 +414,450 @@ run_dijkstra(
 	return 0;
 }
 
+int
+run_theta_star(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::search::gridmap_expansion_policy expander(&map);
+	warthog::heuristic::euclidean_heuristic heuristic(
+	    map.width(), map.height());
+	warthog::util::pqueue_min open;
+
+	// any-angle paths are no longer than the octile distances in the
+	// scenario file, so the optimality check does not apply
+	int ret;
+	size_t mem;
+	if(alg_name == "lazy_theta_star")
+	{
+		warthog::search::lazy_theta_star theta(&heuristic, &expander, &open);
+		ret = run_experiments(
+		    theta, alg_name, scenmgr, verbose, false, std::cout);
+		mem = theta.mem();
+	}
+	else
+	{
+		warthog::search::theta_star theta(&heuristic, &expander, &open);
+		ret = run_experiments(
+		    theta, alg_name, scenmgr, verbose, false, std::cout);
+		mem = theta.mem();
+	}
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << mem + scenmgr.mem() << "\n";
+	return 0;
+}
+
+int
+run_anya(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::anya::anya_search anya(&map);
+
+	int ret = run_experiments(
+	    anya, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << anya.mem() + scenmgr.mem() << "\n";
+	return 0;
+}
+
+int
+run_block_astar(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::block_astar::block_astar bastar(&map);
+
+	int ret = run_experiments(
+	    bastar, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "lddb patterns computed: "
+	          << bastar.get_lddb().get_num_computed() << "\n";
+	std::cerr << "done. total memory: " << bastar.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_flow_field(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	using expander_t = warthog::search::gridmap_expansion_policy;
+	expander_t expander(&map);
+	expander.set_nodes_pool_size(0);
+	warthog::flow::flow_field_service<expander_t> service(&expander);
+
+	int ret = run_experiments(
+	    service, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "flow fields cached: " << service.get_num_hits()
+	          << " computed: " << service.get_num_misses() << "\n";
+	std::cerr << "done. total memory: " << service.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_tree_cache(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::search::search_tree_cache cache(&map);
+
+	int ret = run_experiments(
+	    cache, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "search trees reused: " << cache.get_num_hits()
+	          << " resumed: " << cache.get_num_resumes()
+	          << " built: " << cache.get_num_misses() << "\n";
+	std::cerr << "done. total memory: " << cache.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_rsr(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::heuristic::octile_heuristic heuristic(map.width(), map.height());
+	warthog::util::pqueue_min open;
+
+	std::string rsrfile = mapname + ".rsr";
+	warthog::rsr::rect_decomposition rects(&map);
+	if(!rects.load(rsrfile.c_str()))
+	{
+		warthog::util::timer t;
+		t.start();
+		rects.build();
+		double secs  = t.elapsed_time_sec();
+		size_t bytes = rects.save(rsrfile.c_str());
+		if(bytes == 0)
+		{
+			std::cerr << "err; cannot write " << rsrfile << "\n";
+			return 1;
+		}
+		std::cerr << "rectangle decomposition built. rectangles: "
+		          << rects.get_num_rects() << " build time (s): " << secs
+		          << " file size (bytes): " << bytes << "\n";
+	}
+
+	warthog::rsr::rsr_expansion_policy expander(&map, &rects);
+	warthog::search::unidirectional_search astar(&heuristic, &expander, &open);
+
+	int ret = run_experiments(
+	    astar, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << astar.mem() + scenmgr.mem() << "\n";
+	return 0;
+}
+
+int
+run_idastar(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::search::gridmap_expansion_policy expander(&map);
+	warthog::heuristic::octile_heuristic heuristic(map.width(), map.height());
+	// ida* keeps its own state; release the node pool
+	expander.set_nodes_pool_size(0);
+
+	warthog::search::ida_star idastar(&heuristic, &expander);
+
+	int ret = run_experiments(
+	    idastar, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << idastar.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_fringe(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::search::gridmap_expansion_policy expander(&map);
+	warthog::heuristic::octile_heuristic heuristic(map.width(), map.height());
+	// fringe search keeps its own state; release the node pool
+	expander.set_nodes_pool_size(0);
+
+	warthog::search::fringe_search fringe(&heuristic, &expander);
+
+	int ret = run_experiments(
+	    fringe, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << fringe.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_beam(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::search::gridmap_expansion_policy expander(&map);
+	warthog::heuristic::octile_heuristic heuristic(map.width(), map.height());
+	// beam search keeps its own state; release the node pool
+	expander.set_nodes_pool_size(0);
+
+	warthog::search::beam_search beam(&heuristic, &expander);
+
+	int ret = run_experiments(
+	    beam, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << beam.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_frontier(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::search::gridmap_expansion_policy expander(&map);
+	warthog::heuristic::octile_heuristic heuristic(map.width(), map.height());
+	// frontier search keeps its own state; release the node pool
+	expander.set_nodes_pool_size(0);
+
+	warthog::search::frontier_search frontier(&heuristic, &expander);
+
+	int ret = run_experiments(
+	    frontier, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << frontier.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_hda(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	uint32_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+
+	// every worker thread needs its own expander and heuristic
+	std::vector<std::unique_ptr<warthog::search::gridmap_expansion_policy>>
+	    expanders;
+	std::vector<std::unique_ptr<warthog::heuristic::octile_heuristic>>
+	    heuristics;
+	for(uint32_t i = 0; i < nthreads; i++)
+	{
+		expanders.emplace_back(
+		    new warthog::search::gridmap_expansion_policy(&map));
+		expanders.back()->set_nodes_pool_size(0);
+		heuristics.emplace_back(new warthog::heuristic::octile_heuristic(
+		    map.width(), map.height()));
+	}
+	std::vector<warthog::search::gridmap_expansion_policy*> eptr;
+	std::vector<warthog::heuristic::octile_heuristic*> hptr;
+	for(auto& e : expanders) { eptr.push_back(e.get()); }
+	for(auto& h : heuristics) { hptr.push_back(h.get()); }
+
+	warthog::search::hda_star hda(hptr, eptr);
+
+	int ret = run_experiments(
+	    hda, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << hda.mem() + scenmgr.mem() << "\n";
+	return 0;
+}
+
+int
+run_cpd(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	std::string cpdfile = mapname + ".cpd";
+
+	warthog::cpd::cpd db;
+	if(!db.load(cpdfile.c_str(), map))
+	{
+		warthog::cpd::cpd_builder builder(&map);
+		builder.build();
+		size_t bytes = builder.save(cpdfile.c_str());
+		if(bytes == 0)
+		{
+			std::cerr << "err; cannot write " << cpdfile << "\n";
+			return 1;
+		}
+		std::cerr << "cpd built. nodes: " << builder.get_num_nodes()
+		          << " runs: " << builder.get_num_runs() << " build time (s): "
+		          << builder.get_build_time().count() * 1e-9
+		          << " file size (bytes): " << bytes << "\n";
+		if(!db.load(cpdfile.c_str(), map))
+		{
+			std::cerr << "err; cannot load " << cpdfile << "\n";
+			return 1;
+		}
+	}
+	std::cerr << "cpd loaded. file size (bytes): " << db.file_size() << "\n";
+
+	warthog::cpd::cpd_search search(&map, &db);
+
+	// the nanos column is the extraction time of each query
+	int ret = run_experiments(
+	    search, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+
+	warthog::search::search_parameters par;
+	warthog::search::solution sol;
+	std::chrono::nanoseconds total{0};
+	for(uint32_t i = 0; i < scenmgr.num_experiments(); i++)
+	{
+		warthog::util::experiment* exp = scenmgr.get_experiment(i);
+		warthog::search::problem_instance pi(
+		    search.get_expander()->get_pack(exp->startx(), exp->starty()),
+		    search.get_expander()->get_pack(exp->goalx(), exp->goaly()));
+		sol.reset();
+		search.get_path(&pi, &par, &sol);
+		total += sol.met_.time_elapsed_nano_;
+	}
+	std::cerr << "mean extraction latency (ns): "
+	          << total.count() / scenmgr.num_experiments() << "\n";
+	std::cerr << "done. total memory: " << search.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
+int
+run_hpa(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	warthog::util::timer mytimer;
+	mytimer.start();
+	warthog::hpa::hpa_graph graph(&map);
+	std::cerr << "hpa graph built. clusters: " << graph.get_num_clusters()
+	          << " abstract nodes: " << graph.get_num_nodes()
+	          << " build time (s): " << mytimer.elapsed_time_sec() << "\n";
+
+	warthog::hpa::hpa_search hpa(&graph);
+
+	int ret = run_experiments(
+	    hpa, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << hpa.mem() + scenmgr.mem() << "\n";
+	return 0;
+}
+
+int
+run_subgoal(
+    warthog::util::scenario_manager& scenmgr, std::string mapname,
+    std::string alg_name)
+{
+	warthog::domain::gridmap map(mapname.c_str());
+	bool two_level        = alg_name == "tsg";
+	std::string graphfile = mapname + "." + alg_name;
+
+	warthog::subgoal::subgoal_graph graph;
+	if(!graph.load(graphfile.c_str(), map))
+	{
+		warthog::subgoal::subgoal_graph_builder builder(&map);
+		builder.build(two_level);
+		size_t bytes = builder.save(graphfile.c_str());
+		if(bytes == 0)
+		{
+			std::cerr << "err; cannot write " << graphfile << "\n";
+			return 1;
+		}
+		std::cerr << alg_name << " built. subgoals: "
+		          << builder.get_num_nodes()
+		          << " global: " << builder.get_num_global()
+		          << " edges: " << builder.get_num_edges()
+		          << " build time (s): "
+		          << builder.get_build_time().count() * 1e-9
+		          << " file size (bytes): " << bytes << "\n";
+		if(!graph.load(graphfile.c_str(), map))
+		{
+			std::cerr << "err; cannot load " << graphfile << "\n";
+			return 1;
+		}
+	}
+
+	warthog::subgoal::subgoal_search search(&map, &graph);
+
+	int ret = run_experiments(
+	    search, alg_name, scenmgr, verbose, checkopt, std::cout);
+	if(ret != 0)
+	{
+		std::cerr << "run_experiments error code " << ret << std::endl;
+		return ret;
+	}
+	std::cerr << "done. total memory: " << search.mem() + scenmgr.mem()
+	          << "\n";
+	return 0;
+}
+
 int
 run_wgm_astar(
     warthog::util::scenario_manager& scenmgr, std::string mapname,
@@ -324,8 +964,43 @@ main(int argc, char** argv)
 	std::cerr << "mapfile=" << mapfile << std::endl;
 
 	if(alg == "dijkstra") { return run_dijkstra(scenmgr, mapfile, alg); }
+	else if(alg == "anya") { return run_anya(scenmgr, mapfile, alg); }
 	else if(alg == "astar") { return run_astar(scenmgr, mapfile, alg); }
 	else if(alg == "astar4c") { return run_astar4c(scenmgr, mapfile, alg); }
+	else if(alg == "astar_de") { return run_astar_de(scenmgr, mapfile, alg); }
+	else if(alg == "astar_dh" || alg == "astar_dh_lazy")
+	{
+		return run_astar_dh(scenmgr, mapfile, alg);
+	}
+	else if(alg == "astar_gb") { return run_astar_gb(scenmgr, mapfile, alg); }
+	else if(alg == "idastar") { return run_idastar(scenmgr, mapfile, alg); }
+	else if(alg == "fringe") { return run_fringe(scenmgr, mapfile, alg); }
+	else if(alg == "frontier") { return run_frontier(scenmgr, mapfile, alg); }
+	else if(alg == "block_astar")
+	{
+		return run_block_astar(scenmgr, mapfile, alg);
+	}
+	else if(alg == "flow_field")
+	{
+		return run_flow_field(scenmgr, mapfile, alg);
+	}
+	else if(alg == "beam") { return run_beam(scenmgr, mapfile, alg); }
+	else if(alg == "hda") { return run_hda(scenmgr, mapfile, alg); }
+	else if(alg == "hpa") { return run_hpa(scenmgr, mapfile, alg); }
+	else if(alg == "cpd") { return run_cpd(scenmgr, mapfile, alg); }
+	else if(alg == "rsr") { return run_rsr(scenmgr, mapfile, alg); }
+	else if(alg == "theta_star" || alg == "lazy_theta_star")
+	{
+		return run_theta_star(scenmgr, mapfile, alg);
+	}
+	else if(alg == "tree_cache")
+	{
+		return run_tree_cache(scenmgr, mapfile, alg);
+	}
+	else if(alg == "ssg" || alg == "tsg")
+	{
+		return run_subgoal(scenmgr, mapfile, alg);
+	}
 	else if(alg == "astar_wgm")
 	{
 		return run_wgm_astar(scenmgr, mapfile, alg, costfile);
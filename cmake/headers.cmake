@@ -14,18 +14,46 @@ include/warthog/defines.h
 include/warthog/forward.h
 include/warthog/limits.h
 
+include/warthog/anya/anya_search.h
+
+include/warthog/block_astar/block_astar.h
+include/warthog/block_astar/lddb.h
+
+include/warthog/cpd/cpd.h
+include/warthog/cpd/cpd_builder.h
+include/warthog/cpd/cpd_search.h
+
+include/warthog/dead_end/dead_end_expansion_policy.h
+include/warthog/dead_end/dead_end_map.h
+
 include/warthog/domain/grid.h
+include/warthog/domain/grid_components.h
 include/warthog/domain/gridmap.h
 include/warthog/domain/labelled_gridmap.h
 
+include/warthog/flow/distance_field.h
+include/warthog/flow/flow_field_service.h
+
 include/warthog/geometry/geography.h
 include/warthog/geometry/geom.h
 
+include/warthog/goal_bounding/gb_builder.h
+include/warthog/goal_bounding/gb_expansion_policy.h
+include/warthog/goal_bounding/gb_table.h
+
+include/warthog/heuristic/differential_heuristic.h
+include/warthog/heuristic/differential_heuristic_builder.h
+include/warthog/heuristic/euclidean_heuristic.h
 include/warthog/heuristic/heuristic_value.h
+include/warthog/heuristic/lazy_heuristic.h
 include/warthog/heuristic/manhattan_heuristic.h
 include/warthog/heuristic/octile_heuristic.h
 include/warthog/heuristic/zero_heuristic.h
 
+include/warthog/hpa/hpa_expansion_policy.h
+include/warthog/hpa/hpa_graph.h
+include/warthog/hpa/hpa_search.h
+
 include/warthog/io/grid.h
 
 include/warthog/memory/arraylist.h
@@ -33,21 +61,43 @@ include/warthog/memory/bittable.h
 include/warthog/memory/cpool.h
 include/warthog/memory/node_pool.h
 
+include/warthog/rsr/rect_decomposition.h
+include/warthog/rsr/rsr_expansion_policy.h
+
+include/warthog/search/beam_search.h
+include/warthog/search/distance_table.h
 include/warthog/search/dummy_filter.h
 include/warthog/search/dummy_listener.h
 include/warthog/search/expansion_policy.h
+include/warthog/search/fringe_search.h
+include/warthog/search/frontier_search.h
 include/warthog/search/gridmap_expansion_policy.h
+include/warthog/search/hda_star.h
+include/warthog/search/ida_star.h
+include/warthog/search/isochrone_search.h
+include/warthog/search/multi_target_search.h
 include/warthog/search/noop_search.h
+include/warthog/search/prioritized_planner.h
 include/warthog/search/problem_instance.h
+include/warthog/search/reservation_table.h
 include/warthog/search/search.h
 include/warthog/search/search_metrics.h
 include/warthog/search/search_node.h
 include/warthog/search/search_parameters.h
+include/warthog/search/search_tree_cache.h
 include/warthog/search/solution.h
+include/warthog/search/spacetime_expansion_policy.h
+include/warthog/search/subpath_cache.h
+include/warthog/search/theta_star.h
 include/warthog/search/uds_traits.h
 include/warthog/search/unidirectional_search.h
 include/warthog/search/vl_gridmap_expansion_policy.h
 
+include/warthog/subgoal/subgoal_expansion_policy.h
+include/warthog/subgoal/subgoal_graph.h
+include/warthog/subgoal/subgoal_graph_builder.h
+include/warthog/subgoal/subgoal_search.h
+
 include/warthog/util/cast.h
 include/warthog/util/cost_table.h
 include/warthog/util/dimacs_parser.h
@@ -58,8 +108,10 @@ include/warthog/util/helpers.h
 include/warthog/util/intrin.h
 include/warthog/util/log.h
 include/warthog/util/macros.h
+include/warthog/util/mmap_file.h
 include/warthog/util/pqueue.h
 include/warthog/util/scenario_manager.h
+include/warthog/util/spsc_queue.h
 include/warthog/util/template.h
 include/warthog/util/timer.h
 include/warthog/util/vec_io.h
@@ -0,0 +1,233 @@
+#ifndef WARTHOG_ANYA_ANYA_SEARCH_H
+#define WARTHOG_ANYA_ANYA_SEARCH_H
+
+// anya/anya_search.h
+//
+// Optimal any-angle pathfinding on gridmaps with Anya (Harabor, Grastien,
+// Öz and Aksakalli, 2016).
+//
+// Paths run between grid points, which are the corners of cells: point
+// (x, y) is the top-left corner of cell (x, y), and the start and target
+// of a query are the points with the coordinates of their cells. A path
+// may go anywhere in the closed traversable cells, i.e. along the edges
+// and around the corners of obstacles but never through their interior.
+// As in gridmap_expansion_policy, it may not squeeze between two blocked
+// cells which touch at a corner. The result is the Euclidean shortest such
+// path, as a list of turning points.
+//
+// Anya searches over intervals of points on a row of the grid, each
+// paired with a root: a point which sees the whole interval and is the
+// last turning point of the paths through it. A node is expanded by
+// projecting its interval onto the next row (with the same root) and by
+// turning around obstacle corners at its ends (with the corner as the new
+// root). Interval ends are found from runs of free and blocked cells,
+// which are read 64 cells at a time from the bitmap of the gridmap.
+// Roots which are reached again at a greater cost are pruned.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/search/search_parameters.h>
+#include <warthog/search/solution.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace warthog::anya
+{
+
+class anya_search
+{
+public:
+	anya_search(domain::gridmap* map);
+
+	anya_search(const anya_search&) = delete;
+	anya_search&
+	operator=(const anya_search&)
+	    = delete;
+
+	// the path is written as pack_ids of its turning points
+	void
+	get_path(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	void
+	get_pathcost(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	// converts between scenario coordinates and pack_ids
+	search::gridmap_expansion_policy*
+	get_expander()
+	{
+		return &expander_;
+	}
+
+	size_t
+	mem();
+
+private:
+	struct node
+	{
+		double left_;  // interval [left_, right_] on row_
+		double right_; //
+		int32_t row_;
+		int32_t root_x_;
+		int32_t root_y_;
+		uint32_t parent_; // index in ::nodes_, or NO_PARENT
+		double g_;        // cost of the root
+		double f_;
+		// an open end is the limit of the interval but cannot be reached,
+		// e.g. the ray to it squeezes between obstacles
+		bool left_open_  = false;
+		bool right_open_ = false;
+	};
+
+	// a node is generated again for the same interval and root only if the
+	// root is cheaper; equal roots are often reached at equal cost, e.g.
+	// through collinear corners
+	struct node_key
+	{
+		double left_;
+		double right_;
+		int32_t row_;
+		uint32_t root_;
+		bool left_open_;
+		bool right_open_;
+
+		bool
+		operator==(const node_key&) const
+		    = default;
+	};
+
+	struct node_key_hash
+	{
+		size_t
+		operator()(const node_key& k) const noexcept;
+	};
+
+	struct open_entry
+	{
+		double f_;
+		double g_;
+		uint32_t node_;
+	};
+
+	domain::gridmap* map_;
+	search::gridmap_expansion_policy expander_;
+	int32_t width_;  // of the unpadded map, in cells
+	int32_t height_; //
+	uint32_t words_per_row_;
+
+	// per query
+	int32_t target_x_;
+	int32_t target_y_;
+	std::vector<node> nodes_;
+	std::vector<open_entry> open_;
+	std::unordered_map<node_key, double, node_key_hash> generated_;
+	search::search_metrics* met_;
+
+	// best cost of each point seen as a root, valid if the stamp matches
+	std::vector<double> root_g_;
+	std::vector<uint32_t> root_stamp_;
+	uint32_t stamp_;
+
+	void
+	search_(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol, bool path);
+
+	// bitmap access; cells outside the map are blocked
+	bool
+	free_(int32_t x, int32_t y) const;
+
+	uint64_t
+	word_(int32_t cy, uint32_t k) const;
+
+	// the first cell c >= @param x in cell row @param cy whose state
+	// differs from @param state; ::width_ if there is none
+	int32_t
+	scan_right_(int32_t cy, int32_t x, bool state) const;
+
+	// the last cell c <= @param x in cell row @param cy whose state differs
+	// from @param state; -1 if there is none
+	int32_t
+	scan_left_(int32_t cy, int32_t x, bool state) const;
+
+	// the run of free cells in row @param cy containing cell @param x, as
+	// the points [@param lo, @param hi] on its borders
+	void
+	run_(int32_t cy, int32_t x, int32_t& lo, int32_t& hi) const;
+
+	// the nearest corner point of row @param y after / before point
+	// @param x; a corner is a point where a row of cells next to it
+	// changes from free to blocked or back
+	int32_t
+	next_corner_(int32_t y, int32_t x) const;
+
+	int32_t
+	prev_corner_(int32_t y, int32_t x) const;
+
+	// the cells of rows @param y - 1 and @param y in word @param k, and
+	// the same shifted by one cell, so that bit i of @param prev_above is
+	// the cell before bit i of @param above
+	void
+	words_(
+	    int32_t y, uint32_t k, uint64_t& above, uint64_t& below,
+	    uint64_t& prev_above, uint64_t& prev_below) const;
+
+	// is point (@param x, @param y) between two blocked cells which touch
+	// at the point (and two free ones)?
+	bool
+	double_corner_(int32_t x, int32_t y) const;
+
+	// how far along row @param y a path can go from point @param x; it
+	// stops where neither the cells above nor below are free, and at
+	// double corners
+	int32_t
+	flat_end_right_(int32_t y, int32_t x) const;
+
+	int32_t
+	flat_end_left_(int32_t y, int32_t x) const;
+
+	double
+	heuristic_(const node& n) const;
+
+	// add [@param lo, @param hi] on @param row, split at corners, as nodes
+	// with root (@param rx, @param ry)
+	void
+	push_cone_(
+	    double lo, bool lo_open, double hi, bool hi_open, int32_t row,
+	    int32_t rx, int32_t ry, double g, uint32_t parent);
+
+	// can a path turn at the end @param x of an interval on row @param y?
+	// only reachable grid points which are not double corners qualify
+	bool
+	turns_(double x, bool open, int32_t y) const;
+
+	void
+	push_(const node& n);
+
+	// is (@param x, @param y) a new root, or one reached no worse than
+	// before with cost @param g?
+	bool
+	relax_root_(int32_t x, int32_t y, double g);
+
+	void
+	expand_start_(uint32_t index);
+
+	void
+	expand_flat_(uint32_t index);
+
+	void
+	expand_cone_(uint32_t index);
+};
+
+} // namespace warthog::anya
+
+#endif // WARTHOG_ANYA_ANYA_SEARCH_H
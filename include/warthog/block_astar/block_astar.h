@@ -0,0 +1,171 @@
+#ifndef WARTHOG_BLOCK_ASTAR_BLOCK_ASTAR_H
+#define WARTHOG_BLOCK_ASTAR_BLOCK_ASTAR_H
+
+// block_astar/block_astar.h
+//
+// Block A* (Yap, Burch, Holte and Schaeffer, 2011) for octile gridmaps.
+// The open list holds 4x4 blocks of cells, not single cells. A block is
+// queued when the g-values of some of its cells (its ingress cells) go
+// down, with the least f-value among them as its key. Expanding the block
+// carries the new g-values to all of its cells at once, using the local
+// distances of its obstacle pattern from an lddb. Then each improved cell
+// on the border of the block is relaxed into the neighbouring blocks.
+//
+// Obstacle patterns are read from the rows of the gridmap 64 cells at a
+// time (get_neighbours_64bit) and kept per block; change the map through
+// ::set_label to keep them current. The search stops once no queued block
+// has a key below the cost of the target. Paths are optimal and are
+// returned cell by cell, the parts inside blocks being rebuilt from the
+// lddb.
+//
+// On open terrain one heap operation serves up to 16 cells, so the heap
+// is much smaller than that of cell-based A*.
+//
+// @created: 2026-10-19
+//
+
+#include "lddb.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/search/search_parameters.h>
+#include <warthog/search/solution.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::block_astar
+{
+
+class block_astar
+{
+public:
+	block_astar(domain::gridmap* map);
+
+	block_astar(const block_astar&) = delete;
+	block_astar&
+	operator=(const block_astar&)
+	    = delete;
+
+	void
+	get_path(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	void
+	get_pathcost(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	// set the label of the (unpadded) cell @param x, @param y on the map
+	// and update the pattern of its block
+	void
+	set_label(uint32_t x, uint32_t y, bool label);
+
+	// converts between scenario coordinates and pack_ids
+	search::gridmap_expansion_policy*
+	get_expander()
+	{
+		return &expander_;
+	}
+
+	lddb&
+	get_lddb()
+	{
+		return lddb_;
+	}
+
+	size_t
+	mem();
+
+private:
+	struct open_entry
+	{
+		double f_;
+		double g_; // of the cell which set f_
+		uint32_t block_;
+	};
+
+	domain::gridmap* map_;
+	search::gridmap_expansion_policy expander_;
+	lddb lddb_;
+	uint32_t blocks_per_row_;
+	uint32_t block_rows_;
+	std::vector<uint16_t> patterns_;
+
+	// per query; the values of a block are valid if its stamp matches
+	std::vector<double> g_;
+	std::vector<uint32_t> parent_; // padded id of the predecessor
+	std::vector<uint32_t> stamp_;
+	std::vector<uint16_t> ingress_; // cells improved since expanded
+	std::vector<double> key_;
+	std::vector<open_entry> open_;
+	uint32_t search_stamp_ = 0;
+	uint32_t target_x_     = 0;
+	uint32_t target_y_     = 0;
+	pad_id target_;
+	double target_g_ = 0;
+	search::search_metrics* met_ = nullptr;
+
+	void
+	search_(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol, bool path);
+
+	// the obstacle pattern of block (@param bx, @param by)
+	uint16_t
+	read_pattern_(uint32_t bx, uint32_t by) const;
+
+	// padded id of cell @param i of block @param block
+	pad_id
+	cell_(uint32_t block, uint32_t i) const
+	{
+		uint32_t x = (block % blocks_per_row_) * lddb::BLOCK_SIZE
+		    + i % lddb::BLOCK_SIZE;
+		uint32_t y = (block / blocks_per_row_) * lddb::BLOCK_SIZE
+		    + i / lddb::BLOCK_SIZE;
+		return map_->to_padded_id_from_padded(x, y);
+	}
+
+	// the block of padded (@param x, @param y)
+	uint32_t
+	block_(uint32_t x, uint32_t y) const
+	{
+		return (y / lddb::BLOCK_SIZE) * blocks_per_row_
+		    + x / lddb::BLOCK_SIZE;
+	}
+
+	// the index of padded (@param x, @param y) in its block
+	static uint32_t
+	index_(uint32_t x, uint32_t y)
+	{
+		return (y % lddb::BLOCK_SIZE) * lddb::BLOCK_SIZE
+		    + x % lddb::BLOCK_SIZE;
+	}
+
+	double
+	heuristic_(uint32_t x, uint32_t y) const;
+
+	// reset the values of @param block if it is not yet in this search
+	void
+	touch_(uint32_t block);
+
+	// lower the g-value of padded (@param x, @param y) in a neighbouring
+	// block to @param g, if that improves it, and queue the block
+	void
+	relax_(uint32_t x, uint32_t y, double g, pad_id from);
+
+	void
+	expand_(uint32_t block);
+
+	// append the cells strictly between cells @param from and @param to of
+	// @param block on a shortest path inside it, in reverse
+	void
+	local_path_(
+	    uint32_t block, uint32_t from, uint32_t to,
+	    std::vector<pad_id>& out);
+};
+
+} // namespace warthog::block_astar
+
+#endif // WARTHOG_BLOCK_ASTAR_BLOCK_ASTAR_H
@@ -0,0 +1,87 @@
+#ifndef WARTHOG_BLOCK_ASTAR_LDDB_H
+#define WARTHOG_BLOCK_ASTAR_LDDB_H
+
+// block_astar/lddb.h
+//
+// A local distance database for Block A* (Yap, Burch, Holte and
+// Schaeffer, 2011): the octile distances between the cells of a 4x4 block,
+// for each of the 2^16 patterns of obstacles in the block. Paths stay in
+// the block and, as in gridmap_expansion_policy, never cut corners.
+//
+// Cell i of a block is at (i % 4, i / 4), and bit i of a pattern is set if
+// the cell is traversable. A distance is stored in one byte, as its
+// numbers of diagonal (high nibble) and cardinal (low nibble) moves;
+// ::NONE if there is no path. The table has a fixed size of 16 MiB, and
+// the entries of a pattern are computed when it is first used.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/constants.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::block_astar
+{
+
+class lddb
+{
+public:
+	static constexpr uint32_t BLOCK_SIZE = 4;
+	static constexpr uint32_t CELLS      = BLOCK_SIZE * BLOCK_SIZE;
+	static constexpr uint32_t PATTERNS   = 1u << CELLS;
+	static constexpr uint8_t NONE        = 0xff;
+	// the distances of single cardinal and diagonal moves
+	static constexpr uint8_t CARDINAL = 0x01;
+	static constexpr uint8_t DIAGONAL = 0x10;
+
+	lddb();
+
+	lddb(const lddb&) = delete;
+	lddb&
+	operator=(const lddb&)
+	    = delete;
+
+	// the distances of blocks with obstacle pattern @param pattern; the
+	// distance from cell a to cell b is entry a * CELLS + b
+	const uint8_t*
+	get(uint16_t pattern)
+	{
+		if(!(computed_[pattern >> 6] & (uint64_t{1} << (pattern & 63))))
+		{
+			compute_(pattern);
+		}
+		return &table_[size_t(pattern) * CELLS * CELLS];
+	}
+
+	// the cost of distance @param d
+	double
+	cost(uint8_t d) const noexcept
+	{
+		return costs_[d];
+	}
+
+	// the number of patterns computed so far
+	uint32_t
+	get_num_computed() const noexcept
+	{
+		return num_computed_;
+	}
+
+	size_t
+	mem() const;
+
+private:
+	std::vector<uint8_t> table_;
+	std::vector<uint64_t> computed_;
+	uint32_t num_computed_ = 0;
+	double costs_[256];
+
+	void
+	compute_(uint16_t pattern);
+};
+
+} // namespace warthog::block_astar
+
+#endif // WARTHOG_BLOCK_ASTAR_LDDB_H
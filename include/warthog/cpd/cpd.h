@@ -0,0 +1,189 @@
+#ifndef WARTHOG_CPD_CPD_H
+#define WARTHOG_CPD_CPD_H
+
+// cpd/cpd.h
+//
+// A compressed path database (CPD; Botea, 2011; Strasser et al., 2015) for
+// gridmaps. For every source cell the database stores the first move of an
+// optimal path to every target cell. Targets are ordered so that nearby
+// cells have nearby ranks, which makes long runs of targets share a first
+// move; each row of the table is stored run-length compressed, as a sorted
+// list of (first target rank, move) pairs.
+//
+// The database is built offline by cpd_builder and is read in place, from
+// a memory mapped file. The file layout is:
+//
+//   cpd_header
+//   uint32_t rank[width * height]      target rank of each padded cell id
+//                                      (::NO_RANK for obstacles)
+//   (zero padding to a multiple of 8 bytes)
+//   uint64_t offset[num_nodes + 1]     index of the first run of each row
+//   uint32_t run[num_runs]             (first target rank << 4) | move
+//
+// Ranks are assigned in depth-first order, so each connected component
+// covers a contiguous range of ranks. The row of a source only describes
+// the targets in its own component: targets below the first run, or in a
+// trailing run with move ::NO_MOVE, are unreachable.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/domain/gridmap.h>
+#include <warthog/util/mmap_file.h>
+
+#include <array>
+#include <cstdint>
+
+namespace warthog::cpd
+{
+
+// moves, in the order gridmap_expansion_policy generates them
+enum move : uint8_t
+{
+	N  = 0,
+	E  = 1,
+	S  = 2,
+	W  = 3,
+	NE = 4,
+	SE = 5,
+	SW = 6,
+	NW = 7
+};
+constexpr uint32_t NUM_MOVES = 8;
+constexpr uint32_t NO_MOVE   = 8;
+constexpr uint32_t MOVE_BITS = 4;
+constexpr uint32_t NO_RANK   = UINT32_MAX;
+constexpr uint32_t MAX_RANK  = (UINT32_MAX >> MOVE_BITS);
+
+constexpr std::array<int32_t, NUM_MOVES> MOVE_DX
+    = {0, 1, 0, -1, 1, 1, -1, -1};
+constexpr std::array<int32_t, NUM_MOVES> MOVE_DY
+    = {-1, 0, 1, 0, -1, 1, 1, -1};
+
+constexpr uint32_t CPD_MAGIC   = 0x44504357; // "WCPD"
+constexpr uint32_t CPD_VERSION = 1;
+
+struct cpd_header
+{
+	uint32_t magic_;
+	uint32_t version_;
+	// padded dimensions of the map
+	uint32_t width_;
+	uint32_t height_;
+	// number of traversable cells
+	uint32_t num_nodes_;
+	uint32_t reserved_;
+	uint64_t num_runs_;
+	// see domain::gridmap::signature
+	uint64_t signature_;
+};
+static_assert(sizeof(cpd_header) == 40);
+
+// the byte offsets of each section of a database file
+struct cpd_layout
+{
+	cpd_layout(uint32_t width, uint32_t height, uint32_t num_nodes,
+	    uint64_t num_runs);
+
+	size_t rank_;
+	size_t offset_;
+	size_t run_;
+	size_t size_;
+};
+
+// read-only access to a database file
+class cpd
+{
+public:
+	cpd() = default;
+
+	cpd(const cpd&) = delete;
+	cpd&
+	operator=(const cpd&)
+	    = delete;
+
+	// map the database in @param filename. fails if the file is not a
+	// database for @param map.
+	// @return false on failure
+	bool
+	load(const char* filename, const domain::gridmap& map);
+
+	bool
+	is_loaded() const
+	{
+		return header_ != nullptr;
+	}
+
+	// the first move of an optimal path from @param source to
+	// @param target, or ::NO_MOVE if target is unreachable.
+	// the result is undefined when source == target.
+	uint32_t
+	get_move(pad_id source, pad_id target) const
+	{
+		uint32_t rs = rank_[uint32_t(source.id)];
+		uint32_t rt = rank_[uint32_t(target.id)];
+		if(rs == NO_RANK || rt == NO_RANK) { return NO_MOVE; }
+		return get_move_by_rank(rs, rt);
+	}
+
+	// as ::get_move, for the ranks of a source and target
+	uint32_t
+	get_move_by_rank(uint32_t source_rank, uint32_t target_rank) const
+	{
+		const uint32_t* first = run_ + offset_[source_rank];
+		const uint32_t* last  = run_ + offset_[source_rank + 1];
+		// the last run starting at or before the target
+		uint32_t key = (target_rank << MOVE_BITS) | (NUM_MOVES * 2 - 1);
+		while(first < last)
+		{
+			const uint32_t* mid = first + (last - first) / 2;
+			if(*mid <= key) { first = mid + 1; }
+			else { last = mid; }
+		}
+		if(first == run_ + offset_[source_rank]) { return NO_MOVE; }
+		return first[-1] & ((1u << MOVE_BITS) - 1);
+	}
+
+	// the padded id of the cell reached from @param from with move @param m
+	pad_id
+	step(pad_id from, uint32_t m) const
+	{
+		return pad_id{uint32_t(from.id) + delta_[m]};
+	}
+
+	uint32_t
+	get_rank(pad_id id) const
+	{
+		return rank_[uint32_t(id.id)];
+	}
+
+	const cpd_header&
+	get_header() const
+	{
+		return *header_;
+	}
+
+	size_t
+	file_size() const
+	{
+		return file_.size();
+	}
+
+	size_t
+	mem() const
+	{
+		return sizeof(*this);
+	}
+
+private:
+	util::mmap_file file_;
+	const cpd_header* header_ = nullptr;
+	const uint32_t* rank_     = nullptr;
+	const uint64_t* offset_   = nullptr;
+	const uint32_t* run_      = nullptr;
+	std::array<uint32_t, NUM_MOVES> delta_{};
+};
+
+} // namespace warthog::cpd
+
+#endif // WARTHOG_CPD_CPD_H
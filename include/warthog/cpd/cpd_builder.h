@@ -0,0 +1,91 @@
+#ifndef WARTHOG_CPD_CPD_BUILDER_H
+#define WARTHOG_CPD_CPD_BUILDER_H
+
+// cpd/cpd_builder.h
+//
+// Offline construction of a compressed path database (see cpd/cpd.h).
+//
+// Cells are ranked in depth-first order over the moves of
+// gridmap_expansion_policy. Then, for every source, a Dijkstra search over
+// gridmap_expansion_policy records the set of all optimal first moves to
+// each target. Each row is compressed greedily: a run is extended for as
+// long as some move is optimal for every target in it. The searches are
+// independent and are distributed over all cores with
+// util::parallel_compute; each worker thread has its own expander.
+//
+// Time and memory are quadratic in the number of traversable cells. The
+// uncompressed first-move sets of one source are held per thread; only the
+// compressed rows are kept.
+//
+// @created: 2026-10-19
+//
+
+#include "cpd.h"
+#include <warthog/domain/gridmap.h>
+
+#include <chrono>
+#include <vector>
+
+namespace warthog::cpd
+{
+
+class cpd_builder
+{
+public:
+	cpd_builder(domain::gridmap* map);
+
+	cpd_builder(const cpd_builder&) = delete;
+	cpd_builder&
+	operator=(const cpd_builder&)
+	    = delete;
+
+	// compute the first-move table of every source
+	void
+	build();
+
+	// write the database to @param filename, in the layout described in
+	// cpd/cpd.h
+	// @return the number of bytes written, or 0 on failure
+	size_t
+	save(const char* filename) const;
+
+	// wallclock time of the last call to ::build
+	std::chrono::nanoseconds
+	get_build_time() const
+	{
+		return build_time_;
+	}
+
+	uint32_t
+	get_num_nodes() const
+	{
+		return uint32_t(cells_.size());
+	}
+
+	uint64_t
+	get_num_runs() const;
+
+	size_t
+	mem() const;
+
+private:
+	domain::gridmap* map_;
+	// rank of each padded id, and padded id of each rank
+	std::vector<uint32_t> rank_;
+	std::vector<pad_id> cells_;
+	// the range of ranks [begin, end) in the component of each rank
+	std::vector<uint32_t> component_begin_;
+	std::vector<uint32_t> component_end_;
+	std::vector<std::vector<uint32_t>> rows_;
+	std::chrono::nanoseconds build_time_{0};
+
+	void
+	compute_ranks_();
+
+	static void*
+	build_worker_(void* params);
+};
+
+} // namespace warthog::cpd
+
+#endif // WARTHOG_CPD_CPD_BUILDER_H
@@ -0,0 +1,75 @@
+#ifndef WARTHOG_CPD_CPD_SEARCH_H
+#define WARTHOG_CPD_CPD_SEARCH_H
+
+// cpd/cpd_search.h
+//
+// Path extraction from a compressed path database (see cpd/cpd.h). An
+// optimal path is found without search: starting at the source, the
+// first move to the target is looked up and followed, until the target is
+// reached. Each step is one binary search over a row of runs.
+//
+// The number of first-move lookups is reported as nodes_expanded_.
+//
+// @created: 2026-10-19
+//
+
+#include "cpd.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/search/search_parameters.h>
+#include <warthog/search/solution.h>
+
+namespace warthog::cpd
+{
+
+class cpd_search
+{
+public:
+	// @param db must be loaded for @param map
+	cpd_search(domain::gridmap* map, cpd* db);
+
+	cpd_search(const cpd_search&) = delete;
+	cpd_search&
+	operator=(const cpd_search&)
+	    = delete;
+
+	void
+	get_path(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	void
+	get_pathcost(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	// converts between unpadded coordinates and ids; no nodes are generated
+	search::gridmap_expansion_policy*
+	get_expander()
+	{
+		return &expander_;
+	}
+
+	cpd*
+	get_cpd()
+	{
+		return db_;
+	}
+
+	size_t
+	mem();
+
+private:
+	domain::gridmap* map_;
+	cpd* db_;
+	search::gridmap_expansion_policy expander_;
+
+	void
+	walk_(
+	    search::problem_instance* pi, search::solution* sol, bool keep_path);
+};
+
+} // namespace warthog::cpd
+
+#endif // WARTHOG_CPD_CPD_SEARCH_H
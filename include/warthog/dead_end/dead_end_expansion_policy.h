@@ -0,0 +1,100 @@
+#ifndef WARTHOG_DEAD_END_DEAD_END_EXPANSION_POLICY_H
+#define WARTHOG_DEAD_END_DEAD_END_EXPANSION_POLICY_H
+
+// dead_end/dead_end_expansion_policy.h
+//
+// Decorates an ExpansionPolicy for octile gridmaps, by default
+// gridmap_expansion_policy, and drops each successor inside a region of a
+// dead_end_map which holds neither the start nor the target of the query.
+// Searches stay optimal, and no longer flood rooms and alcoves off the
+// way between the two.
+//
+// The decorated policy must move between neighbouring cells at octile
+// costs; policies whose moves jump over cells, or which weigh cells
+// differently, can lose optimality.
+//
+// @created: 2026-10-19
+//
+
+#include "dead_end_map.h"
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <utility>
+#include <vector>
+
+namespace warthog::dead_end
+{
+
+template<class Policy = search::gridmap_expansion_policy>
+class dead_end_expansion_policy : public Policy
+{
+public:
+	// @param args are passed on to the constructor of Policy
+	template<typename... Args>
+	dead_end_expansion_policy(const dead_end_map* regions, Args&&... args)
+	    : Policy(std::forward<Args>(args)...), regions_(regions)
+	{ }
+
+	void
+	expand(
+	    search::search_node* current,
+	    search::search_problem_instance* pi) override
+	{
+		Policy::expand(current, pi);
+
+		kept_.clear();
+		bool pruned = false;
+		search::search_node* n;
+		double cost;
+		for(this->first(n, cost); n != nullptr; this->next(n, cost))
+		{
+			pad_id id = n->get_id();
+			if(regions_->in_region(id)
+			   && !regions_->needed(id, start_key_, target_key_))
+			{
+				pruned = true;
+				continue;
+			}
+			kept_.emplace_back(n, cost);
+		}
+		if(!pruned) { return; }
+
+		this->reset();
+		for(auto& [node, c] : kept_)
+		{
+			this->add_neighbour(node, c);
+		}
+	}
+
+	search::search_node*
+	generate_start_node(search::search_problem_instance* pi) override
+	{
+		search::search_node* start = Policy::generate_start_node(pi);
+		if(start != nullptr)
+		{
+			start_key_  = regions_->get_key(pi->start_);
+			target_key_ = uint32_t{pi->target_} < this->map_->padded_mapsize()
+			    ? regions_->get_key(pi->target_)
+			    : dead_end_map::NONE;
+		}
+		return start;
+	}
+
+	size_t
+	mem() override
+	{
+		return Policy::mem() + regions_->mem()
+		    + kept_.capacity() * sizeof(kept_[0]);
+	}
+
+private:
+	const dead_end_map* regions_;
+	// see dead_end_map::get_key
+	uint32_t start_key_  = dead_end_map::NONE;
+	uint32_t target_key_ = dead_end_map::NONE;
+	std::vector<std::pair<search::search_node*, double>> kept_;
+};
+
+} // namespace warthog::dead_end
+
+#endif // WARTHOG_DEAD_END_DEAD_END_EXPANSION_POLICY_H
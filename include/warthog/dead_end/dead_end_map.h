@@ -0,0 +1,161 @@
+#ifndef WARTHOG_DEAD_END_DEAD_END_MAP_H
+#define WARTHOG_DEAD_END_DEAD_END_MAP_H
+
+// dead_end/dead_end_map.h
+//
+// Dead ends and swamps of a gridmap: regions which no optimal path enters
+// unless its start or target is inside them. See
+// dead_end_expansion_policy, which skips them.
+//
+// The traversable cells are split into row runs, found 64 cells at a
+// time. Moves never cut corners, so runs are connected iff they overlap in
+// adjacent rows. A run whose removal disconnects the run graph (an
+// articulation point, found by depth-first search) is a doorway: every
+// move into the region behind it comes from one of its cells, and any
+// path which enters the region from the doorway and leaves through it
+// again is no shorter than walking along the doorway instead. The region
+// can therefore be skipped by any query which does not start or end in it.
+//
+// The search is rooted near the centre of each component, so the regions
+// behind doorways are the parts away from it; they nest. Each cell in a
+// region is marked in a bittable, and the innermost region holding it is
+// a subtree of the search, an interval of preorder numbers. A marked cell
+// is needed by a query iff its innermost region holds the start or the
+// target; see ::needed.
+//
+// The regions must be rebuilt after the map changes.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/memory/bittable.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace warthog::dead_end
+{
+
+class dead_end_map
+{
+public:
+	using mask_table = memory::bittable<pad_id, uint64_t>;
+
+	static constexpr uint32_t NONE = UINT32_MAX;
+
+	dead_end_map(const domain::gridmap* map);
+
+	dead_end_map(const dead_end_map&) = delete;
+	dead_end_map&
+	operator=(const dead_end_map&)
+	    = delete;
+
+	// find the regions of the map in its current state
+	void
+	build();
+
+	// one bit per padded id; set for the cells in some region
+	const mask_table&
+	get_mask() const noexcept
+	{
+		return mask_;
+	}
+
+	bool
+	in_region(pad_id id) const noexcept
+	{
+		return mask_.get(id) != 0;
+	}
+
+	// a key for the padded id @param id of the start or target of a
+	// query, or NONE if it is not traversable
+	uint32_t
+	get_key(pad_id id) const noexcept
+	{
+		uint32_t run = find_run_(id);
+		return run == NONE ? NONE : pre_[run];
+	}
+
+	// is the cell @param id, which is ::in_region, needed by a query with
+	// keys @param start_key and @param target_key?
+	bool
+	needed(pad_id id, uint32_t start_key, uint32_t target_key) const noexcept
+	{
+		uint32_t region = region_[find_run_(id)];
+		uint32_t first  = pre_[region];
+		return (start_key - first < size_[region])
+		    || (target_key - first < size_[region]);
+	}
+
+	uint32_t
+	get_num_runs() const noexcept
+	{
+		return uint32_t(runs_.size());
+	}
+
+	// the number of cells in some region
+	size_t
+	get_num_cells() const noexcept
+	{
+		return num_cells_;
+	}
+
+	size_t
+	mem() const;
+
+private:
+	// cells [x1_, x2_] of padded row y_
+	struct run
+	{
+		uint32_t x1_, x2_, y_;
+	};
+
+	const domain::gridmap* map_;
+	uint32_t words_per_row_;
+	size_t num_cells_ = 0;
+
+	// runs of each padded row, ordered by x; row y has the runs
+	// [row_first_[y], row_first_[y + 1])
+	std::vector<run> runs_;
+	std::vector<uint32_t> row_first_;
+	// preorder number and subtree size of each run in the search, and the
+	// root of its innermost region (NONE outside any)
+	std::vector<uint32_t> pre_;
+	std::vector<uint32_t> size_;
+	std::vector<uint32_t> region_;
+
+	std::vector<uint64_t> mask_data_;
+	mask_table mask_;
+
+	// the run which holds @param id, or NONE
+	uint32_t
+	find_run_(pad_id id) const noexcept
+	{
+		uint32_t x     = id.id % map_->width();
+		uint32_t y     = id.id / map_->width();
+		auto first     = runs_.begin() + row_first_[y];
+		auto last      = runs_.begin() + row_first_[y + 1];
+		auto following = std::upper_bound(
+		    first, last, x,
+		    [](uint32_t x, const run& r) { return x < r.x1_; });
+		if(following == first || x > (following - 1)->x2_) { return NONE; }
+		return uint32_t(following - 1 - runs_.begin());
+	}
+
+	void
+	find_runs_();
+
+	// number the component of @param root from @param first in preorder,
+	// filling @param order, @param parent and @param low
+	void
+	search_(
+	    uint32_t root, uint32_t first, std::vector<uint32_t>& order,
+	    std::vector<uint32_t>& parent, std::vector<uint32_t>& low);
+};
+
+} // namespace warthog::dead_end
+
+#endif // WARTHOG_DEAD_END_DEAD_END_MAP_H
@@ -0,0 +1,140 @@
+#ifndef WARTHOG_DOMAIN_GRID_COMPONENTS_H
+#define WARTHOG_DOMAIN_GRID_COMPONENTS_H
+
+// domain/grid_components.h
+//
+// Connected components of the traversable cells of a grid, so that a query
+// whose start and target are in different components can be rejected in
+// constant time instead of by exhausting the region around the start.
+//
+// The octile moves of gridmap_expansion_policy and
+// vl_gridmap_expansion_policy never cut corners, so two cells are
+// connected iff they are connected by cardinal moves. Components are
+// built one row at a time from runs of traversable cells, found 64 cells
+// at a time; each run is united with the runs it overlaps in the row above
+// (union-find).
+//
+// The table keeps its own copy of which cells are traversable. After a
+// cell of the map changes, call ::set_label with the new state: a cell
+// which becomes traversable joins the components around it, and one which
+// becomes blocked splits its component only if its neighbours are not
+// connected around it, in which case the pieces are flood filled.
+//
+// @created: 2026-10-19
+//
+
+#include "gridmap.h"
+#include "labelled_gridmap.h"
+#include <warthog/constants.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::util
+{
+class cost_table;
+}
+
+namespace warthog::domain
+{
+
+class grid_components
+{
+public:
+	// the component of a blocked cell
+	static constexpr uint32_t NONE = UINT32_MAX;
+
+	grid_components(const gridmap& map);
+
+	// cells of @param map are traversable if their cost in @param costs
+	// is not 0, as in vl_gridmap_expansion_policy
+	grid_components(vl_gridmap& map, util::cost_table& costs);
+
+	grid_components(const grid_components&) = delete;
+	grid_components&
+	operator=(const grid_components&)
+	    = delete;
+
+	// the component of the cell with unpadded id @param id, or NONE if it
+	// is blocked or off the map
+	uint32_t
+	get_component(pack_id id) const noexcept
+	{
+		if(id.id >= label_.size()) { return NONE; }
+		uint32_t label = label_[id.id];
+		if(label == NONE) { return NONE; }
+		while(parent_[label] != label)
+		{
+			label = parent_[label];
+		}
+		return label;
+	}
+
+	// are cells @param a and @param b traversable and connected?
+	bool
+	connected(pack_id a, pack_id b) const noexcept
+	{
+		uint32_t ca = get_component(a);
+		return ca != NONE && ca == get_component(b);
+	}
+
+	uint32_t
+	get_num_components() const noexcept
+	{
+		return num_components_;
+	}
+
+	// record that unpadded cell (@param x, @param y) is now traversable
+	// or blocked, e.g. after gridmap::set_label
+	void
+	set_label(uint32_t x, uint32_t y, bool traversable);
+
+	size_t
+	mem() const noexcept
+	{
+		return sizeof(*this) + sizeof(uint64_t) * free_.capacity()
+		    + sizeof(uint32_t)
+		    * (label_.capacity() + parent_.capacity() + size_.capacity()
+		       + stack_.capacity());
+	}
+
+private:
+	uint32_t width_;
+	uint32_t height_;
+	uint32_t words_per_row_;
+	uint32_t num_components_;
+
+	std::vector<uint64_t> free_;   // one bit per cell, rows word aligned
+	std::vector<uint32_t> label_;  // per cell, NONE if blocked
+	std::vector<uint32_t> parent_; // union-find over labels
+	std::vector<uint32_t> size_;   // cells in each component, at its root
+	std::vector<uint32_t> stack_;  // for flood fills
+
+	bool
+	free_at_(int64_t x, int64_t y) const noexcept
+	{
+		if(x < 0 || y < 0 || x >= width_ || y >= height_) { return false; }
+		uint64_t word = free_[y * words_per_row_ + (x >> 6)];
+		return (word >> (x & 63)) & 1;
+	}
+
+	void
+	build_();
+
+	uint32_t
+	new_label_();
+
+	// merges the components with roots @param a and @param b and returns
+	// the root of the union
+	uint32_t
+	unite_(uint32_t a, uint32_t b);
+
+	// gives the cells connected to (@param x, @param y) the new label
+	// @param label; returns how many there are
+	uint32_t
+	fill_(uint32_t x, uint32_t y, uint32_t label);
+};
+
+} // namespace warthog::domain
+
+#endif // WARTHOG_DOMAIN_GRID_COMPONENTS_H
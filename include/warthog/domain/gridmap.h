@@ -32,6 +32,7 @@
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <vector>
 
 namespace warthog::domain
 {
@@ -304,6 +305,15 @@ public:
 	set_label(pad_id grid_id, bool label)
 	{
 		bittable::set(grid_id, label);
+		version_++;
+	}
+
+	// the number of calls to ::set_label so far. data built from the map
+	// can be checked against it to notice that the map has changed.
+	uint64_t
+	get_version() const noexcept
+	{
+		return version_;
 	}
 
 	uint32_t
@@ -336,6 +346,34 @@ public:
 		return num_traversable_;
 	}
 
+	// is there a straight line between the centres of the padded ids
+	// @param from and @param to which meets no obstacle? The line may
+	// neither cross a blocked cell nor touch one at a corner, so moves
+	// between adjacent cells follow the rules of gridmap_expansion_policy.
+	// The cells the line meets are tested one row at a time, 64 cells per
+	// aligned 64-bit read.
+	bool
+	line_of_sight(pad_id from, pad_id to) const noexcept;
+
+	bool
+	line_of_sight(pack_id from, pack_id to) const noexcept
+	{
+		return line_of_sight(to_padded_id(from), to_padded_id(to));
+	}
+
+	// string pulling: removes from @param path (e.g. solution::path_) every
+	// waypoint that the waypoint kept before it can see past, using
+	// ::line_of_sight. What remains is an any-angle path through the same
+	// corridor. Returns its Euclidean length.
+	double
+	smooth_path(std::vector<pack_id>& path) const;
+
+	// a hash of the dimensions and traversable cells of the map. data
+	// precomputed for a map (and saved to disk) records the signature, and
+	// is only valid for maps with the same signature.
+	uint64_t
+	signature() const noexcept;
+
 	void
 	print(std::ostream&);
 
@@ -363,6 +401,7 @@ private:
 	uint32_t padding_column_above_;
 	uint32_t max_id_;
 	uint32_t num_traversable_;
+	uint64_t version_ = 0;
 
 	void
 	init_db();
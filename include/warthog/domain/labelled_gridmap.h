@@ -139,6 +139,14 @@ public:
 	set_label(uint32_t padded_id, CELL label)
 	{
 		db_[padded_id] = label;
+		version_++;
+	}
+
+	// the number of calls to ::set_label so far, as in gridmap
+	uint64_t
+	get_version() const noexcept
+	{
+		return version_;
 	}
 
 	uint32_t
@@ -188,6 +196,7 @@ private:
 	uint32_t padded_rows_after_last_row_;
 	uint32_t padded_width_;
 	uint32_t padded_height_;
+	uint64_t version_ = 0;
 
 	void
 	init_db()
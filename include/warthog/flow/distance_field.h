@@ -0,0 +1,174 @@
+#ifndef WARTHOG_FLOW_DISTANCE_FIELD_H
+#define WARTHOG_FLOW_DISTANCE_FIELD_H
+
+// flow/distance_field.h
+//
+// Exact distance fields on uniform-cost gridmaps. Each cell gets its
+// number of moves from the nearest of one or more sources, and a flow
+// direction: the move to a neighbour one step nearer. Agents heading for
+// the sources follow the flow.
+//
+// Moves are 4-connected, or 8-connected with every move costing 1 and, as
+// in gridmap_expansion_policy, no corner cutting. The field is computed
+// breadth first, 64 cells at a time: each wavefront is a bitmap over the
+// rows of the gridmap, and the cells it reaches are found with shifts and
+// ANDs of whole words, on only those words next to the ones holding the
+// wavefront. The cells reached are then written one at a time to the output
+// arrays.
+//
+// Distances are of type D (uint16_t or uint32_t). Cells which are blocked,
+// unreachable, or further than the cutoff or the largest value of D, are
+// left at UNREACHED with flow FLOW_NONE.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace warthog::flow
+{
+
+// flow directions, in the order of the moves of gridmap_expansion_policy
+enum flow_dir : uint8_t
+{
+	FLOW_N  = 0,
+	FLOW_E  = 1,
+	FLOW_S  = 2,
+	FLOW_W  = 3,
+	FLOW_NE = 4,
+	FLOW_SE = 5,
+	FLOW_SW = 6,
+	FLOW_NW = 7,
+	// the cell is a source
+	FLOW_SOURCE = 8,
+	// the cell is not reached
+	FLOW_NONE = 0xff
+};
+
+constexpr int32_t FLOW_DX[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+constexpr int32_t FLOW_DY[8] = {-1, 0, 1, 0, -1, 1, 1, -1};
+
+template<std::unsigned_integral D>
+class distance_field
+{
+public:
+	using distance_type          = D;
+	static constexpr D UNREACHED = std::numeric_limits<D>::max();
+
+	distance_field(const domain::gridmap* map, bool diagonal = true);
+
+	distance_field(const distance_field&) = delete;
+	distance_field&
+	operator=(const distance_field&)
+	    = delete;
+
+	// compute the field of the traversable cells among @param sources
+	// (unpadded ids), up to @param max_distance moves; blocked sources are
+	// ignored. the map is read anew each time.
+	void
+	compute(
+	    const std::vector<pack_id>& sources,
+	    D max_distance = UNREACHED - 1);
+
+	void
+	compute(pack_id source, D max_distance = UNREACHED - 1)
+	{
+		compute(std::vector<pack_id>{source}, max_distance);
+	}
+
+	// the distance of the cell with unpadded id @param id
+	D
+	get_distance(pack_id id) const noexcept
+	{
+		return dist_[id.id];
+	}
+
+	// the flow direction of the cell with unpadded id @param id
+	uint8_t
+	get_flow(pack_id id) const noexcept
+	{
+		return flow_[id.id];
+	}
+
+	// per unpadded id
+	const std::vector<D>&
+	get_distances() const noexcept
+	{
+		return dist_;
+	}
+
+	const std::vector<uint8_t>&
+	get_flows() const noexcept
+	{
+		return flow_;
+	}
+
+	// the cells reached by the last computation, one bit per padded id
+	// in words of 64 (rows of the gridmap are word aligned)
+	const std::vector<uint64_t>&
+	get_reached() const noexcept
+	{
+		return visited_;
+	}
+
+	// the number of wavefronts of the last computation
+	uint32_t
+	get_num_waves() const noexcept
+	{
+		return num_waves_;
+	}
+
+	bool
+	diagonal() const noexcept
+	{
+		return diagonal_;
+	}
+
+	size_t
+	mem() const;
+
+private:
+	const domain::gridmap* map_;
+	bool diagonal_;
+	uint32_t words_per_row_;
+	uint32_t num_waves_ = 0;
+
+	std::vector<D> dist_;
+	std::vector<uint8_t> flow_;
+
+	// one bit per padded id
+	std::vector<uint64_t> free_;
+	std::vector<uint64_t> visited_;
+	std::vector<uint64_t> front_;
+	std::vector<uint64_t> next_;
+
+	// the nonzero words of ::front_ and ::next_
+	std::vector<uint32_t> front_words_;
+	std::vector<uint32_t> next_words_;
+	// the last wave to look at each word
+	std::vector<uint32_t> stamp_;
+
+	// move the cells of the wavefront one step on, to distance @param d,
+	// looking only at the words next to those of the wavefront
+	void
+	step_(D d);
+
+	// the cells of word @param w of ::next_ at distance @param d
+	uint64_t
+	reach_(uint32_t w, D d);
+
+	// record the cells of @param bits, of word @param w, at distance
+	// @param d with flow @param dir
+	void
+	write_(uint32_t w, uint64_t bits, D d, uint8_t dir);
+};
+
+} // namespace warthog::flow
+
+#endif // WARTHOG_FLOW_DISTANCE_FIELD_H
@@ -0,0 +1,171 @@
+#ifndef WARTHOG_FLOW_FLOW_FIELD_SERVICE_H
+#define WARTHOG_FLOW_FLOW_FIELD_SERVICE_H
+
+// flow/flow_field_service.h
+//
+// Flow fields for many agents heading to the same targets. The field of a
+// target holds, for every cell, the first move of a shortest path from the
+// cell to the target (a flow_dir, as in flow/distance_field.h). It is
+// computed by one Dijkstra search rooted at the target, over the moves of
+// the expander; the moves of gridmap_expansion_policy and
+// vl_gridmap_expansion_policy cost the same both ways, so this search is
+// the reverse search from all cells at once. Agents then follow the field,
+// one lookup per step, instead of searching.
+//
+// Fields are cached per target, up to a fixed number of them; the least
+// recently used field is evicted to make room. The cache is cleared when
+// the version of the map changes, that is after any call to its
+// set_label.
+//
+// ::get_path follows the field of the target of a problem instance, so
+// the service can be run as a search. The Dijkstra search of a field not
+// in the cache is reported in the metrics; a cached field costs none.
+//
+// @created: 2026-10-19
+//
+
+#include "distance_field.h"
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/search/search_metrics.h>
+#include <warthog/search/search_parameters.h>
+#include <warthog/search/solution.h>
+#include <warthog/search/vl_gridmap_expansion_policy.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace warthog::flow
+{
+
+template<class Expander>
+class flow_field_service
+{
+public:
+	// keep at most @param capacity fields (at least 1)
+	flow_field_service(Expander* expander, uint32_t capacity = 16);
+
+	flow_field_service(const flow_field_service&) = delete;
+	flow_field_service&
+	operator=(const flow_field_service&)
+	    = delete;
+
+	// the first moves to @param target (unpadded id), per unpadded id;
+	// computed unless cached. FLOW_NONE where the target is out of reach.
+	// the field stays valid until it is evicted or the cache is cleared.
+	const std::vector<uint8_t>&
+	get_field(pack_id target);
+
+	// the first move from @param from to @param target
+	uint8_t
+	next_move(pack_id target, pack_id from)
+	{
+		return get_field(target)[from.id];
+	}
+
+	// the cell after @param from on a shortest path to @param target, or
+	// pack_id::max() if there is none; @param from if it is the target
+	pack_id
+	next(pack_id target, pack_id from);
+
+	void
+	get_path(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	void
+	get_pathcost(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	// drop all fields
+	void
+	clear();
+
+	Expander*
+	get_expander()
+	{
+		return expander_;
+	}
+
+	uint32_t
+	get_capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	uint32_t
+	get_num_fields() const noexcept
+	{
+		return uint32_t(fields_.size());
+	}
+
+	uint64_t
+	get_num_hits() const noexcept
+	{
+		return hits_;
+	}
+
+	uint64_t
+	get_num_misses() const noexcept
+	{
+		return misses_;
+	}
+
+	size_t
+	mem();
+
+private:
+	struct field
+	{
+		pack_id target_;
+		// the fields used just after and just before this one
+		uint32_t newer_;
+		uint32_t older_;
+		std::vector<uint8_t> moves_;
+	};
+
+	Expander* expander_;
+	uint32_t capacity_;
+	uint64_t version_;
+	uint64_t hits_   = 0;
+	uint64_t misses_ = 0;
+	std::vector<field> fields_;
+	// the index in ::fields_ of the field of each target
+	std::unordered_map<uint32_t, uint32_t> index_;
+	// the ends of the list of fields by use, as indexes in ::fields_
+	uint32_t newest_ = UINT32_MAX;
+	uint32_t oldest_ = UINT32_MAX;
+
+	// per Dijkstra search, indexed by padded id
+	std::vector<double> dist_;
+	std::vector<std::pair<double, uint32_t>> open_;
+	search::search_metrics* met_ = nullptr;
+
+	// the moves to padded @param target, into @param moves
+	void
+	dijkstra_(pad_id target, std::vector<uint8_t>& moves);
+
+	// the cell reached from @param from by @param move
+	pack_id
+	follow_(uint8_t move, pack_id from) const;
+
+	bool
+	traversable_(pad_id id);
+
+	void
+	walk_(
+	    search::problem_instance* pi, search::solution* sol, bool keep_path);
+
+	// make field @param f the most recently used
+	void
+	link_(uint32_t f);
+
+	void
+	unlink_(uint32_t f);
+};
+
+} // namespace warthog::flow
+
+#endif // WARTHOG_FLOW_FLOW_FIELD_SERVICE_H
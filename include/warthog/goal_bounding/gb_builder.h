@@ -0,0 +1,82 @@
+#ifndef WARTHOG_GOAL_BOUNDING_GB_BUILDER_H
+#define WARTHOG_GOAL_BOUNDING_GB_BUILDER_H
+
+// goal_bounding/gb_builder.h
+//
+// Offline construction of goal bounding tables (see
+// goal_bounding/gb_table.h).
+//
+// For every source, a Dijkstra search over gridmap_expansion_policy
+// records the set of optimal first moves to each target, and every target
+// grows the rectangle of each of its optimal first moves; ties thus keep
+// all optimal paths. The searches are independent and are distributed
+// over all cores with util::parallel_compute; each worker thread has its
+// own expander and writes only the rows of its own sources.
+//
+// Time is quadratic in the number of traversable cells; memory is
+// 64 bytes per traversable cell.
+//
+// @created: 2026-10-19
+//
+
+#include "gb_table.h"
+#include <warthog/domain/gridmap.h>
+
+#include <chrono>
+#include <vector>
+
+namespace warthog::goal_bounding
+{
+
+class gb_builder
+{
+public:
+	gb_builder(domain::gridmap* map);
+
+	gb_builder(const gb_builder&) = delete;
+	gb_builder&
+	operator=(const gb_builder&)
+	    = delete;
+
+	// compute the rectangles of every source
+	void
+	build();
+
+	// write the table to @param filename, in the layout described in
+	// goal_bounding/gb_table.h
+	// @return the number of bytes written, or 0 on failure
+	size_t
+	save(const char* filename) const;
+
+	// wallclock time of the last call to ::build
+	std::chrono::nanoseconds
+	get_build_time() const
+	{
+		return build_time_;
+	}
+
+	uint32_t
+	get_num_nodes() const
+	{
+		return uint32_t(cells_.size());
+	}
+
+	size_t
+	mem() const;
+
+private:
+	domain::gridmap* map_;
+	uint32_t shift_;
+	// row of each padded id, and padded id of each row
+	std::vector<uint32_t> index_;
+	std::vector<pad_id> cells_;
+	std::vector<gb_rect> rects_;
+	std::chrono::nanoseconds build_time_{0};
+
+	static void*
+	build_worker_(void* params);
+};
+
+} // namespace warthog::goal_bounding
+
+#endif // WARTHOG_GOAL_BOUNDING_GB_BUILDER_H
@@ -0,0 +1,45 @@
+#ifndef WARTHOG_GOAL_BOUNDING_GB_EXPANSION_POLICY_H
+#define WARTHOG_GOAL_BOUNDING_GB_EXPANSION_POLICY_H
+
+// goal_bounding/gb_expansion_policy.h
+//
+// An ExpansionPolicy for octile gridmaps with goal bounding. Moves are
+// generated as in gridmap_expansion_policy, except that a move is skipped
+// if its rectangle in a gb_table does not contain the target. Every
+// remaining successor is on some optimal path to the target, so searches
+// stay optimal and expand far fewer nodes; with an exact table, A*
+// expands little more than the cells on optimal paths.
+//
+// @created: 2026-10-19
+//
+
+#include "gb_table.h"
+#include <warthog/search/gridmap_expansion_policy.h>
+
+namespace warthog::goal_bounding
+{
+
+class gb_expansion_policy : public search::gridmap_expansion_policy
+{
+public:
+	gb_expansion_policy(domain::gridmap* map, gb_table* table);
+
+	void
+	expand(search::search_node*, search::search_problem_instance*) override;
+
+	search::search_node*
+	generate_start_node(search::search_problem_instance* pi) override;
+
+	size_t
+	mem() override;
+
+private:
+	gb_table* table_;
+	// quantised coordinates of the current target
+	uint32_t target_x_ = 0;
+	uint32_t target_y_ = 0;
+};
+
+} // namespace warthog::goal_bounding
+
+#endif // WARTHOG_GOAL_BOUNDING_GB_EXPANSION_POLICY_H
@@ -0,0 +1,174 @@
+#ifndef WARTHOG_GOAL_BOUNDING_GB_TABLE_H
+#define WARTHOG_GOAL_BOUNDING_GB_TABLE_H
+
+// goal_bounding/gb_table.h
+//
+// Goal bounding tables (Rabin and Sturtevant, 2016) for gridmaps. For
+// every traversable cell and every move out of it, the table stores a
+// geometry::rectangle bounding every target that an optimal path from the
+// cell can reach by starting with that move. A search towards some target
+// can skip every move whose rectangle does not contain it (see
+// gb_expansion_policy).
+//
+// Rectangles are quantised to 16-bit coordinates: a coordinate c is stored
+// as c >> shift, where shift is the smallest value that fits the padded
+// map into 16 bits (0 for maps up to 65535 cells wide). Stored rectangles
+// round outwards, so quantisation can only weaken pruning. A move with no
+// targets has an empty rectangle (x1 > x2).
+//
+// The table is built offline by gb_builder and is read in place, from a
+// memory mapped file. The file layout is:
+//
+//   gb_header
+//   uint32_t index[width * height]     row of each padded cell id
+//                                      (::NO_INDEX for obstacles)
+//   gb_rect rect[num_nodes][8]         one rectangle per move, in the
+//                                      order gridmap_expansion_policy
+//                                      generates them: N, E, S, W, NE, SE,
+//                                      SW, NW
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/domain/gridmap.h>
+#include <warthog/geometry/geom.h>
+#include <warthog/util/mmap_file.h>
+
+#include <cstdint>
+
+namespace warthog::goal_bounding
+{
+
+constexpr uint32_t GB_MAGIC   = 0x54424757; // "WGBT"
+constexpr uint32_t GB_VERSION = 1;
+constexpr uint32_t NUM_MOVES  = 8;
+constexpr uint32_t NO_INDEX   = UINT32_MAX;
+
+struct gb_header
+{
+	uint32_t magic_;
+	uint32_t version_;
+	// padded dimensions of the map
+	uint32_t width_;
+	uint32_t height_;
+	// number of traversable cells
+	uint32_t num_nodes_;
+	// quantisation of coordinates; see above
+	uint32_t shift_;
+	// see domain::gridmap::signature
+	uint64_t signature_;
+};
+static_assert(sizeof(gb_header) == 32);
+
+struct gb_rect
+{
+	uint16_t x1, y1, x2, y2;
+
+	bool
+	contains(uint32_t x, uint32_t y) const
+	{
+		return x >= x1 && x <= x2 && y >= y1 && y <= y2;
+	}
+};
+static_assert(sizeof(gb_rect) == 8);
+
+// the smallest shift which fits every coordinate of a map with padded
+// dimensions @param width and @param height into 16 bits
+inline uint32_t
+gb_shift(uint32_t width, uint32_t height)
+{
+	uint32_t max   = (width > height ? width : height) - 1;
+	uint32_t shift = 0;
+	while((max >> shift) > UINT16_MAX) { shift++; }
+	return shift;
+}
+
+// quantise @param r with @param shift; an empty rectangle stays empty
+inline gb_rect
+gb_quantise(geometry::rectangle& r, uint32_t shift)
+{
+	if(!r.is_valid()) { return gb_rect{UINT16_MAX, UINT16_MAX, 0, 0}; }
+	return gb_rect{
+	    uint16_t(r.x1 >> shift), uint16_t(r.y1 >> shift),
+	    uint16_t(r.x2 >> shift), uint16_t(r.y2 >> shift)};
+}
+
+// the byte offsets of each section of a table file
+struct gb_layout
+{
+	gb_layout(uint32_t width, uint32_t height, uint32_t num_nodes)
+	{
+		index_ = sizeof(gb_header);
+		rect_  = index_ + size_t{width} * height * sizeof(uint32_t);
+		size_  = rect_ + size_t{num_nodes} * NUM_MOVES * sizeof(gb_rect);
+	}
+
+	size_t index_;
+	size_t rect_;
+	size_t size_;
+};
+
+class gb_table
+{
+public:
+	gb_table() = default;
+
+	gb_table(const gb_table&) = delete;
+	gb_table&
+	operator=(const gb_table&)
+	    = delete;
+
+	// map the table in @param filename. fails if the file is not a table
+	// for @param map.
+	// @return false on failure
+	bool
+	load(const char* filename, const domain::gridmap& map);
+
+	bool
+	is_loaded() const
+	{
+		return header_ != nullptr;
+	}
+
+	uint32_t
+	get_num_nodes() const
+	{
+		return header_->num_nodes_;
+	}
+
+	uint32_t
+	get_shift() const
+	{
+		return header_->shift_;
+	}
+
+	// the rectangles of the moves out of the traversable padded id
+	// @param id
+	const gb_rect*
+	get_rects(pad_id id) const
+	{
+		return rect_ + size_t{index_[uint32_t(id.id)]} * NUM_MOVES;
+	}
+
+	size_t
+	file_size() const
+	{
+		return file_.size();
+	}
+
+	size_t
+	mem() const
+	{
+		return sizeof(*this);
+	}
+
+private:
+	util::mmap_file file_;
+	const gb_header* header_ = nullptr;
+	const uint32_t* index_   = nullptr;
+	const gb_rect* rect_     = nullptr;
+};
+
+} // namespace warthog::goal_bounding
+
+#endif // WARTHOG_GOAL_BOUNDING_GB_TABLE_H
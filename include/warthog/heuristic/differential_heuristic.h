@@ -0,0 +1,239 @@
+#ifndef WARTHOG_HEURISTIC_DIFFERENTIAL_HEURISTIC_H
+#define WARTHOG_HEURISTIC_DIFFERENTIAL_HEURISTIC_H
+
+// heuristic/differential_heuristic.h
+//
+// A differential heuristic (Sturtevant et al., 2009) for gridmaps, also
+// known as ALT landmarks (Goldberg and Harrelson, 2005). The exact distance
+// from each of K pivot cells to every cell is precomputed (see
+// differential_heuristic_builder); by the triangle inequality
+//
+//   d(a, b) >= |d(p, a) - d(p, b)|
+//
+// for every pivot p. The heuristic is the largest of these bounds,
+// together with the octile distance. Unlike octile_heuristic it accounts
+// for obstacles, so it is much better informed on mazes and indoor maps.
+//
+// With exact distances each bound is consistent, and so is their maximum.
+// Quantisation rounds each bound down by up to two quanta, by different
+// amounts at neighbouring cells, so the heuristic stays admissible but
+// can break consistency by that much. A node can then be reached more
+// cheaply after it is expanded; searches which must return optimal costs
+// should reopen closed nodes (reopen_policy::yes).
+//
+// Distances are quantised to 16 bits: each is stored as floor(d / q),
+// with one quantum q for the whole table. The K values of a cell are
+// contiguous, so the K bounds of a query are computed 8 at a time with
+// SSE2 (on x86-64). The table is memory mapped from a file with layout:
+//
+//   dh_header
+//   uint32_t pivot[stride]                 padded id of each pivot
+//   (zero padding to a multiple of 16 bytes)
+//   uint16_t dist[width * height][stride]  quantised distances
+//
+// where stride is K rounded up to a multiple of 8. Cells a pivot cannot
+// reach, and the padding lanes of each cell, hold ::DH_INF.
+//
+// @created: 2026-10-19
+//
+
+#include "heuristic_value.h"
+#include "octile_heuristic.h"
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/util/intrin.h>
+#include <warthog/util/mmap_file.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace warthog::heuristic
+{
+
+constexpr uint32_t DH_MAGIC   = 0x54484457; // "WDHT"
+constexpr uint32_t DH_VERSION = 1;
+constexpr uint16_t DH_INF     = UINT16_MAX;
+// the number of distances processed at once
+constexpr uint32_t DH_LANES = 8;
+
+struct dh_header
+{
+	uint32_t magic_;
+	uint32_t version_;
+	// padded dimensions of the map
+	uint32_t width_;
+	uint32_t height_;
+	uint32_t num_pivots_;
+	uint32_t stride_;
+	// the distance represented by one unit of a stored value
+	double quantum_;
+	// see domain::gridmap::signature
+	uint64_t signature_;
+};
+static_assert(sizeof(dh_header) == 40);
+
+// the byte offsets of each section of a table file
+struct dh_layout
+{
+	dh_layout(uint32_t width, uint32_t height, uint32_t stride)
+	{
+		pivot_ = sizeof(dh_header);
+		dist_  = pivot_ + size_t{stride} * sizeof(uint32_t);
+		dist_  = (dist_ + 15) & ~size_t{15};
+		size_  = dist_ + size_t{width} * height * stride * sizeof(uint16_t);
+	}
+
+	size_t pivot_;
+	size_t dist_;
+	size_t size_;
+};
+
+class differential_heuristic
+{
+public:
+	differential_heuristic(uint32_t mapwidth, uint32_t mapheight)
+	    : octile_(mapwidth, mapheight)
+	{ }
+
+	differential_heuristic(const differential_heuristic&) = delete;
+	differential_heuristic&
+	operator=(const differential_heuristic&)
+	    = delete;
+
+	// map the table in @param filename. fails if the file is not a table
+	// for @param map; the heuristic is then plain octile distance.
+	// @return false on failure
+	bool
+	load(const char* filename, const domain::gridmap& map)
+	{
+		header_ = nullptr;
+		if(!file_.open(filename)) { return false; }
+		if(file_.size() < sizeof(dh_header)) { return false; }
+
+		const dh_header* header
+		    = reinterpret_cast<const dh_header*>(file_.data());
+		if(header->magic_ != DH_MAGIC || header->version_ != DH_VERSION
+		   || header->width_ != map.width() || header->height_ != map.height()
+		   || header->stride_ % DH_LANES != 0)
+		{
+			return false;
+		}
+		dh_layout layout(header->width_, header->height_, header->stride_);
+		if(file_.size() != layout.size_) { return false; }
+		if(header->signature_ != map.signature()) { return false; }
+
+		const uint8_t* base = file_.data();
+		pivot_   = reinterpret_cast<const uint32_t*>(base + layout.pivot_);
+		dist_    = reinterpret_cast<const uint16_t*>(base + layout.dist_);
+		stride_  = header->stride_;
+		quantum_ = header->quantum_;
+		header_  = header;
+		return true;
+	}
+
+	bool
+	is_loaded() const
+	{
+		return header_ != nullptr;
+	}
+
+	double
+	h(sn_id_t id, sn_id_t id2)
+	{
+		double octile = octile_.h(id, id2);
+		if(!header_) { return octile; }
+
+		uint32_t diff = max_difference_(
+		    dist_ + size_t{uint32_t(id)} * stride_,
+		    dist_ + size_t{uint32_t(id2)} * stride_);
+		// each stored value is rounded down by less than one quantum
+		double dh = diff > 1 ? (diff - 1) * quantum_ : 0;
+		return std::max(octile, dh);
+	}
+
+	void
+	h(heuristic_value* hv)
+	{
+		hv->lb_ = h(hv->from_, hv->to_);
+	}
+
+	uint32_t
+	get_num_pivots() const
+	{
+		return header_ ? header_->num_pivots_ : 0;
+	}
+
+	// the padded id of pivot @param index
+	pad_id
+	get_pivot(uint32_t index) const
+	{
+		return pad_id{pivot_[index]};
+	}
+
+	size_t
+	file_size() const
+	{
+		return file_.size();
+	}
+
+	size_t
+	mem()
+	{
+		return sizeof(*this);
+	}
+
+private:
+	octile_heuristic octile_;
+	util::mmap_file file_;
+	const dh_header* header_ = nullptr;
+	const uint32_t* pivot_   = nullptr;
+	const uint16_t* dist_    = nullptr;
+	uint32_t stride_         = 0;
+	double quantum_          = 0;
+
+	// max over all pivots p of |a[p] - b[p]|, ignoring pivots which
+	// cannot reach a or b
+	uint32_t
+	max_difference_(const uint16_t* a, const uint16_t* b) const
+	{
+#ifdef WARTHOG_INTRIN
+		// SSE2 is part of x86-64; rows are 16-byte aligned.
+		// unsigned max: max(x, y) = (x -sat y) + y
+		auto max_epu16 = [](__m128i x, __m128i y) {
+			return _mm_add_epi16(_mm_subs_epu16(x, y), y);
+		};
+		const __m128i inf = _mm_set1_epi16(int16_t(DH_INF));
+		__m128i best      = _mm_setzero_si128();
+		for(uint32_t i = 0; i < stride_; i += DH_LANES)
+		{
+			__m128i va
+			    = _mm_load_si128(reinterpret_cast<const __m128i*>(a + i));
+			__m128i vb
+			    = _mm_load_si128(reinterpret_cast<const __m128i*>(b + i));
+			__m128i diff = _mm_or_si128(
+			    _mm_subs_epu16(va, vb), _mm_subs_epu16(vb, va));
+			__m128i unreached = _mm_or_si128(
+			    _mm_cmpeq_epi16(va, inf), _mm_cmpeq_epi16(vb, inf));
+			best = max_epu16(best, _mm_andnot_si128(unreached, diff));
+		}
+		// horizontal max over the lanes
+		best = max_epu16(best, _mm_srli_si128(best, 8));
+		best = max_epu16(best, _mm_srli_si128(best, 4));
+		best = max_epu16(best, _mm_srli_si128(best, 2));
+		return uint32_t(_mm_cvtsi128_si32(best)) & 0xFFFF;
+#else
+		uint32_t best = 0;
+		for(uint32_t i = 0; i < stride_; i++)
+		{
+			if(a[i] == DH_INF || b[i] == DH_INF) { continue; }
+			uint32_t diff = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+			best          = std::max(best, diff);
+		}
+		return best;
+#endif
+	}
+};
+
+} // namespace warthog::heuristic
+
+#endif // WARTHOG_HEURISTIC_DIFFERENTIAL_HEURISTIC_H
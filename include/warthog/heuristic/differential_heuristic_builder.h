@@ -0,0 +1,90 @@
+#ifndef WARTHOG_HEURISTIC_DIFFERENTIAL_HEURISTIC_BUILDER_H
+#define WARTHOG_HEURISTIC_DIFFERENTIAL_HEURISTIC_BUILDER_H
+
+// heuristic/differential_heuristic_builder.h
+//
+// Offline construction of the distance tables of a differential_heuristic.
+//
+// Pivots are placed with farthest-point selection: the first pivot is the
+// cell farthest from an arbitrary cell, and each further pivot is the cell
+// farthest from all pivots chosen so far. Cells no pivot can reach are the
+// farthest of all, so every connected component receives a pivot before
+// any component receives a second one. Distances from each pivot are
+// computed with a full Dijkstra search over gridmap_expansion_policy.
+//
+// The build takes two passes so that no more than two full-map arrays of
+// doubles are live at once. The first selects the pivots and finds the
+// largest finite distance from any of them, which fixes the quantum of
+// the table. The second runs the Dijkstra search of each pivot again and
+// quantises its distances straight into the 16-bit table that ::save
+// writes out.
+//
+// @created: 2026-10-19
+//
+
+#include "differential_heuristic.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <chrono>
+#include <vector>
+
+namespace warthog::heuristic
+{
+
+class differential_heuristic_builder
+{
+public:
+	differential_heuristic_builder(domain::gridmap* map);
+
+	differential_heuristic_builder(const differential_heuristic_builder&)
+	    = delete;
+	differential_heuristic_builder&
+	operator=(const differential_heuristic_builder&)
+	    = delete;
+
+	// select up to @param num_pivots pivots and compute their quantised
+	// distances.
+	// fewer pivots are selected if the map has fewer traversable cells.
+	void
+	build(uint32_t num_pivots);
+
+	// write the table to @param filename, in the layout described in
+	// heuristic/differential_heuristic.h
+	// @return the number of bytes written, or 0 on failure
+	size_t
+	save(const char* filename) const;
+
+	const std::vector<pad_id>&
+	get_pivots() const
+	{
+		return pivots_;
+	}
+
+	// wallclock time of the last call to ::build
+	std::chrono::nanoseconds
+	get_build_time() const
+	{
+		return build_time_;
+	}
+
+	size_t
+	mem();
+
+private:
+	domain::gridmap* map_;
+	search::gridmap_expansion_policy expander_;
+	std::vector<pad_id> pivots_;
+	// the quantised distances, ::stride_ per padded id, as in the file
+	std::vector<uint16_t> table_;
+	uint32_t stride_ = 0;
+	double quantum_  = 1;
+	std::chrono::nanoseconds build_time_{0};
+
+	void
+	dijkstra_(pad_id source, std::vector<double>& dist);
+};
+
+} // namespace warthog::heuristic
+
+#endif // WARTHOG_HEURISTIC_DIFFERENTIAL_HEURISTIC_BUILDER_H
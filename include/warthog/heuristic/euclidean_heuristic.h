@@ -0,0 +1,80 @@
+#ifndef WARTHOG_HEURISTIC_EUCLIDEAN_HEURISTIC_H
+#define WARTHOG_HEURISTIC_EUCLIDEAN_HEURISTIC_H
+
+// euclidean_heuristic.h
+//
+// Straight-line distance between grid cells. Admissible and consistent for
+// any-angle search (see theta_star), where paths are made of straight
+// segments between cells.
+//
+// @created: 2026-10-19
+//
+
+#include "heuristic_value.h"
+#include <warthog/constants.h>
+#include <warthog/util/helpers.h>
+
+#include <cmath>
+
+namespace warthog::heuristic
+{
+
+class euclidean_heuristic
+{
+public:
+	euclidean_heuristic(uint32_t mapwidth, uint32_t)
+	    : mapwidth_(mapwidth), hscale_(1.0)
+	{ }
+
+	~euclidean_heuristic() { }
+
+	double
+	h(int32_t x, int32_t y, int32_t x2, int32_t y2)
+	{
+		double dx = x - x2;
+		double dy = y - y2;
+		return std::sqrt(dx * dx + dy * dy) * hscale_;
+	}
+
+	double
+	h(sn_id_t id, sn_id_t id2)
+	{
+		int32_t x, x2;
+		int32_t y, y2;
+		warthog::util::index_to_xy((uint32_t)id, mapwidth_, x, y);
+		warthog::util::index_to_xy((uint32_t)id2, mapwidth_, x2, y2);
+		return this->h(x, y, x2, y2);
+	}
+
+	void
+	h(heuristic_value* hv)
+	{
+		hv->lb_ = h(hv->from_, hv->to_);
+	}
+
+	void
+	set_hscale(double hscale)
+	{
+		hscale_ = hscale;
+	}
+
+	double
+	get_hscale()
+	{
+		return hscale_;
+	}
+
+	size_t
+	mem()
+	{
+		return sizeof(*this);
+	}
+
+private:
+	unsigned int mapwidth_;
+	double hscale_;
+};
+
+} // namespace warthog::heuristic
+
+#endif // WARTHOG_HEURISTIC_EUCLIDEAN_HEURISTIC_H
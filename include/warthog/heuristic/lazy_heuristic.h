@@ -0,0 +1,144 @@
+#ifndef WARTHOG_HEURISTIC_LAZY_HEURISTIC_H
+#define WARTHOG_HEURISTIC_LAZY_HEURISTIC_H
+
+// heuristic/lazy_heuristic.h
+//
+// A pair of heuristics for Lazy A*: a cheap one, such as octile distance,
+// and an expensive, better informed one, such as differential_heuristic.
+// ::h gives the cheap bound and ::h_full the larger of the two. With such
+// a heuristic unidirectional_search keys new nodes on ::h, and calls
+// ::h_full only for a node at the top of OPEN; the node goes back into
+// OPEN if its f-value grew. Nodes generated but never expanded never pay
+// for the expensive heuristic.
+//
+// Full values are memoised per target, so a node reopened or generated
+// again, in this search or a later one with the same target, reuses its
+// value; ::h returns the memoised value where there is one. Only lower
+// bounds are combined; upper bounds and feasible paths are not.
+//
+// @created: 2026-10-19
+//
+
+#include "heuristic_value.h"
+#include <warthog/constants.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace warthog::heuristic
+{
+
+template<class HC, class HE>
+class lazy_heuristic
+{
+public:
+	lazy_heuristic(HC* cheap, HE* expensive)
+	    : cheap_(cheap), expensive_(expensive)
+	{ }
+
+	lazy_heuristic(const lazy_heuristic&) = delete;
+	lazy_heuristic&
+	operator=(const lazy_heuristic&)
+	    = delete;
+
+	// the memoised full bound, if there is one, or else the cheap bound
+	void
+	h(heuristic_value* hv)
+	{
+		uint32_t id = select_(hv);
+		if(id < stamp_.size() && stamp_[id] == stamp_now_)
+		{
+			hv->lb_ = value_[id];
+			return;
+		}
+		cheap_->h(hv);
+	}
+
+	// the larger of the two bounds
+	void
+	h_full(heuristic_value* hv)
+	{
+		uint32_t id = select_(hv);
+		if(id >= stamp_.size())
+		{
+			stamp_.resize(id + 1, 0);
+			value_.resize(id + 1);
+		}
+		if(stamp_[id] == stamp_now_)
+		{
+			hits_++;
+			hv->lb_ = value_[id];
+			return;
+		}
+
+		evaluations_++;
+		cheap_->h(hv);
+		cost_t lb = hv->lb_;
+		expensive_->h(hv);
+		hv->lb_    = std::max(lb, hv->lb_);
+		stamp_[id] = stamp_now_;
+		value_[id] = hv->lb_;
+	}
+
+	// forget all memoised values
+	void
+	clear()
+	{
+		target_ = warthog::SN_ID_MAX;
+	}
+
+	// calls to the expensive heuristic, and full bounds found memoised
+	uint64_t
+	get_num_evaluations() const noexcept
+	{
+		return evaluations_;
+	}
+
+	uint64_t
+	get_num_hits() const noexcept
+	{
+		return hits_;
+	}
+
+	size_t
+	mem()
+	{
+		return sizeof(*this) + cheap_->mem() + expensive_->mem()
+		    + stamp_.capacity() * sizeof(uint32_t)
+		    + value_.capacity() * sizeof(cost_t);
+	}
+
+private:
+	HC* cheap_;
+	HE* expensive_;
+
+	// the memoised full bound of each node; valid if its stamp matches
+	std::vector<uint32_t> stamp_;
+	std::vector<cost_t> value_;
+	sn_id_t target_     = warthog::SN_ID_MAX;
+	uint32_t stamp_now_ = 0;
+
+	uint64_t evaluations_ = 0;
+	uint64_t hits_        = 0;
+
+	// start over when the target changes; @return the node of @param hv
+	uint32_t
+	select_(heuristic_value* hv)
+	{
+		if(hv->to_ != target_)
+		{
+			target_ = hv->to_;
+			if(++stamp_now_ == 0)
+			{
+				std::fill(stamp_.begin(), stamp_.end(), 0);
+				stamp_now_ = 1;
+			}
+		}
+		return uint32_t(hv->from_);
+	}
+};
+
+} // namespace warthog::heuristic
+
+#endif // WARTHOG_HEURISTIC_LAZY_HEURISTIC_H
@@ -0,0 +1,62 @@
+#ifndef WARTHOG_HPA_HPA_EXPANSION_POLICY_H
+#define WARTHOG_HPA_HPA_EXPANSION_POLICY_H
+
+// hpa/hpa_expansion_policy.h
+//
+// An ExpansionPolicy for the abstract graph of an hpa_graph. Successors of
+// an abstract node are the other nodes of its cluster, with intra-cluster
+// costs, and the nodes across its transitions.
+//
+// The start and target of a query are usually not abstract nodes. When
+// the start node is generated, the start and target are each connected to
+// the abstract nodes of their cluster (and to each other, if they share a
+// cluster), as in the insertion step of HPA*; the extra edges only live
+// for the current search and the graph itself is left unchanged.
+//
+// @created: 2026-10-19
+//
+
+#include "hpa_graph.h"
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <utility>
+#include <vector>
+
+namespace warthog::hpa
+{
+
+class hpa_expansion_policy : public search::gridmap_expansion_policy_base
+{
+public:
+	hpa_expansion_policy(hpa_graph* graph);
+
+	void
+	expand(search::search_node*, search::search_problem_instance*) override;
+
+	search::search_node*
+	generate_start_node(search::search_problem_instance* pi) override;
+
+	search::search_node*
+	generate_target_node(search::search_problem_instance* pi) override;
+
+	hpa_graph*
+	get_graph() const
+	{
+		return graph_;
+	}
+
+	size_t
+	mem() override;
+
+private:
+	hpa_graph* graph_;
+	pad_id start_  = pad_id::max();
+	pad_id target_ = pad_id::max();
+	// edges from the start, and into the target, for the current search
+	std::vector<std::pair<pad_id, cost_t>> start_edges_;
+	std::vector<std::pair<pad_id, cost_t>> target_edges_;
+};
+
+} // namespace warthog::hpa
+
+#endif // WARTHOG_HPA_HPA_EXPANSION_POLICY_H
@@ -0,0 +1,163 @@
+#ifndef WARTHOG_HPA_HPA_GRAPH_H
+#define WARTHOG_HPA_HPA_GRAPH_H
+
+// hpa/hpa_graph.h
+//
+// The abstract graph of HPA* (Botea, Mueller and Schaeffer, 2004). The
+// gridmap is divided into square clusters of a fixed size. Along the
+// border between two adjacent clusters, every maximal run of cells which
+// is traversable on both sides is an entrance: an entrance narrower than
+// ::MAX_ENTRANCE_WIDTH gets one transition, in its middle, and a wider
+// one gets a transition at each end. Each transition is a pair of
+// abstract nodes, one on either side of the border, joined by an
+// inter-cluster edge of cost 1.
+//
+// Within a cluster, every pair of abstract nodes is joined by an
+// intra-cluster edge whose cost is the length of the shortest path
+// between them that stays inside the cluster; these are computed with
+// Dijkstra searches over gridmap_expansion_policy.
+//
+// Abstract nodes are identified by the padded id of their cell, so grid
+// heuristics apply to the abstract graph unchanged. Changes to the map
+// made through ::set_label rebuild only the clusters they affect.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <utility>
+#include <vector>
+
+namespace warthog::hpa
+{
+
+class hpa_graph
+{
+public:
+	static constexpr uint32_t MAX_ENTRANCE_WIDTH = 6;
+	static constexpr uint32_t NO_INDEX           = UINT32_MAX;
+
+	struct cluster
+	{
+		// unpadded bounds of the cluster
+		uint32_t x_, y_, width_, height_;
+		// padded ids of the abstract nodes in the cluster
+		std::vector<pad_id> nodes_;
+		// intra-cluster costs, nodes_.size() squared; COST_MAX if no path
+		// inside the cluster joins two nodes
+		std::vector<cost_t> dist_;
+		// inter-cluster edges, as (index into nodes_, node across border)
+		std::vector<std::pair<uint32_t, pad_id>> exits_;
+	};
+
+	hpa_graph(domain::gridmap* map, uint32_t cluster_size = 16);
+
+	hpa_graph(const hpa_graph&) = delete;
+	hpa_graph&
+	operator=(const hpa_graph&)
+	    = delete;
+
+	// set the label of the (unpadded) cell @param x, @param y on the map
+	// and rebuild the clusters whose entrances or intra-cluster costs
+	// depend on it
+	void
+	set_label(uint32_t x, uint32_t y, bool label);
+
+	// the cluster containing the padded id @param id
+	uint32_t
+	get_cluster_id(pad_id id) const;
+
+	const cluster&
+	get_cluster(uint32_t cluster_id) const
+	{
+		return clusters_[cluster_id];
+	}
+
+	// the index of @param id among the nodes of its cluster, or ::NO_INDEX
+	// if it is not an abstract node
+	uint32_t
+	get_node_index(pad_id id) const
+	{
+		return node_index_[uint32_t(id.id)];
+	}
+
+	// the cost of the shortest path inside its cluster from the cell
+	// @param id to every abstract node of the cluster, and to
+	// @param other if it is in the same cluster. unreachable nodes are
+	// skipped.
+	void
+	connect(
+	    pad_id id, pad_id other, std::vector<std::pair<pad_id, cost_t>>& out);
+
+	domain::gridmap*
+	get_map() const
+	{
+		return map_;
+	}
+
+	uint32_t
+	get_cluster_size() const
+	{
+		return cluster_size_;
+	}
+
+	uint32_t
+	get_num_clusters() const
+	{
+		return uint32_t(clusters_.size());
+	}
+
+	uint32_t
+	get_num_nodes() const;
+
+	// the number of clusters rebuilt since construction; the initial
+	// build counts each cluster once
+	uint64_t
+	get_num_rebuilds() const
+	{
+		return num_rebuilds_;
+	}
+
+	size_t
+	mem();
+
+private:
+	domain::gridmap* map_;
+	search::gridmap_expansion_policy expander_;
+	uint32_t cluster_size_;
+	uint32_t clusters_wide_;
+	uint32_t clusters_high_;
+	std::vector<cluster> clusters_;
+	// transitions on the east and south border of each cluster, as
+	// offsets along the border (a row for east, a column for south)
+	std::vector<std::vector<uint32_t>> east_;
+	std::vector<std::vector<uint32_t>> south_;
+	std::vector<uint32_t> node_index_;
+	uint64_t num_rebuilds_ = 0;
+
+	// scratch space for searches inside a cluster
+	std::vector<cost_t> local_dist_;
+
+	// is the unpadded cell @param x, @param y traversable?
+	bool
+	traversable_(uint32_t x, uint32_t y) const
+	{
+		return map_->get_label(map_->to_padded_id_from_unpadded(x, y));
+	}
+
+	void
+	build_border_(uint32_t cluster_id, bool east);
+
+	void
+	build_cluster_(uint32_t cluster_id);
+
+	void
+	search_cluster_(const cluster& c, pad_id source);
+};
+
+} // namespace warthog::hpa
+
+#endif // WARTHOG_HPA_HPA_GRAPH_H
@@ -0,0 +1,99 @@
+#ifndef WARTHOG_HPA_HPA_SEARCH_H
+#define WARTHOG_HPA_HPA_SEARCH_H
+
+// hpa/hpa_search.h
+//
+// Hierarchical path-finding A* (HPA*; Botea, Mueller and Schaeffer, 2004).
+// A query is answered in two steps:
+//
+//  1. A* over the abstract graph of an hpa_graph, with the start and
+//     target inserted into their clusters (see hpa_expansion_policy).
+//  2. Refinement: every abstract edge on the path is replaced by a grid
+//     path, found with A* over gridmap_expansion_policy.
+//
+// Long queries search a few abstract nodes per cluster instead of every
+// cell in between, and each refinement search is short. Paths are not
+// always optimal: abstract paths only cross borders at transitions, and
+// refinement only shortens each edge separately.
+//
+// ::get_pathcost stops after step 1; its cost is that of the abstract
+// path, an upper bound on the cost of the refined path.
+//
+// @created: 2026-10-19
+//
+
+#include "hpa_expansion_policy.h"
+#include "hpa_graph.h"
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/search/search_parameters.h>
+#include <warthog/search/solution.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+namespace warthog::hpa
+{
+
+class hpa_search
+{
+public:
+	hpa_search(hpa_graph* graph);
+
+	hpa_search(const hpa_search&) = delete;
+	hpa_search&
+	operator=(const hpa_search&)
+	    = delete;
+
+	void
+	get_path(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	void
+	get_pathcost(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	// the grid expander used for refinement
+	search::gridmap_expansion_policy*
+	get_expander()
+	{
+		return &refine_expander_;
+	}
+
+	hpa_expansion_policy*
+	get_abstract_expander()
+	{
+		return &abstract_expander_;
+	}
+
+	size_t
+	mem();
+
+private:
+	template<class E>
+	using astar = search::unidirectional_search<
+	    heuristic::octile_heuristic, E, util::pqueue_min,
+	    search::dummy_listener, search::admissibility_criteria::w_admissible,
+	    search::feasibility_criteria::until_cutoff>;
+
+	hpa_graph* graph_;
+	heuristic::octile_heuristic heuristic_;
+	hpa_expansion_policy abstract_expander_;
+	search::gridmap_expansion_policy refine_expander_;
+	util::pqueue_min abstract_open_;
+	util::pqueue_min refine_open_;
+	astar<hpa_expansion_policy> abstract_;
+	astar<search::gridmap_expansion_policy> refine_;
+	search::solution abstract_sol_;
+	search::solution segment_;
+
+	static void
+	add_metrics_(
+	    search::search_metrics& to, const search::search_metrics& from);
+};
+
+} // namespace warthog::hpa
+
+#endif // WARTHOG_HPA_HPA_SEARCH_H
@@ -0,0 +1,178 @@
+#ifndef WARTHOG_RSR_RECT_DECOMPOSITION_H
+#define WARTHOG_RSR_RECT_DECOMPOSITION_H
+
+// rsr/rect_decomposition.h
+//
+// The decomposition of the traversable cells of a gridmap into empty
+// rectangles used by rectangular symmetry reduction (Harabor, Botea and
+// Kilby, 2011); see rsr_expansion_policy.
+//
+// Rectangles are grown greedily, in row-major order of their top-left
+// cells: first as a square, then to the right and then downwards, for as
+// long as the new column or row is traversable and in no other rectangle.
+// No rectangle can then be extended on any side. Rows are tested 64 cells
+// per word, against a bitmap of the cells which are still free.
+//
+// Changes to the map made through ::set_label redo the decomposition only
+// locally: a blocked cell splits its rectangle, and a traversable one is
+// merged with the rectangles next to it. Many changes can fragment the
+// decomposition; ::build starts over.
+//
+// The decomposition is saved alongside the map, as:
+//
+//   rsr_header
+//   rsr_rect rect[num_rects]
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::rsr
+{
+
+constexpr uint32_t RSR_MAGIC   = 0x52535257; // "WRSR"
+constexpr uint32_t RSR_VERSION = 1;
+constexpr uint32_t NO_RECT     = UINT32_MAX;
+
+struct rsr_header
+{
+	uint32_t magic_;
+	uint32_t version_;
+	// padded dimensions of the map
+	uint32_t width_;
+	uint32_t height_;
+	uint32_t num_rects_;
+	uint32_t reserved_;
+	// see domain::gridmap::signature
+	uint64_t signature_;
+};
+static_assert(sizeof(rsr_header) == 32);
+
+// the padded coordinates of the cells at opposite corners, inclusive
+struct rsr_rect
+{
+	uint32_t x1_, y1_, x2_, y2_;
+
+	bool
+	on_perimeter(uint32_t x, uint32_t y) const
+	{
+		return x == x1_ || x == x2_ || y == y1_ || y == y2_;
+	}
+
+	bool
+	in_interior(uint32_t x, uint32_t y) const
+	{
+		return x > x1_ && x < x2_ && y > y1_ && y < y2_;
+	}
+};
+static_assert(sizeof(rsr_rect) == 16);
+
+class rect_decomposition
+{
+public:
+	rect_decomposition(domain::gridmap* map);
+
+	rect_decomposition(const rect_decomposition&) = delete;
+	rect_decomposition&
+	operator=(const rect_decomposition&)
+	    = delete;
+
+	// decompose the whole map
+	void
+	build();
+
+	// write the decomposition to @param filename
+	// @return the number of bytes written, or 0 on failure
+	size_t
+	save(const char* filename) const;
+
+	// read a decomposition saved for the map. fails if @param filename is
+	// not a decomposition of the map in its current state, after which
+	// ::build is needed.
+	// @return false on failure
+	bool
+	load(const char* filename);
+
+	// set the label of the (unpadded) cell @param x, @param y on the map
+	// and redo the decomposition around it
+	void
+	set_label(uint32_t x, uint32_t y, bool label);
+
+	// the rectangle which holds the padded id @param id, or ::NO_RECT if
+	// it is not traversable
+	uint32_t
+	get_rect_id(pad_id id) const
+	{
+		return rect_of_[id.id];
+	}
+
+	const rsr_rect&
+	get_rect(uint32_t rect_id) const
+	{
+		return rects_[rect_id];
+	}
+
+	uint32_t
+	get_num_rects() const
+	{
+		return num_rects_;
+	}
+
+	domain::gridmap*
+	get_map() const
+	{
+		return map_;
+	}
+
+	size_t
+	mem() const;
+
+private:
+	domain::gridmap* map_;
+	uint32_t words_per_row_;
+	uint32_t num_rects_ = 0;
+
+	std::vector<rsr_rect> rects_;
+	// rectangle of each padded id
+	std::vector<uint32_t> rect_of_;
+	// slots of ::rects_ which hold no rectangle
+	std::vector<uint32_t> unused_;
+	// traversable cells not yet in a rectangle, one bit per padded id
+	std::vector<uint64_t> avail_;
+
+	// no rectangles, and every traversable cell available
+	void
+	reset_();
+
+	// are cells [@param x1, @param x2] of padded row @param y available?
+	bool
+	row_avail_(uint32_t y, uint32_t x1, uint32_t x2) const;
+
+	// are cells [@param y1, @param y2] of padded column @param x available?
+	bool
+	col_avail_(uint32_t x, uint32_t y1, uint32_t y2) const;
+
+	// cover the available cells whose rectangles start inside the padded
+	// bounds @param r
+	void
+	decompose_(const rsr_rect& r);
+
+	void
+	add_(const rsr_rect& r);
+
+	// remove rectangle @param rect_id and make its cells available again
+	void
+	release_(uint32_t rect_id);
+
+	void
+	set_avail_(const rsr_rect& r, bool avail);
+};
+
+} // namespace warthog::rsr
+
+#endif // WARTHOG_RSR_RECT_DECOMPOSITION_H
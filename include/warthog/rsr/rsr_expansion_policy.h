@@ -0,0 +1,72 @@
+#ifndef WARTHOG_RSR_RSR_EXPANSION_POLICY_H
+#define WARTHOG_RSR_RSR_EXPANSION_POLICY_H
+
+// rsr/rsr_expansion_policy.h
+//
+// An ExpansionPolicy for octile gridmaps with rectangular symmetry
+// reduction (Harabor, Botea and Kilby, 2011). Inside an empty rectangle of
+// a rect_decomposition every path between two cells of its perimeter is
+// as good as some path which uses only perimeter cells and one macro edge
+// across the rectangle, so the interior is never expanded. From a
+// perimeter cell the successors are:
+//
+//  - its neighbours as in gridmap_expansion_policy, except the interior
+//    cells of its own rectangle;
+//  - for each side of the rectangle it is on, the cells of the opposite
+//    side which it reaches by an octile path with one turn (those within
+//    the diagonal cone towards that side);
+//  - the first perimeter cell reached by moving diagonally into the
+//    rectangle, in each direction;
+//  - the target, if it is inside the rectangle.
+//
+// A start cell in the interior of a rectangle has the cells of the four
+// sides in its cones as successors. Edge costs are octile distances, so
+// A* with octile_heuristic stays optimal. Consecutive cells of a path may
+// be the two ends of a macro edge, joined by any octile path inside
+// their rectangle.
+//
+// @created: 2026-10-19
+//
+
+#include "rect_decomposition.h"
+#include <warthog/search/gridmap_expansion_policy.h>
+
+namespace warthog::rsr
+{
+
+class rsr_expansion_policy : public search::gridmap_expansion_policy_base
+{
+public:
+	rsr_expansion_policy(domain::gridmap* map, rect_decomposition* rects);
+
+	void
+	expand(search::search_node*, search::search_problem_instance*) override;
+
+	search::search_node*
+	generate_start_node(search::search_problem_instance* pi) override;
+
+	search::search_node*
+	generate_target_node(search::search_problem_instance* pi) override;
+
+	size_t
+	mem() override;
+
+private:
+	rect_decomposition* rects_;
+
+	// add the cell at padded (@param x, @param y) with the octile distance
+	// from (@param fx, @param fy) as cost
+	void
+	add_(uint32_t x, uint32_t y, uint32_t fx, uint32_t fy);
+
+	// add the cells of row (or column, if @param vertical) @param line of
+	// @param r within the cone of (@param x, @param y)
+	void
+	add_cone_(
+	    const rsr_rect& r, uint32_t x, uint32_t y, bool vertical,
+	    uint32_t line);
+};
+
+} // namespace warthog::rsr
+
+#endif // WARTHOG_RSR_RSR_EXPANSION_POLICY_H
@@ -0,0 +1,317 @@
+#ifndef WARTHOG_SEARCH_BEAM_SEARCH_H
+#define WARTHOG_SEARCH_BEAM_SEARCH_H
+
+// search/beam_search.h
+//
+// Breadth-first beam search. The search proceeds layer by layer; the
+// successors of every node in the current layer are ranked by f-value and
+// only the best ::beam_width of them form the next layer. Everything else
+// is discarded.
+//
+// A state is admitted to a layer only if no retained layer reached it
+// more cheaply, and the search goes on after the target is reached, for
+// as long as the next layer holds nodes with an f-value below the cost of
+// the path found. A beam wider than any layer thus returns optimal paths
+// when the heuristic is admissible, though after more layers than A*.
+//
+// Memory is O(beam_width * L), for the L layers searched: the retained
+// layers (needed to extract the path) and a table of the cheapest g-value
+// of the states they contain (needed for duplicate detection). L is not
+// bounded by the depth of the path returned: layers go on past the target
+// while their f-values are below its cost, and a state re-admitted with a
+// smaller g-value is stored again in each layer that admits it. There is
+// no node pool and no priority queue; the expansion policy may run without
+// a node pool (see expansion_policy::set_nodes_pool_size).
+//
+// Beam search is neither complete nor optimal. Narrow beams may fail to
+// find a path at all, or find a costlier one than A*.
+//
+// @created: 2026-10-19
+//
+
+#include "problem_instance.h"
+#include "search_node.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/heuristic/heuristic_value.h>
+#include <warthog/util/log.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace warthog::search
+{
+
+// H is a heuristic function
+// E is an expansion policy
+template<class H, class E>
+class beam_search
+{
+public:
+	beam_search(H* heuristic, E* expander, uint32_t beam_width = 128)
+	    : heuristic_(heuristic), expander_(expander), beam_width_(beam_width)
+	{
+		assert(beam_width > 0);
+	}
+
+	beam_search(const beam_search&) = delete;
+	beam_search&
+	operator=(const beam_search&)
+	    = delete;
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		search(&spi, par, sol);
+	}
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		get_path(&spi, par, sol);
+	}
+
+	void
+	get_path(
+	    search_problem_instance* spi, search_parameters* par, solution* sol)
+	{
+		uint32_t index = search(spi, par, sol);
+		if(index == UINT32_MAX) { return; }
+
+		// follow the retained layers back to the start
+		while(true)
+		{
+			sol->path_.push_back(expander_->get_state(nodes_[index].id_));
+			if(nodes_[index].parent_ == UINT32_MAX) { break; }
+			index = nodes_[index].parent_;
+		}
+		std::reverse(sol->path_.begin(), sol->path_.end());
+	}
+
+	void
+	set_beam_width(uint32_t beam_width)
+	{
+		assert(beam_width > 0);
+		beam_width_ = beam_width;
+	}
+
+	uint32_t
+	get_beam_width() const
+	{
+		return beam_width_;
+	}
+
+	E*
+	get_expander()
+	{
+		return expander_;
+	}
+
+	H*
+	get_heuristic()
+	{
+		return heuristic_;
+	}
+
+	// peak memory used by the last search, plus the expansion policy
+	// and the heuristic
+	inline size_t
+	mem()
+	{
+		size_t bytes = peak_bytes_ +
+		    // gridmap size and other stuff needed to expand nodes
+		    expander_->mem() +
+		    // heuristic uses some memory too
+		    heuristic_->mem() +
+		    // misc
+		    sizeof(*this);
+		return bytes;
+	}
+
+private:
+	struct beam_node
+	{
+		pad_id id_;
+		cost_t g_;
+		cost_t f_;
+		uint32_t parent_; // index in nodes_
+	};
+
+	H* heuristic_;
+	E* expander_;
+	uint32_t beam_width_;
+	std::vector<beam_node> nodes_;
+	std::vector<beam_node> candidates_;
+	std::unordered_map<sn_id_t, cost_t> visited_;
+	search_node current_;
+	size_t peak_bytes_ = 0;
+
+	size_t
+	working_bytes_() const
+	{
+		return (nodes_.capacity() + candidates_.capacity())
+		    * sizeof(beam_node)
+		    // estimate of the node and bucket overheads of the hash table
+		    + visited_.size()
+		    * (sizeof(sn_id_t) + sizeof(cost_t) + 2 * sizeof(void*))
+		    + visited_.bucket_count() * sizeof(void*);
+	}
+
+	// @return the index in nodes_ of the target, or UINT32_MAX
+	uint32_t
+	search(search_problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		util::timer mytimer;
+		mytimer.start();
+		nodes_.clear();
+		candidates_.clear();
+		visited_.clear();
+		peak_bytes_ = 0;
+
+		if(pi->start_ == pad_id::max()) { return UINT32_MAX; }
+		search_node* start = expander_->generate_start_node(pi);
+		if(!start) { return UINT32_MAX; }
+
+		visited_[pi->start_.id] = 0;
+		nodes_.push_back({pi->start_, 0, 0, UINT32_MAX});
+		uint32_t target     = pi->start_ == pi->target_ ? 0 : UINT32_MAX;
+		uint32_t layer_from = 0;
+		uint32_t layer_to   = 1;
+
+		while(layer_from != layer_to)
+		{
+			// once the target is reached, only cheaper paths are of use
+			cost_t incumbent
+			    = target == UINT32_MAX ? COST_MAX : nodes_[target].g_;
+
+			// generate every successor of the current layer
+			candidates_.clear();
+			for(uint32_t i = layer_from; i < layer_to; i++)
+			{
+				if(sol->met_.nodes_expanded_
+				   >= par->get_max_expansions_cutoff())
+				{
+					info(
+					    par->verbose_, "expansions cutoff",
+					    sol->met_.nodes_expanded_);
+					break;
+				}
+				beam_node parent = nodes_[i];
+				current_.set_id(parent.id_);
+				current_.init(
+				    pi->instance_id_,
+				    parent.parent_ == UINT32_MAX
+				        ? pad_id::max()
+				        : nodes_[parent.parent_].id_,
+				    parent.g_, parent.f_);
+				expander_->expand(&current_, pi);
+				sol->met_.nodes_expanded_++;
+
+				search_node* n = nullptr;
+				cost_t cost    = 0;
+				for(uint32_t j = 0; j < expander_->get_num_successors(); j++)
+				{
+					expander_->get_successor(j, n, cost);
+					sol->met_.nodes_generated_++;
+					cost_t g  = parent.g_ + cost;
+					auto seen = visited_.find(n->get_id().id);
+					if(seen != visited_.end() && seen->second <= g)
+					{
+						continue;
+					}
+
+					heuristic::heuristic_value hv(n->get_id(), pi->target_);
+					heuristic_->h(&hv);
+					cost_t f = g + hv.lb_ * par->get_w_admissibility();
+					if(f > par->get_max_cost_cutoff() || f >= incumbent)
+					{
+						continue;
+					}
+					candidates_.push_back({n->get_id(), g, f, i});
+				}
+			}
+
+			// drop duplicates, keeping the cheapest copy of each state
+			std::sort(
+			    candidates_.begin(), candidates_.end(),
+			    [](const beam_node& a, const beam_node& b) {
+				    return a.id_.id < b.id_.id
+				        || (a.id_ == b.id_ && a.g_ < b.g_);
+			    });
+			candidates_.erase(
+			    std::unique(
+			        candidates_.begin(), candidates_.end(),
+			        [](const beam_node& a, const beam_node& b) {
+				        return a.id_ == b.id_;
+			        }),
+			    candidates_.end());
+
+			// keep the best beam_width_ successors
+			if(candidates_.size() > beam_width_)
+			{
+				std::nth_element(
+				    candidates_.begin(), candidates_.begin() + beam_width_,
+				    candidates_.end(),
+				    [](const beam_node& a, const beam_node& b) {
+					    return a.f_ < b.f_
+					        || (a.f_ == b.f_ && a.g_ > b.g_);
+				    });
+				candidates_.resize(beam_width_);
+			}
+
+			layer_from = layer_to;
+			for(const beam_node& c : candidates_)
+			{
+				if(c.id_ == pi->target_) { target = (uint32_t)nodes_.size(); }
+				visited_[c.id_.id] = c.g_;
+				nodes_.push_back(c);
+			}
+			layer_to                 = (uint32_t)nodes_.size();
+			sol->met_.nodes_surplus_ = layer_to - layer_from;
+			peak_bytes_              = std::max(peak_bytes_, working_bytes_());
+			trace(
+			    pi->verbose_, "Beam layer; size", layer_to - layer_from,
+			    "retained", nodes_.size());
+
+			sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+			if(sol->met_.time_elapsed_nano_ > par->get_max_time_cutoff())
+			{
+				info(
+				    par->verbose_, "time cutoff",
+				    sol->met_.time_elapsed_nano_.count());
+				break;
+			}
+		}
+
+		if(target != UINT32_MAX)
+		{
+			sol->sum_of_edge_costs_ = nodes_[target].g_;
+			sol->met_.ub_           = nodes_[target].g_;
+		}
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+
+		DO_ON_DEBUG_IF(pi->verbose_)
+		{
+			if(target == UINT32_MAX)
+			{
+				warning(pi->verbose_, "Search failed; no solution found.");
+			}
+			else
+			{
+				user(
+				    pi->verbose_, "Solution found; cost",
+				    sol->sum_of_edge_costs_);
+			}
+		}
+		return target;
+	}
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_BEAM_SEARCH_H
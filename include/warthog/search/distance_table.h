@@ -0,0 +1,161 @@
+#ifndef WARTHOG_SEARCH_DISTANCE_TABLE_H
+#define WARTHOG_SEARCH_DISTANCE_TABLE_H
+
+// search/distance_table.h
+//
+// Many-to-many shortest path costs on an octile gridmap: given sources S
+// and targets T, the |S| x |T| table of costs over the moves of
+// gridmap_expansion_policy.
+//
+// Rather than a search per pair, there is one multi_target_search (mode
+// all) per row of the table, from one source to all of the targets, which
+// stops once every target is expanded. The moves cost the same both ways,
+// so when there are fewer targets than sources the searches run from the
+// targets instead, one per column. Equal roots share a search.
+//
+// The searches are independent jobs, taken from a shared counter until
+// none are left; every worker has its own multi_target_search. The table
+// is meant to be recomputed often, e.g. every tick, so the worker threads
+// are started once and live as long as the table: between queries they
+// sleep on a condition variable, and the calling thread is the first
+// worker.
+//
+// @created: 2026-10-19
+//
+
+#include "multi_target_search.h"
+#include "search_metrics.h"
+#include <warthog/domain/gridmap.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace warthog::search
+{
+
+class distance_table
+{
+public:
+	// @param num_threads workers per query; 0 for one per core
+	distance_table(domain::gridmap* map, uint32_t num_threads = 0);
+	~distance_table();
+
+	distance_table(const distance_table&) = delete;
+	distance_table&
+	operator=(const distance_table&)
+	    = delete;
+
+	// the cost from each of @param sources to each of @param targets, as
+	// unpadded ids; COST_MAX where there is no path
+	void
+	compute(
+	    const std::vector<pack_id>& sources,
+	    const std::vector<pack_id>& targets);
+
+	// the cost from source @param s to target @param t of the last query
+	cost_t
+	get_cost(uint32_t s, uint32_t t) const
+	{
+		return table_[size_t(s) * num_targets_ + t];
+	}
+
+	// the costs of the last query, one row per source
+	const std::vector<cost_t>&
+	get_table() const noexcept
+	{
+		return table_;
+	}
+
+	uint32_t
+	get_num_sources() const noexcept
+	{
+		return num_sources_;
+	}
+
+	uint32_t
+	get_num_targets() const noexcept
+	{
+		return num_targets_;
+	}
+
+	uint32_t
+	get_num_threads() const noexcept
+	{
+		return uint32_t(workers_.size());
+	}
+
+	// the searches of the last query, summed over all workers, and its
+	// wallclock time
+	const search_metrics&
+	get_metrics() const noexcept
+	{
+		return met_;
+	}
+
+	// the expansions made by worker @param thread in the last query
+	uint32_t
+	get_thread_expanded(uint32_t thread) const
+	{
+		return workers_[thread]->met_.nodes_expanded_;
+	}
+
+	size_t
+	mem();
+
+private:
+	struct worker
+	{
+		worker(domain::gridmap* map) : search_(map) { }
+
+		multi_target_search search_;
+		multi_target_instance instance_;
+		search_metrics met_;
+	};
+
+	std::vector<std::unique_ptr<worker>> workers_;
+
+	// the threads of workers 1 and on. a query bumps ::round_ and wakes
+	// them; the first ::num_active_ workers join in, and ::pending_ counts
+	// those yet to finish.
+	std::vector<std::thread> threads_;
+	std::mutex lock_;
+	std::condition_variable wake_;
+	std::condition_variable done_;
+	uint64_t round_      = 0;
+	uint32_t num_active_ = 0;
+	uint32_t pending_    = 0;
+	bool stop_           = false;
+	std::atomic<uint32_t> next_{0};
+	std::vector<cost_t> table_;
+	uint32_t num_sources_ = 0;
+	uint32_t num_targets_ = 0;
+	search_metrics met_;
+
+	// a query searches from each of ::roots_ to all of the other side, and
+	// is transposed into the table if the roots are the targets. ::first_
+	// gives the index of the first root equal to each root.
+	std::vector<pack_id> roots_;
+	std::vector<uint32_t> first_;
+	bool transposed_ = false;
+
+	// the loop of the thread of worker @param i
+	void
+	serve_(uint32_t i);
+
+	// run the searches of the roots with index ::next_ and on
+	void
+	run_(worker& w);
+
+	// store the costs from root @param r
+	void
+	store_(uint32_t r, const multi_target_search& search);
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_DISTANCE_TABLE_H
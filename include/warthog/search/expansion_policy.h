@@ -17,6 +17,8 @@
 #include <warthog/memory/arraylist.h>
 #include <warthog/memory/node_pool.h>
 
+#include <array>
+#include <cassert>
 #include <vector>
 
 namespace warthog::search
@@ -33,15 +35,17 @@ public:
 	{
 		return nodes_pool_size_;
 	}
+	// (re)allocate the node pool. a size of 0 releases the pool; the
+	// policy then hands out transient nodes instead (see ::generate).
 	void
 	set_nodes_pool_size(size_t nodes_pool_size)
 	{
 		free();
+		neis_ = new memory::arraylist<neighbour_record>(32);
 		if(nodes_pool_size != 0)
 		{
 			nodes_pool_size_ = nodes_pool_size;
 			nodepool_        = new memory::node_pool(nodes_pool_size);
-			neis_            = new memory::arraylist<neighbour_record>(32);
 		}
 	}
 
@@ -55,7 +59,8 @@ public:
 	inline void
 	reset()
 	{
-		current_ = 0;
+		current_        = 0;
+		transient_next_ = 0;
 		if(neis_) neis_->clear();
 	}
 
@@ -63,15 +68,11 @@ public:
 	free()
 	{
 		reset();
-		if(neis_)
-		{
-			assert(nodepool_ != nullptr);
-			delete neis_;
-			delete nodepool_;
-			neis_            = nullptr;
-			nodepool_        = nullptr;
-			nodes_pool_size_ = 0;
-		}
+		delete neis_;
+		delete nodepool_;
+		neis_            = nullptr;
+		nodepool_        = nullptr;
+		nodes_pool_size_ = 0;
 	}
 
 	inline void
@@ -131,7 +132,7 @@ public:
 	mem()
 	{
 		return sizeof(*this) + sizeof(neighbour_record) * neis_->capacity()
-		    + nodepool_->mem();
+		    + (nodepool_ ? nodepool_->mem() : 0);
 	}
 
 	// the expand function is responsible for generating the
@@ -200,10 +201,32 @@ public:
 
 	// get a search_node memory pointer associated with @param node_id.
 	// (value is null if @param node_id is bigger than nodes_pool_size_)
+	//
+	// without a node pool the returned node is transient: only its id is
+	// meaningful, and its memory is one of TRANSIENT_NODES slots used in
+	// turn. ::reset, which every policy calls at the start of ::expand,
+	// starts again from the first slot, so the successors of an expansion
+	// stay valid until the next expansion as long as there are at most
+	// TRANSIENT_NODES of them; nodes from ::generate_start_node and
+	// ::generate_target_node are recycled by the next expansion. this mode
+	// suits searches which keep their own per-state data (e.g. ida_star,
+	// fringe_search) and never write to search nodes.
 	inline search_node*
 	generate(pad_id node_id)
 	{
-		return nodepool_->generate(node_id);
+		if(nodepool_) [[likely]] { return nodepool_->generate(node_id); }
+		search_node* n
+		    = &transient_[transient_next_++ & (TRANSIENT_NODES - 1)];
+		n->set_id(node_id);
+		return n;
+	}
+
+	// true if the policy generates nodes from a node pool; false if
+	// ::generate returns transient nodes
+	bool
+	has_nodes_pool() const
+	{
+		return nodepool_ != nullptr;
 	}
 
 	// get the search_node memory pointer associated with @param node_id
@@ -212,6 +235,7 @@ public:
 	search_node*
 	get_ptr(pad_id node_id, uint32_t search_number)
 	{
+		if(!nodepool_) { return 0; }
 		search_node* tmp = nodepool_->get_ptr(node_id);
 		if(tmp && tmp->get_search_number() == search_number) { return tmp; }
 		return 0;
@@ -221,6 +245,8 @@ protected:
 	inline void
 	add_neighbour(search_node* nei, double cost)
 	{
+		// transient successors beyond this would overwrite earlier ones
+		assert(nodepool_ || neis_->size() < TRANSIENT_NODES);
 		neis_->push_back(neighbour_record(nei, cost));
 		// std::cout << " neis_.size() == " << neis_->size() << std::endl;
 	}
@@ -244,11 +270,17 @@ private:
 		double cost_;
 	};
 
+	// scratch nodes used in place of the node pool; must be a power of two
+	// and larger than the branching factor of any policy
+	static constexpr uint32_t TRANSIENT_NODES = 32;
+
 	memory::node_pool* nodepool_ = nullptr;
 	// std::vector<neighbour_record>* neis_;
 	memory::arraylist<neighbour_record>* neis_ = nullptr;
 	uint32_t current_                          = 0;
 	size_t nodes_pool_size_                    = 0;
+	std::array<search_node, TRANSIENT_NODES> transient_;
+	uint32_t transient_next_ = 0;
 };
 
 } // namespace warthog::search
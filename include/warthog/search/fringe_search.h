@@ -0,0 +1,310 @@
+#ifndef WARTHOG_SEARCH_FRINGE_SEARCH_H
+#define WARTHOG_SEARCH_FRINGE_SEARCH_H
+
+// search/fringe_search.h
+//
+// Fringe Search (Bjornsson, Enzenberger, Holte and Schaeffer, 2005).
+// Like IDA* the search proceeds in f-cost threshold iterations, but the
+// frontier of each iteration is kept, so the next iteration resumes from
+// it instead of starting again from the root.
+//
+// There is no priority queue. The fringe is split in two lists: "now"
+// holds the nodes still to be visited under the current threshold and
+// "later" collects the nodes whose f-cost exceeded it. When "now" is
+// empty the lists are swapped and the threshold is raised to the smallest
+// f-cost seen in "later". Nodes are appended and removed at the back of
+// each list, never sorted.
+//
+// The g-value, parent and heuristic value of every visited state are kept
+// in a hash table keyed by state id, so memory is proportional to the
+// fringe plus the visited region rather than to the size of the map.
+// A node re-added with a better g-value invalidates its stale fringe
+// entries lazily, by stamp. Successors are generated with any
+// expansion_policy, which may run without a node pool
+// (see expansion_policy::set_nodes_pool_size).
+//
+// @created: 2026-10-19
+//
+
+#include "problem_instance.h"
+#include "search_node.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/heuristic/heuristic_value.h>
+#include <warthog/util/log.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace warthog::search
+{
+
+// H is a heuristic function
+// E is an expansion policy
+template<class H, class E>
+class fringe_search
+{
+public:
+	fringe_search(H* heuristic, E* expander)
+	    : heuristic_(heuristic), expander_(expander)
+	{ }
+
+	fringe_search(const fringe_search&) = delete;
+	fringe_search&
+	operator=(const fringe_search&)
+	    = delete;
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		search(&spi, par, sol);
+	}
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		get_path(&spi, par, sol);
+	}
+
+	void
+	get_path(
+	    search_problem_instance* spi, search_parameters* par, solution* sol)
+	{
+		if(!search(spi, par, sol)) { return; }
+
+		// follow backpointers from the target to the start
+		pad_id current = spi->target_;
+		while(true)
+		{
+			sol->path_.push_back(expander_->get_state(current));
+			pad_id parent = cache_.find(current.id)->second.parent_;
+			if(parent == pad_id::max()) { break; }
+			current = parent;
+		}
+		std::reverse(sol->path_.begin(), sol->path_.end());
+	}
+
+	E*
+	get_expander()
+	{
+		return expander_;
+	}
+
+	H*
+	get_heuristic()
+	{
+		return heuristic_;
+	}
+
+	// number of threshold iterations performed by the last search
+	uint32_t
+	get_iterations() const
+	{
+		return iterations_;
+	}
+
+	inline size_t
+	mem()
+	{
+		size_t bytes =
+		    // the two fringe lists
+		    (now_.capacity() + later_.capacity()) * sizeof(fringe_entry) +
+		    // the table of visited states; an estimate of the node and
+		    // bucket overheads of std::unordered_map
+		    cache_.size() * (sizeof(cache_entry) + 2 * sizeof(void*))
+		    + cache_.bucket_count() * sizeof(void*) +
+		    // gridmap size and other stuff needed to expand nodes
+		    expander_->mem() +
+		    // heuristic uses some memory too
+		    heuristic_->mem() +
+		    // misc
+		    sizeof(*this);
+		return bytes;
+	}
+
+private:
+	struct cache_entry
+	{
+		cost_t g_;
+		cost_t h_;
+		pad_id parent_;
+		uint32_t stamp_;
+	};
+
+	struct fringe_entry
+	{
+		pad_id id_;
+		uint32_t stamp_;
+	};
+
+	H* heuristic_;
+	E* expander_;
+	std::vector<fringe_entry> now_;
+	std::vector<fringe_entry> later_;
+	std::unordered_map<sn_id_t, cache_entry> cache_;
+	search_node current_;
+	uint32_t iterations_ = 0;
+
+	cost_t
+	h_value_(pad_id id, pad_id target, search_parameters* par)
+	{
+		heuristic::heuristic_value hv(id, target);
+		heuristic_->h(&hv);
+		return hv.lb_ * par->get_w_admissibility();
+	}
+
+	// @return true if a path to the target was found
+	bool
+	search(search_problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		util::timer mytimer;
+		mytimer.start();
+		now_.clear();
+		later_.clear();
+		cache_.clear();
+		iterations_ = 0;
+
+		if(pi->start_ == pad_id::max()) { return false; }
+		search_node* start = expander_->generate_start_node(pi);
+		if(!start) { return false; }
+
+		cost_t h_start = h_value_(pi->start_, pi->target_, par);
+		cache_[pi->start_.id] = {0, h_start, pad_id::max(), 0};
+		now_.push_back({pi->start_, 0});
+		cost_t threshold = h_start;
+		cost_t fmin      = warthog::COST_MAX;
+		iterations_      = 1;
+		sol->met_.lb_    = threshold;
+
+		bool found = false;
+		while(!found)
+		{
+			if(now_.empty())
+			{
+				// every node left is beyond the threshold; raise it
+				if(later_.empty() || fmin == warthog::COST_MAX) { break; }
+				if(fmin > par->get_max_cost_cutoff())
+				{
+					info(
+					    par->verbose_, "cost cutoff", fmin, ">",
+					    par->get_max_cost_cutoff());
+					break;
+				}
+				std::swap(now_, later_);
+				std::reverse(now_.begin(), now_.end());
+				threshold     = fmin;
+				fmin          = warthog::COST_MAX;
+				sol->met_.lb_ = threshold;
+				iterations_++;
+				trace(pi->verbose_, "Fringe iteration; threshold", threshold);
+				continue;
+			}
+
+			fringe_entry fe = now_.back();
+			now_.pop_back();
+			cache_entry& ce = cache_.find(fe.id_.id)->second;
+			if(ce.stamp_ != fe.stamp_) { continue; } // stale entry
+
+			cost_t f = ce.g_ + ce.h_;
+			if(f > threshold)
+			{
+				fmin = std::min(fmin, f);
+				later_.push_back(fe);
+				continue;
+			}
+
+			if(fe.id_ == pi->target_)
+			{
+				found = true;
+				break;
+			}
+
+			if(sol->met_.nodes_expanded_ >= par->get_max_expansions_cutoff())
+			{
+				info(
+				    par->verbose_, "expansions cutoff",
+				    sol->met_.nodes_expanded_);
+				break;
+			}
+
+			// expand; the entry is invalidated (stamped) so that it is not
+			// visited again unless it is reached with a smaller g-value
+			cost_t g = ce.g_;
+			ce.stamp_++;
+			current_.set_id(fe.id_);
+			current_.init(pi->instance_id_, ce.parent_, g, f);
+			expander_->expand(&current_, pi);
+			sol->met_.nodes_expanded_++;
+			trace(pi->verbose_, "Expanding:", fe.id_.id, "g", g, "f", f);
+
+			// push successors in reverse so the first is visited first
+			search_node* n = nullptr;
+			cost_t cost    = 0;
+			for(uint32_t i = expander_->get_num_successors(); i-- > 0;)
+			{
+				expander_->get_successor(i, n, cost);
+				sol->met_.nodes_generated_++;
+				cost_t gval = g + cost;
+				pad_id id   = n->get_id();
+
+				auto [it, inserted] = cache_.try_emplace(
+				    id.id, cache_entry{gval, 0, fe.id_, 0});
+				if(inserted) { it->second.h_ = h_value_(id, pi->target_, par); }
+				else if(gval < it->second.g_)
+				{
+					it->second.g_      = gval;
+					it->second.parent_ = fe.id_;
+					it->second.stamp_++;
+					sol->met_.nodes_reopen_++;
+				}
+				else { continue; }
+				now_.push_back({id, it->second.stamp_});
+			}
+
+			if((sol->met_.nodes_expanded_ & 1023) == 0)
+			{
+				sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+				if(sol->met_.time_elapsed_nano_ > par->get_max_time_cutoff())
+				{
+					info(
+					    par->verbose_, "time cutoff",
+					    sol->met_.time_elapsed_nano_.count());
+					break;
+				}
+			}
+		}
+
+		if(found)
+		{
+			sol->sum_of_edge_costs_ = cache_.find(pi->target_.id)->second.g_;
+			sol->met_.ub_           = sol->sum_of_edge_costs_;
+		}
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		sol->met_.nodes_surplus_
+		    = static_cast<uint32_t>(now_.size() + later_.size());
+
+		DO_ON_DEBUG_IF(pi->verbose_)
+		{
+			if(!found)
+			{
+				warning(pi->verbose_, "Search failed; no solution exists.");
+			}
+			else
+			{
+				user(
+				    pi->verbose_, "Solution found; cost",
+				    sol->sum_of_edge_costs_, "iterations", iterations_);
+			}
+		}
+		return found;
+	}
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_FRINGE_SEARCH_H
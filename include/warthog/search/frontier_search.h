@@ -0,0 +1,428 @@
+#ifndef WARTHOG_SEARCH_FRONTIER_SEARCH_H
+#define WARTHOG_SEARCH_FRONTIER_SEARCH_H
+
+// search/frontier_search.h
+//
+// Divide-and-conquer frontier A* (Korf, Zhang, Thayer and Hohwald, 2005).
+//
+// Frontier search keeps the OPEN list only; there is no CLOSED list and
+// expanded nodes are deleted. Every open node records which of its
+// neighbours have already been expanded ("used operators"), so that the
+// search never steps back into the interior of the explored region. Memory
+// is therefore proportional to the size of the frontier rather than to the
+// size of the explored region.
+//
+// Without a CLOSED list the path cannot be read from backpointers. Instead
+// every open node carries the "relay" node where its path first crossed
+// half the estimated solution cost. When the target is reached, its relay
+// lies on an optimal path; the start-relay and relay-target subproblems are
+// then solved recursively, each with a much smaller frontier.
+//
+// The used-operator bits are indexed by grid direction, so E must be a
+// grid expansion policy (gridmap_expansion_policy,
+// vl_gridmap_expansion_policy) and the graph must be undirected. The
+// heuristic must be consistent. The expansion policy may run without a
+// node pool (see expansion_policy::set_nodes_pool_size).
+//
+// @created: 2026-10-19
+//
+
+#include "problem_instance.h"
+#include "search_node.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/heuristic/heuristic_value.h>
+#include <warthog/util/log.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace warthog::search
+{
+
+// H is a heuristic function
+// E is a grid expansion policy
+template<class H, class E>
+class frontier_search
+{
+public:
+	frontier_search(H* heuristic, E* expander)
+	    : heuristic_(heuristic), expander_(expander)
+	{ }
+
+	frontier_search(const frontier_search&) = delete;
+	frontier_search&
+	operator=(const frontier_search&)
+	    = delete;
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		reset_();
+		search_result r = search(&spi, COST_MAX, par, sol);
+		finish_(r, sol);
+	}
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		get_path(&spi, par, sol);
+	}
+
+	void
+	get_path(
+	    search_problem_instance* spi, search_parameters* par, solution* sol)
+	{
+		reset_();
+		search_result r = search(spi, COST_MAX, par, sol);
+		finish_(r, sol);
+		if(!r.found_) { return; }
+
+		path_.clear();
+		path_.push_back(spi->start_);
+		if(spi->start_ != spi->target_)
+		{
+			if(!reconstruct_(spi, r, par, sol))
+			{
+				// a cutoff was reached during reconstruction
+				sol->path_.clear();
+				return;
+			}
+		}
+		for(pad_id id : path_)
+		{
+			sol->path_.push_back(expander_->get_state(id));
+		}
+		sol->met_.time_elapsed_nano_ = timer_.elapsed_time_nano();
+	}
+
+	E*
+	get_expander()
+	{
+		return expander_;
+	}
+
+	H*
+	get_heuristic()
+	{
+		return heuristic_;
+	}
+
+	// number of frontier searches run by the last query, including those
+	// needed to reconstruct the path
+	uint32_t
+	get_searches() const
+	{
+		return searches_;
+	}
+
+	// peak memory used by the last query, plus the expansion policy and
+	// the heuristic
+	inline size_t
+	mem()
+	{
+		size_t bytes = peak_bytes_ +
+		    // gridmap size and other stuff needed to expand nodes
+		    expander_->mem() +
+		    // heuristic uses some memory too
+		    heuristic_->mem() +
+		    // misc
+		    sizeof(*this);
+		return bytes;
+	}
+
+private:
+	struct open_entry
+	{
+		cost_t g_;
+		cost_t h_;
+		pad_id parent_;
+		pad_id relay_;
+		cost_t relay_g_;
+		uint16_t used_; // one bit per grid direction; see dir_bit_
+	};
+
+	struct heap_entry
+	{
+		cost_t f_;
+		cost_t g_;
+		pad_id id_;
+
+		// min-heap on f, ties broken in favour of larger g
+		bool
+		operator<(const heap_entry& other) const
+		{
+			return f_ > other.f_ || (f_ == other.f_ && g_ < other.g_);
+		}
+	};
+
+	struct search_result
+	{
+		bool found_;
+		cost_t cost_;
+		pad_id parent_; // parent of the target
+		pad_id relay_;
+		cost_t relay_g_;
+		bool exact_; // relay placed using the optimal cost
+	};
+
+	H* heuristic_;
+	E* expander_;
+	std::unordered_map<sn_id_t, open_entry> open_;
+	std::vector<heap_entry> heap_;
+	std::vector<pad_id> path_;
+	search_node current_;
+	util::timer timer_;
+	size_t peak_bytes_   = 0;
+	uint32_t searches_   = 0;
+	bool cutoff_reached_ = false;
+
+	void
+	reset_()
+	{
+		timer_.start();
+		peak_bytes_     = 0;
+		searches_       = 0;
+		cutoff_reached_ = false;
+	}
+
+	void
+	finish_(search_result& r, solution* sol)
+	{
+		if(r.found_)
+		{
+			sol->sum_of_edge_costs_ = r.cost_;
+			sol->met_.ub_           = r.cost_;
+		}
+		sol->met_.time_elapsed_nano_ = timer_.elapsed_time_nano();
+	}
+
+	// the bit identifying the move from @param from to the adjacent cell
+	// @param to; bits are numbered row-major over the 3x3 neighbourhood
+	uint16_t
+	dir_bit_(pad_id from, pad_id to) const
+	{
+		int64_t w  = expander_->get_map()->width();
+		int64_t d  = int64_t(to.id) - int64_t(from.id);
+		int64_t dy = d < -1 ? -1 : (d > 1 ? 1 : 0);
+		int64_t dx = d - dy * w;
+		assert(dx >= -1 && dx <= 1);
+		return uint16_t(1u << ((dy + 1) * 3 + (dx + 1)));
+	}
+
+	size_t
+	working_bytes_() const
+	{
+		return heap_.capacity() * sizeof(heap_entry)
+		    // estimate of the node and bucket overheads of the hash table
+		    + open_.size()
+		    * (sizeof(sn_id_t) + sizeof(open_entry) + 2 * sizeof(void*))
+		    + open_.bucket_count() * sizeof(void*)
+		    + path_.capacity() * sizeof(pad_id);
+	}
+
+	// solve the subproblems start-relay and relay-target and append the
+	// path, without the start, to path_.
+	// @return false if a cutoff was reached
+	bool
+	reconstruct_(
+	    search_problem_instance* pi, search_result r, search_parameters* par,
+	    solution* sol)
+	{
+		assert(r.found_);
+		if(r.parent_ == pi->start_)
+		{
+			path_.push_back(pi->target_);
+			return true;
+		}
+
+		// a relay placed using the heuristic estimate can be far from the
+		// middle of the path; search again, this time knowing the cost.
+		if(!r.exact_
+		   && (r.relay_ == pi->target_ || r.relay_g_ < r.cost_ / 4
+		       || r.relay_g_ > r.cost_ * 3 / 4))
+		{
+			r = search(pi, r.cost_, par, sol);
+			if(!r.found_) { return false; }
+		}
+
+		// the relay is the target itself only when the last edge crosses
+		// the midpoint; split at the parent of the target instead.
+		pad_id mid   = r.relay_;
+		cost_t mid_g = r.relay_g_;
+		bool tail    = mid == pi->target_;
+		if(tail) { mid = r.parent_; }
+
+		search_problem_instance first(*pi);
+		first.target_ = mid;
+		search_result r1
+		    = search(&first, tail ? COST_MAX : mid_g, par, sol);
+		if(!r1.found_) { return false; }
+		if(!reconstruct_(&first, r1, par, sol)) { return false; }
+		if(tail)
+		{
+			path_.push_back(pi->target_);
+			return true;
+		}
+
+		search_problem_instance second(*pi);
+		second.start_ = mid;
+		search_result r2 = search(&second, r.cost_ - mid_g, par, sol);
+		if(!r2.found_) { return false; }
+		return reconstruct_(&second, r2, par, sol);
+	}
+
+	// frontier A* from pi->start_ to pi->target_. @param cost is the
+	// optimal cost, when known, and COST_MAX otherwise; it determines where
+	// relay nodes are placed.
+	search_result
+	search(
+	    search_problem_instance* pi, cost_t cost, search_parameters* par,
+	    solution* sol)
+	{
+		search_result result{
+		    false, COST_MAX, pad_id::max(), pad_id::max(), COST_MAX,
+		    cost != COST_MAX};
+		if(cutoff_reached_) { return result; }
+		searches_++;
+		open_.clear();
+		heap_.clear();
+
+		if(pi->start_ == pad_id::max()) { return result; }
+		search_node* start = expander_->generate_start_node(pi);
+		if(!start) { return result; }
+
+		cost_t h_start = h_value_(pi->start_, pi->target_, par);
+		// when the cost is not yet known, place relays halfway along the
+		// heuristic estimate; reconstruct_ repeats the search with the true
+		// cost if this puts the relay too close to either end.
+		cost_t relay_at = (cost == COST_MAX ? h_start : cost) / 2;
+
+		open_[pi->start_.id]
+		    = {0, h_start, pad_id::max(), pad_id::max(), COST_MAX, 0};
+		heap_.push_back({h_start, 0, pi->start_});
+		if(cost == COST_MAX) { sol->met_.lb_ = h_start; }
+
+		while(!heap_.empty())
+		{
+			std::pop_heap(heap_.begin(), heap_.end());
+			heap_entry top = heap_.back();
+			heap_.pop_back();
+
+			auto it = open_.find(top.id_.id);
+			if(it == open_.end() || it->second.g_ != top.g_)
+			{
+				continue; // stale
+			}
+			open_entry entry = it->second;
+
+			if(top.id_ == pi->target_)
+			{
+				result.found_   = true;
+				result.cost_    = entry.g_;
+				result.parent_  = entry.parent_;
+				result.relay_   = entry.relay_;
+				result.relay_g_ = entry.relay_g_;
+				break;
+			}
+			if(top.f_ > par->get_max_cost_cutoff())
+			{
+				info(
+				    par->verbose_, "cost cutoff", top.f_, ">",
+				    par->get_max_cost_cutoff());
+				cutoff_reached_ = true;
+				break;
+			}
+			if(sol->met_.nodes_expanded_ >= par->get_max_expansions_cutoff())
+			{
+				info(
+				    par->verbose_, "expansions cutoff",
+				    sol->met_.nodes_expanded_);
+				cutoff_reached_ = true;
+				break;
+			}
+
+			// expand and forget
+			open_.erase(it);
+			current_.set_id(top.id_);
+			current_.init(pi->instance_id_, entry.parent_, entry.g_, top.f_);
+			expander_->expand(&current_, pi);
+			sol->met_.nodes_expanded_++;
+			trace(
+			    pi->verbose_, "Expanding:", top.id_.id, "g", entry.g_, "f",
+			    top.f_);
+
+			search_node* n = nullptr;
+			cost_t edge    = 0;
+			for(uint32_t i = 0; i < expander_->get_num_successors(); i++)
+			{
+				expander_->get_successor(i, n, edge);
+				pad_id id = n->get_id();
+				if(entry.used_ & dir_bit_(top.id_, id)) { continue; }
+				sol->met_.nodes_generated_++;
+
+				cost_t g       = entry.g_ + edge;
+				pad_id relay   = entry.relay_;
+				cost_t relay_g = entry.relay_g_;
+				if(relay == pad_id::max() && g >= relay_at)
+				{
+					relay   = id;
+					relay_g = g;
+				}
+				uint16_t back = dir_bit_(id, top.id_);
+
+				auto [succ, inserted] = open_.try_emplace(
+				    id.id, open_entry{g, 0, top.id_, relay, relay_g, back});
+				open_entry& se = succ->second;
+				if(inserted) { se.h_ = h_value_(id, pi->target_, par); }
+				else
+				{
+					se.used_ |= back;
+					if(g >= se.g_) { continue; }
+					se.g_      = g;
+					se.parent_ = top.id_;
+					se.relay_  = relay;
+					se.relay_g_ = relay_g;
+					sol->met_.nodes_reopen_++;
+				}
+				heap_.push_back({g + se.h_, g, id});
+				std::push_heap(heap_.begin(), heap_.end());
+			}
+
+			if((sol->met_.nodes_expanded_ & 1023) == 0)
+			{
+				peak_bytes_ = std::max(peak_bytes_, working_bytes_());
+				sol->met_.time_elapsed_nano_ = timer_.elapsed_time_nano();
+				if(sol->met_.time_elapsed_nano_ > par->get_max_time_cutoff())
+				{
+					info(
+					    par->verbose_, "time cutoff",
+					    sol->met_.time_elapsed_nano_.count());
+					cutoff_reached_ = true;
+					break;
+				}
+			}
+		}
+		peak_bytes_ = std::max(peak_bytes_, working_bytes_());
+		sol->met_.nodes_surplus_
+		    = std::max(sol->met_.nodes_surplus_, (uint32_t)open_.size());
+		return result;
+	}
+
+	cost_t
+	h_value_(pad_id id, pad_id target, search_parameters* par)
+	{
+		heuristic::heuristic_value hv(id, target);
+		heuristic_->h(&hv);
+		return hv.lb_ * par->get_w_admissibility();
+	}
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_FRONTIER_SEARCH_H
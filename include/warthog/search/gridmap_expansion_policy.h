@@ -23,6 +23,7 @@
 #include "expansion_policy.h"
 #include "problem_instance.h"
 #include "search_node.h"
+#include <warthog/domain/grid_components.h>
 #include <warthog/domain/gridmap.h>
 
 #include <memory>
@@ -66,6 +67,15 @@ public:
 		return map_;
 	}
 
+	// with the components of the map, queries whose start and target are
+	// not connected fail when the start node is generated, without search.
+	// the components must be kept up to date with the map.
+	void
+	set_components(const domain::grid_components* components) noexcept
+	{
+		components_ = components;
+	}
+
 	void
 	print_node(search_node* n, std::ostream& out) override;
 
@@ -73,7 +83,12 @@ public:
 	mem() override;
 
 protected:
-	domain::gridmap* map_ = nullptr;
+	domain::gridmap* map_                       = nullptr;
+	const domain::grid_components* components_ = nullptr;
+
+	// is the target of @param pi known to be unreachable from its start?
+	bool
+	unreachable_(search_problem_instance* pi) const noexcept;
 };
 
 class gridmap_expansion_policy : public gridmap_expansion_policy_base
@@ -95,6 +110,12 @@ public:
 
 protected:
 	bool manhattan_;
+
+	// generate the moves out of @param nodeid which are traversable and
+	// whose bit is set in @param moves; bit i is the i-th move in the order
+	// N, E, S, W, NE, SE, SW, NW
+	void
+	generate_moves_(pad_id nodeid, uint32_t moves);
 };
 
 } // namespace warthog::search
@@ -0,0 +1,582 @@
+#ifndef WARTHOG_SEARCH_HDA_STAR_H
+#define WARTHOG_SEARCH_HDA_STAR_H
+
+// search/hda_star.h
+//
+// Hash Distributed A* (Kishimoto, Fukunaga and Botea, 2009). A parallel A*
+// for single, very large queries.
+//
+// Every state is owned by exactly one worker thread, chosen by hashing its
+// pad_id. Each worker keeps an open list and a table of g-values for the
+// states it owns. Successors owned by another worker are batched and sent
+// through a lock-free single-producer single-consumer queue; there is one
+// queue for every ordered pair of workers. Because workers expand in
+// parallel, states may be expanded before their g-value is optimal and are
+// reopened when a cheaper path arrives.
+//
+// Instead of hashing states, the search can hash fixed-size square blocks
+// of the grid (abstract Zobrist hashing, Jinnai and Fukunaga 2016); see
+// ::set_block_partition. Neighbouring states then usually share an owner,
+// which cuts communication at the cost of a less even load.
+//
+// Termination. Every message is counted in a shared counter when it is
+// sent, and the receiver releases it only once it has no useful work left
+// (its open list holds nothing with f below the incumbent) and every
+// message it generated has been sent. The search has finished when the
+// counter reaches zero; the incumbent is then optimal for an admissible
+// heuristic.
+//
+// Each worker needs its own expansion policy and heuristic. Worker threads
+// are started for every query, so the engine only pays off for queries
+// that take milliseconds or more. The expansion policies may run without
+// a node pool (see expansion_policy::set_nodes_pool_size).
+//
+// @created: 2026-10-19
+//
+
+#include "problem_instance.h"
+#include "search_node.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/heuristic/heuristic_value.h>
+#include <warthog/util/log.h>
+#include <warthog/util/spsc_queue.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace warthog::search
+{
+
+// H is a heuristic function
+// E is an expansion policy
+template<class H, class E>
+class hda_star
+{
+public:
+	// one heuristic and one expansion policy per worker thread
+	hda_star(std::vector<H*> heuristics, std::vector<E*> expanders)
+	{
+		assert(!expanders.empty());
+		assert(heuristics.size() == expanders.size());
+		nworkers_ = static_cast<uint32_t>(expanders.size());
+		for(uint32_t i = 0; i < nworkers_; i++)
+		{
+			workers_.emplace_back(new worker);
+			workers_[i]->heuristic_ = heuristics[i];
+			workers_[i]->expander_  = expanders[i];
+			workers_[i]->outbox_.resize(nworkers_);
+		}
+		for(uint32_t i = 0; i < nworkers_ * nworkers_; i++)
+		{
+			queues_.emplace_back(new util::spsc_queue<message>(QUEUE_SIZE));
+		}
+	}
+
+	hda_star(const hda_star&) = delete;
+	hda_star&
+	operator=(const hda_star&)
+	    = delete;
+
+	// assign states to workers by square blocks of @param block_size cells
+	// rather than by state. @param width and @param height are the
+	// dimensions of the padded grid (gridmap::width, gridmap::height).
+	// a @param block_size of 0 restores hashing by state.
+	void
+	set_block_partition(uint32_t width, uint32_t height, uint32_t block_size)
+	{
+		block_size_ = block_size;
+		width_      = width;
+		zobrist_x_.clear();
+		zobrist_y_.clear();
+		if(block_size == 0) { return; }
+
+		std::mt19937 rng(block_size);
+		for(uint32_t i = 0; i <= width / block_size; i++)
+		{
+			zobrist_x_.push_back(rng());
+		}
+		for(uint32_t i = 0; i <= height / block_size; i++)
+		{
+			zobrist_y_.push_back(rng());
+		}
+	}
+
+	// send messages to other workers every @param batch_size expansions
+	// (at least 1), and whenever a worker runs out of useful work
+	void
+	set_batch_size(uint32_t batch_size)
+	{
+		batch_size_ = std::max<uint32_t>(batch_size, 1);
+	}
+
+	uint32_t
+	get_batch_size() const
+	{
+		return batch_size_;
+	}
+
+	// the expansion policy of the first worker
+	E*
+	get_expander()
+	{
+		return workers_[0]->expander_;
+	}
+
+	H*
+	get_heuristic()
+	{
+		return workers_[0]->heuristic_;
+	}
+
+	uint32_t
+	get_num_threads() const
+	{
+		return nworkers_;
+	}
+
+	// the expansions made by worker @param thread in the last search; the
+	// spread across workers shows how evenly the hashing shares the load
+	uint32_t
+	get_thread_expanded(uint32_t thread) const
+	{
+		return workers_[thread]->expanded_;
+	}
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi
+		    = workers_[0]->expander_->get_problem_instance(pi);
+		search(&spi, par, sol);
+	}
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi
+		    = workers_[0]->expander_->get_problem_instance(pi);
+		get_path(&spi, par, sol);
+	}
+
+	void
+	get_path(
+	    search_problem_instance* spi, search_parameters* par, solution* sol)
+	{
+		if(!search(spi, par, sol)) { return; }
+
+		// backpointers are spread across the tables of all workers
+		E* expander    = workers_[0]->expander_;
+		pad_id current = spi->target_;
+		while(true)
+		{
+			sol->path_.push_back(expander->get_state(current));
+			worker& w       = *workers_[owner_(current)];
+			const record& r = w.records_.find(current.id)->second;
+			if(r.parent_ == pad_id::max()) { break; }
+			current = r.parent_;
+		}
+		std::reverse(sol->path_.begin(), sol->path_.end());
+	}
+
+	inline size_t
+	mem()
+	{
+		size_t bytes = sizeof(*this)
+		    + (zobrist_x_.capacity() + zobrist_y_.capacity())
+		        * sizeof(uint32_t);
+		for(auto& q : queues_) { bytes += q->mem(); }
+		for(auto& w : workers_)
+		{
+			bytes += sizeof(worker)
+			    + w->open_.capacity() * sizeof(heap_entry)
+			    // estimate of the node and bucket overheads of the table
+			    + w->records_.size()
+			        * (sizeof(sn_id_t) + sizeof(record) + 2 * sizeof(void*))
+			    + w->records_.bucket_count() * sizeof(void*)
+			    + w->expander_->mem() + w->heuristic_->mem();
+			for(auto& out : w->outbox_)
+			{
+				bytes += out.capacity() * sizeof(message);
+			}
+		}
+		return bytes;
+	}
+
+private:
+	static constexpr uint32_t QUEUE_SIZE = 4096;
+
+	struct message
+	{
+		pad_id id_;
+		pad_id parent_;
+		cost_t g_;
+	};
+
+	struct record
+	{
+		cost_t g_;
+		cost_t h_;
+		pad_id parent_;
+	};
+
+	struct heap_entry
+	{
+		cost_t f_;
+		cost_t g_;
+		pad_id id_;
+
+		// min-heap on f, ties broken in favour of larger g
+		bool
+		operator<(const heap_entry& other) const
+		{
+			return f_ > other.f_ || (f_ == other.f_ && g_ < other.g_);
+		}
+	};
+
+	struct alignas(64) worker
+	{
+		H* heuristic_;
+		E* expander_;
+		std::unordered_map<sn_id_t, record> records_;
+		std::vector<heap_entry> open_;
+		std::vector<std::vector<message>> outbox_;
+		search_problem_instance pi_{pad_id::max(), pad_id::max()};
+		search_node current_;
+
+		int64_t received_ = 0; // messages not yet released
+		int64_t unsent_   = 0; // messages not yet counted in in_flight_
+		size_t pending_   = 0; // messages still in the outboxes
+		uint32_t expanded_  = 0;
+		uint32_t generated_ = 0;
+		uint32_t reopened_  = 0;
+		uint32_t sent_      = 0;
+		std::chrono::nanoseconds comm_{};
+	};
+
+	uint32_t nworkers_;
+	std::vector<std::unique_ptr<worker>> workers_;
+	// queues_[src * nworkers_ + dst]
+	std::vector<std::unique_ptr<util::spsc_queue<message>>> queues_;
+
+	uint32_t batch_size_ = 64;
+	uint32_t block_size_ = 0;
+	uint32_t width_      = 0;
+	std::vector<uint32_t> zobrist_x_;
+	std::vector<uint32_t> zobrist_y_;
+
+	// shared by the workers during a search
+	search_parameters* par_;
+	util::timer timer_;
+	std::atomic<cost_t> incumbent_;
+	std::atomic<int64_t> in_flight_;
+	std::atomic<uint64_t> expanded_total_;
+	std::atomic<bool> done_;
+	std::atomic<bool> aborted_;
+
+	uint32_t
+	owner_(pad_id id) const
+	{
+		uint64_t key;
+		if(block_size_ == 0) { key = id.id; }
+		else
+		{
+			uint32_t x = uint32_t(id.id % width_) / block_size_;
+			uint32_t y = uint32_t(id.id / width_) / block_size_;
+			key        = zobrist_x_[x] ^ zobrist_y_[y];
+		}
+		// fibonacci hashing
+		return uint32_t(((key * 0x9E3779B97F4A7C15ull) >> 32) % nworkers_);
+	}
+
+	void
+	update_incumbent_(cost_t g)
+	{
+		cost_t best = incumbent_.load(std::memory_order_relaxed);
+		while(g < best
+		      && !incumbent_.compare_exchange_weak(
+		          best, g, std::memory_order_relaxed))
+		{ }
+	}
+
+	// add a state, owned by @param w, reached with cost @param m.g_
+	void
+	integrate_(worker& w, const message& m)
+	{
+		auto [it, inserted]
+		    = w.records_.try_emplace(m.id_.id, record{m.g_, 0, m.parent_});
+		record& r = it->second;
+		if(inserted)
+		{
+			heuristic::heuristic_value hv(m.id_, w.pi_.target_);
+			w.heuristic_->h(&hv);
+			r.h_ = hv.lb_ * par_->get_w_admissibility();
+		}
+		else
+		{
+			if(m.g_ >= r.g_) { return; }
+			r.g_      = m.g_;
+			r.parent_ = m.parent_;
+			w.reopened_++;
+		}
+
+		if(m.id_ == w.pi_.target_)
+		{
+			update_incumbent_(m.g_);
+			return;
+		}
+		w.open_.push_back({m.g_ + r.h_, m.g_, m.id_});
+		std::push_heap(w.open_.begin(), w.open_.end());
+	}
+
+	// @return true if the open list holds a state worth expanding
+	bool
+	has_work_(worker& w)
+	{
+		while(!w.open_.empty())
+		{
+			const heap_entry& top = w.open_.front();
+			if(w.records_.find(top.id_.id)->second.g_ == top.g_)
+			{
+				return top.f_ < incumbent_.load(std::memory_order_relaxed)
+				    && top.f_ <= par_->get_max_cost_cutoff();
+			}
+			std::pop_heap(w.open_.begin(), w.open_.end());
+			w.open_.pop_back(); // stale
+		}
+		return false;
+	}
+
+	void
+	expand_(worker& w, uint32_t t)
+	{
+		std::pop_heap(w.open_.begin(), w.open_.end());
+		heap_entry top = w.open_.back();
+		w.open_.pop_back();
+		pad_id parent = w.records_.find(top.id_.id)->second.parent_;
+
+		w.current_.set_id(top.id_);
+		w.current_.init(w.pi_.instance_id_, parent, top.g_, top.f_);
+		w.expander_->expand(&w.current_, &w.pi_);
+		w.expanded_++;
+
+		search_node* n = nullptr;
+		cost_t cost    = 0;
+		for(uint32_t i = 0; i < w.expander_->get_num_successors(); i++)
+		{
+			w.expander_->get_successor(i, n, cost);
+			w.generated_++;
+			message m{n->get_id(), top.id_, top.g_ + cost};
+			if(m.id_ == parent) { continue; }
+			uint32_t dst = owner_(m.id_);
+			if(dst == t) { integrate_(w, m); }
+			else
+			{
+				w.outbox_[dst].push_back(m);
+				w.unsent_++;
+				w.pending_++;
+			}
+		}
+	}
+
+	// move received messages into the open list
+	void
+	receive_(worker& w, uint32_t t)
+	{
+		message m;
+		for(uint32_t src = 0; src < nworkers_; src++)
+		{
+			util::spsc_queue<message>& q = *queues_[src * nworkers_ + t];
+			if(q.empty()) { continue; }
+			auto start = timer_.get_time();
+			while(q.pop(m))
+			{
+				integrate_(w, m);
+				w.received_++;
+			}
+			w.comm_ += timer_.get_time() - start;
+		}
+	}
+
+	// @return true if every outgoing message was delivered
+	bool
+	send_(worker& w, uint32_t t)
+	{
+		if(w.pending_ == 0) { return true; }
+		auto start = timer_.get_time();
+		if(w.unsent_ != 0)
+		{
+			// count messages before they become visible to the receivers
+			in_flight_.fetch_add(w.unsent_, std::memory_order_acq_rel);
+			w.sent_  += static_cast<uint32_t>(w.unsent_);
+			w.unsent_ = 0;
+		}
+
+		for(uint32_t dst = 0; dst < nworkers_; dst++)
+		{
+			std::vector<message>& out    = w.outbox_[dst];
+			util::spsc_queue<message>& q = *queues_[t * nworkers_ + dst];
+			size_t i                     = 0;
+			while(i < out.size() && q.push(out[i])) { i++; }
+			out.erase(out.begin(), out.begin() + i);
+			w.pending_ -= i;
+		}
+		w.comm_ += timer_.get_time() - start;
+		return w.pending_ == 0;
+	}
+
+	void
+	run_(uint32_t t)
+	{
+		worker& w = *workers_[t];
+		uint32_t since_send = 0;
+		while(!done_.load(std::memory_order_acquire))
+		{
+			receive_(w, t);
+			if(has_work_(w))
+			{
+				expand_(w, t);
+				if(++since_send == batch_size_)
+				{
+					since_send = 0;
+					send_(w, t);
+					expanded_total_.fetch_add(
+					    batch_size_, std::memory_order_relaxed);
+					if(check_cutoffs_()) { break; }
+				}
+				continue;
+			}
+
+			// nothing useful to do: deliver everything, then go idle
+			since_send = 0;
+			if(!send_(w, t))
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			if(w.received_ != 0)
+			{
+				in_flight_.fetch_sub(w.received_, std::memory_order_acq_rel);
+				w.received_ = 0;
+			}
+			if(in_flight_.load(std::memory_order_acquire) == 0)
+			{
+				done_.store(true, std::memory_order_release);
+				break;
+			}
+			std::this_thread::yield();
+		}
+	}
+
+	// @return true if the search must stop
+	bool
+	check_cutoffs_()
+	{
+		if(expanded_total_.load(std::memory_order_relaxed)
+		   >= par_->get_max_expansions_cutoff())
+		{
+			info(par_->verbose_, "expansions cutoff");
+		}
+		else if(timer_.elapsed_time_nano() > par_->get_max_time_cutoff())
+		{
+			info(par_->verbose_, "time cutoff");
+		}
+		else { return false; }
+		aborted_.store(true, std::memory_order_relaxed);
+		done_.store(true, std::memory_order_release);
+		return true;
+	}
+
+	// @return true if a path to the target was found
+	bool
+	search(search_problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		timer_.start();
+		par_ = par;
+		incumbent_.store(COST_MAX);
+		in_flight_.store(0);
+		expanded_total_.store(0);
+		done_.store(false);
+		aborted_.store(false);
+		for(uint32_t i = 0; i < nworkers_; i++)
+		{
+			worker& w = *workers_[i];
+			w.records_.clear();
+			w.open_.clear();
+			for(auto& out : w.outbox_) { out.clear(); }
+			w.pi_       = *pi;
+			w.received_ = 0;
+			w.unsent_   = 0;
+			w.pending_  = 0;
+			w.expanded_ = w.generated_ = w.reopened_ = w.sent_ = 0;
+			w.comm_     = {};
+		}
+		message m;
+		for(auto& q : queues_)
+		{
+			while(q->pop(m)) { }
+		}
+
+		if(pi->start_ == pad_id::max()) { return false; }
+		if(!workers_[0]->expander_->generate_start_node(pi)) { return false; }
+
+		// the start state is the first message; it is released when its
+		// owner first runs out of work
+		in_flight_.store(1);
+		worker& first = *workers_[owner_(pi->start_)];
+		integrate_(first, {pi->start_, pad_id::max(), 0});
+		first.received_ = 1;
+
+		std::vector<std::thread> threads;
+		for(uint32_t i = 1; i < nworkers_; i++)
+		{
+			threads.emplace_back([this, i]() { run_(i); });
+		}
+		run_(0);
+		for(std::thread& th : threads) { th.join(); }
+
+		cost_t cost = incumbent_.load();
+		bool found  = cost != COST_MAX && !aborted_.load();
+		for(uint32_t i = 0; i < nworkers_; i++)
+		{
+			worker& w = *workers_[i];
+			sol->met_.nodes_expanded_  += w.expanded_;
+			sol->met_.nodes_generated_ += w.generated_;
+			sol->met_.nodes_reopen_    += w.reopened_;
+			sol->met_.messages_sent_   += w.sent_;
+			sol->met_.comm_time_nano_  += w.comm_;
+		}
+		if(found)
+		{
+			sol->sum_of_edge_costs_ = cost;
+			sol->met_.ub_           = cost;
+		}
+		sol->met_.time_elapsed_nano_ = timer_.elapsed_time_nano();
+
+		DO_ON_DEBUG_IF(pi->verbose_)
+		{
+			if(!found)
+			{
+				warning(pi->verbose_, "Search failed; no solution exists.");
+			}
+			else
+			{
+				user(
+				    pi->verbose_, "Solution found; cost",
+				    sol->sum_of_edge_costs_, "threads", nworkers_);
+			}
+		}
+		return found;
+	}
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_HDA_STAR_H
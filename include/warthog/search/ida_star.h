@@ -0,0 +1,322 @@
+#ifndef WARTHOG_SEARCH_IDA_STAR_H
+#define WARTHOG_SEARCH_IDA_STAR_H
+
+// search/ida_star.h
+//
+// Iterative-deepening A* (Korf, 1985). A sequence of depth-first searches,
+// each bounded by an f-cost threshold; the threshold of every iteration is
+// the smallest f-cost which exceeded the threshold of the previous one.
+//
+// The search keeps no OPEN or CLOSED list. Its only state is the current
+// path, together with the unexplored successors of every node on that
+// path, so memory is O(depth * branching factor). Successors are
+// generated with any expansion_policy; the search only reads their ids and
+// edge costs, so the policy can run without a node pool
+// (see expansion_policy::set_nodes_pool_size).
+//
+// Duplicate detection is limited to cycle pruning: a successor which is
+// already on the current path is skipped. The ids on the path are kept in
+// a hash set, so the check is O(1) and memory stays O(depth). Each
+// iteration therefore only walks simple paths, and once every simple path
+// from the start stays within the threshold (the target is unreachable)
+// the next threshold is COST_MAX and the search fails. On domains with
+// many transpositions (e.g. grids) IDA* revisits states often; it trades
+// time for a tiny memory footprint.
+//
+// @created: 2026-10-19
+//
+
+#include "problem_instance.h"
+#include "search_node.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/heuristic/heuristic_value.h>
+#include <warthog/util/log.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+namespace warthog::search
+{
+
+// H is a heuristic function
+// E is an expansion policy
+template<class H, class E>
+class ida_star
+{
+public:
+	ida_star(H* heuristic, E* expander)
+	    : heuristic_(heuristic), expander_(expander)
+	{ }
+
+	ida_star(const ida_star&) = delete;
+	ida_star&
+	operator=(const ida_star&)
+	    = delete;
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		search(&spi, par, sol);
+	}
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		get_path(&spi, par, sol);
+	}
+
+	void
+	get_path(
+	    search_problem_instance* spi, search_parameters* par, solution* sol)
+	{
+		if(!search(spi, par, sol)) { return; }
+
+		// the path is the stack of the final iteration
+		for(const frame& f : path_)
+		{
+			sol->path_.push_back(expander_->get_state(f.id_));
+		}
+	}
+
+	E*
+	get_expander()
+	{
+		return expander_;
+	}
+
+	H*
+	get_heuristic()
+	{
+		return heuristic_;
+	}
+
+	// number of threshold iterations performed by the last search
+	uint32_t
+	get_iterations() const
+	{
+		return iterations_;
+	}
+
+	inline size_t
+	mem()
+	{
+		size_t bytes =
+		    // the path and the pending successors of every node on it
+		    path_.capacity() * sizeof(frame)
+		    + succ_.capacity() * sizeof(successor)
+		    + path_ids_.size() * (sizeof(sn_id_t) + 2 * sizeof(void*))
+		    + path_ids_.bucket_count() * sizeof(void*) +
+		    // gridmap size and other stuff needed to expand nodes
+		    expander_->mem() +
+		    // heuristic uses some memory too
+		    heuristic_->mem() +
+		    // misc
+		    sizeof(*this);
+		return bytes;
+	}
+
+private:
+	// a node on the current path; its successors are stored in
+	// succ_[first_, last_) and next_ is the next one to visit
+	struct frame
+	{
+		pad_id id_;
+		cost_t g_;
+		uint32_t first_;
+		uint32_t next_;
+		uint32_t last_;
+	};
+
+	struct successor
+	{
+		pad_id id_;
+		cost_t cost_;
+	};
+
+	H* heuristic_;
+	E* expander_;
+	std::vector<frame> path_;
+	std::vector<successor> succ_;
+	// the ids of the nodes on path_, for cycle pruning
+	std::unordered_set<sn_id_t> path_ids_;
+	search_node current_;
+	uint32_t iterations_ = 0;
+
+	cost_t
+	f_value_(pad_id id, cost_t g, pad_id target, search_parameters* par)
+	{
+		heuristic::heuristic_value hv(id, target);
+		heuristic_->h(&hv);
+		return g + hv.lb_ * par->get_w_admissibility();
+	}
+
+	bool
+	on_path_(pad_id id) const
+	{
+		return path_ids_.count(id.id) != 0;
+	}
+
+	// expand @param id and push it, and its successors, onto the path
+	void
+	push_frame_(
+	    pad_id id, cost_t g, search_problem_instance* pi, solution* sol)
+	{
+		pad_id parent = path_.empty() ? pad_id::max() : path_.back().id_;
+		current_.set_id(id);
+		current_.init(pi->instance_id_, parent, g, g);
+		expander_->expand(&current_, pi);
+		sol->met_.nodes_expanded_++;
+
+		uint32_t first = static_cast<uint32_t>(succ_.size());
+		search_node* n = nullptr;
+		cost_t cost    = 0;
+		for(uint32_t i = 0; i < expander_->get_num_successors(); i++)
+		{
+			expander_->get_successor(i, n, cost);
+			succ_.push_back({n->get_id(), cost});
+		}
+		path_.push_back(
+		    {id, g, first, first, static_cast<uint32_t>(succ_.size())});
+		path_ids_.insert(id.id);
+	}
+
+	// @return true if a path to the target was found
+	bool
+	search(search_problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		util::timer mytimer;
+		mytimer.start();
+		path_.clear();
+		succ_.clear();
+		path_ids_.clear();
+		iterations_ = 0;
+
+		if(pi->start_ == pad_id::max()) { return false; }
+		search_node* start = expander_->generate_start_node(pi);
+		if(!start) { return false; }
+
+		cost_t threshold = f_value_(pi->start_, 0, pi->target_, par);
+		bool found       = false;
+		// one iteration can take exponential time, so the timer is also
+		// checked within it
+		bool timed_out = false;
+		while(!found && threshold != warthog::COST_MAX)
+		{
+			if(threshold > par->get_max_cost_cutoff())
+			{
+				info(
+				    par->verbose_, "cost cutoff", threshold, ">",
+				    par->get_max_cost_cutoff());
+				break;
+			}
+			iterations_++;
+			sol->met_.lb_ = threshold;
+			trace(pi->verbose_, "IDA* iteration; threshold", threshold);
+
+			cost_t next_threshold = warthog::COST_MAX;
+			path_.clear();
+			succ_.clear();
+			path_ids_.clear();
+			if(pi->start_ == pi->target_)
+			{
+				path_.push_back({pi->start_, 0, 0, 0, 0});
+				found = true;
+				break;
+			}
+			push_frame_(pi->start_, 0, pi, sol);
+
+			while(!path_.empty())
+			{
+				frame& top = path_.back();
+				if(top.next_ == top.last_)
+				{
+					succ_.resize(top.first_);
+					path_ids_.erase(top.id_.id);
+					path_.pop_back();
+					continue;
+				}
+
+				successor s = succ_[top.next_++];
+				if(on_path_(s.id_)) { continue; }
+				sol->met_.nodes_generated_++;
+
+				cost_t g = top.g_ + s.cost_;
+				cost_t f = f_value_(s.id_, g, pi->target_, par);
+				if(f > threshold)
+				{
+					next_threshold = std::min(next_threshold, f);
+					continue;
+				}
+
+				if(s.id_ == pi->target_)
+				{
+					path_.push_back({s.id_, g, 0, 0, 0});
+					found = true;
+					break;
+				}
+
+				if(sol->met_.nodes_expanded_
+				   >= par->get_max_expansions_cutoff())
+				{
+					info(
+					    par->verbose_, "expansions cutoff",
+					    sol->met_.nodes_expanded_);
+					next_threshold = warthog::COST_MAX;
+					break;
+				}
+				push_frame_(s.id_, g, pi, sol);
+
+				if((sol->met_.nodes_expanded_ & 1023) == 0
+				   && mytimer.elapsed_time_nano() > par->get_max_time_cutoff())
+				{
+					timed_out = true;
+					break;
+				}
+			}
+
+			sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+			if(timed_out
+			   || sol->met_.time_elapsed_nano_ > par->get_max_time_cutoff())
+			{
+				info(
+				    par->verbose_, "time cutoff",
+				    sol->met_.time_elapsed_nano_.count());
+				break;
+			}
+			if(!found) { threshold = next_threshold; }
+		}
+
+		if(found)
+		{
+			sol->sum_of_edge_costs_ = path_.back().g_;
+			sol->met_.ub_           = path_.back().g_;
+		}
+		else { path_.clear(); }
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+
+		DO_ON_DEBUG_IF(pi->verbose_)
+		{
+			if(!found)
+			{
+				warning(pi->verbose_, "Search failed; no solution exists.");
+			}
+			else
+			{
+				user(
+				    pi->verbose_, "Solution found; cost",
+				    sol->sum_of_edge_costs_, "iterations", iterations_);
+			}
+		}
+		return found;
+	}
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_IDA_STAR_H
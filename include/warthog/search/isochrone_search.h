@@ -0,0 +1,107 @@
+#ifndef WARTHOG_SEARCH_ISOCHRONE_SEARCH_H
+#define WARTHOG_SEARCH_ISOCHRONE_SEARCH_H
+
+// search/isochrone_search.h
+//
+// Cost-bounded reachability on an octile gridmap: every cell whose
+// shortest path from a start, over the moves of gridmap_expansion_policy,
+// costs no more than the max cost cutoff of the search parameters. That
+// is, the cells a search with the cutoff could reach.
+//
+// The query is a Dijkstra search which keeps no parents and builds no
+// paths. Its result is a bittable over padded ids, one bit per cell; a
+// cell's bit is set when it is expanded, which also marks it closed. Only
+// the words set by the last query are cleared, so a small region costs
+// little on a large map.
+//
+// @created: 2026-10-19
+//
+
+#include "gridmap_expansion_policy.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/memory/bittable.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::search
+{
+
+class isochrone_search
+{
+public:
+	using region_table = memory::bittable<pad_id, uint64_t>;
+
+	isochrone_search(domain::gridmap* map);
+
+	isochrone_search(const isochrone_search&) = delete;
+	isochrone_search&
+	operator=(const isochrone_search&)
+	    = delete;
+
+	// the cells within the max cost cutoff of @param par from @param start
+	// (unpadded id). the expansion cutoff of @param par also applies.
+	// @param sol gets the metrics and, as its cost, the largest cost of a
+	// cell in the region.
+	void
+	get_region(pack_id start, search_parameters* par, solution* sol);
+
+	// one bit per padded id; set for the cells of the last region
+	const region_table&
+	get_region_table() const noexcept
+	{
+		return region_;
+	}
+
+	// is the cell @param id (unpadded) in the last region?
+	bool
+	reached(pack_id id) const
+	{
+		return region_.get(map_->to_padded_id(id)) != 0;
+	}
+
+	// the number of cells in the last region
+	uint32_t
+	get_num_cells() const noexcept
+	{
+		return num_cells_;
+	}
+
+	// converts between scenario coordinates and pack_ids
+	gridmap_expansion_policy*
+	get_expander()
+	{
+		return &expander_;
+	}
+
+	size_t
+	mem();
+
+private:
+	struct open_entry
+	{
+		double g_;
+		uint32_t id_; // padded
+	};
+
+	domain::gridmap* map_;
+	gridmap_expansion_policy expander_;
+
+	std::vector<uint64_t> region_data_;
+	region_table region_;
+	// the words of ::region_data_ set by the last query
+	std::vector<uint32_t> dirty_;
+	uint32_t num_cells_ = 0;
+
+	// per padded id; a g-value is valid if its stamp matches
+	std::vector<double> g_;
+	std::vector<uint32_t> stamp_;
+	std::vector<open_entry> open_;
+	uint32_t search_stamp_ = 0;
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_ISOCHRONE_SEARCH_H
@@ -0,0 +1,169 @@
+#ifndef WARTHOG_SEARCH_MULTI_TARGET_SEARCH_H
+#define WARTHOG_SEARCH_MULTI_TARGET_SEARCH_H
+
+// search/multi_target_search.h
+//
+// A* from one start to a set of targets on an octile gridmap, over the
+// moves of gridmap_expansion_policy. There are two modes:
+//
+//  - nearest: stop at the first target expanded, which is the nearest;
+//  - all: stop once every reachable target has been expanded, giving the
+//    cost to each.
+//
+// The heuristic of a cell is the least octile distance to a target not
+// yet expanded. It only grows as targets are expanded, so entries on the
+// open list may hold an old, smaller f-value; they are checked when popped
+// and pushed back with the new one. With many targets the nearest one is
+// found in a bucket grid over the targets, in rings of buckets around the
+// cell, stopping once no ring can hold a nearer target.
+//
+// In mode all the search is Dijkstra's until few targets remain: with
+// many targets the heuristic is small, and each target expanded makes
+// much of the open list stale, so keeping it current costs more than the
+// expansions it saves.
+//
+// One search replaces a search per target: in mode all, the area around
+// the start is expanded once for all targets.
+//
+// @created: 2026-10-19
+//
+
+#include "gridmap_expansion_policy.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/domain/gridmap.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::search
+{
+
+enum class target_mode
+{
+	nearest, // stop at the nearest target
+	all      // stop once all targets are reached
+};
+
+// a start and a set of targets, as unpadded ids
+struct multi_target_instance
+{
+	pack_id start_;
+	std::vector<pack_id> targets_;
+	target_mode mode_ = target_mode::nearest;
+	bool verbose_     = false;
+};
+
+class multi_target_search
+{
+public:
+	// the bucket grid is used for more than @param index_threshold targets
+	// in mode nearest; in mode all, the heuristic is used for at most that
+	// many
+	multi_target_search(domain::gridmap* map, uint32_t index_threshold = 16);
+
+	multi_target_search(const multi_target_search&) = delete;
+	multi_target_search&
+	operator=(const multi_target_search&)
+	    = delete;
+
+	// @param sol gets the cost and path to the nearest target; the costs
+	// of all targets are given by ::get_cost
+	void
+	get_path(
+	    multi_target_instance* pi, search_parameters* par, solution* sol);
+
+	void
+	get_pathcost(
+	    multi_target_instance* pi, search_parameters* par, solution* sol);
+
+	// the cost to target @param i of the last query, or COST_MAX if it was
+	// not reached. in mode nearest only the nearest target is reached;
+	// another is only known if it is equally near.
+	cost_t
+	get_cost(uint32_t i) const
+	{
+		return costs_[i];
+	}
+
+	// the index of the nearest target of the last query, or UINT32_MAX
+	uint32_t
+	get_nearest() const noexcept
+	{
+		return nearest_;
+	}
+
+	// converts between scenario coordinates and pack_ids
+	gridmap_expansion_policy*
+	get_expander()
+	{
+		return &expander_;
+	}
+
+	size_t
+	mem();
+
+private:
+	struct open_entry
+	{
+		double f_;
+		double g_;
+		uint32_t id_; // padded
+	};
+
+	domain::gridmap* map_;
+	gridmap_expansion_policy expander_;
+	uint32_t index_threshold_;
+
+	// per padded id; the values of a cell are valid if its stamp matches
+	std::vector<double> g_;
+	std::vector<uint32_t> parent_;
+	std::vector<uint32_t> stamp_;
+	std::vector<bool> closed_;
+	std::vector<open_entry> open_;
+	uint32_t search_stamp_ = 0;
+
+	// the targets of the query, and those not yet expanded. ::slot_ of a
+	// padded id is one more than the index of its first target (0 for
+	// none), valid if its stamp matches; ::same_ links the targets of a
+	// cell
+	std::vector<uint32_t> target_x_;
+	std::vector<uint32_t> target_y_;
+	std::vector<uint32_t> slot_;
+	std::vector<uint32_t> same_;
+	std::vector<uint32_t> remaining_;
+	std::vector<uint32_t> position_; // of each target in ::remaining_
+	std::vector<cost_t> costs_;
+	uint32_t nearest_ = UINT32_MAX;
+	// no heuristic while more than ::index_threshold_ targets remain
+	bool blind_ = false;
+
+	// the bucket grid: the remaining targets of each bucket
+	bool indexed_         = false;
+	uint32_t bucket_size_ = 0;
+	uint32_t bucket_cols_ = 0;
+	uint32_t bucket_rows_ = 0;
+	std::vector<std::vector<uint32_t>> buckets_;
+
+	void
+	search_(
+	    multi_target_instance* pi, search_parameters* par, solution* sol,
+	    bool path);
+
+	// the least octile distance from padded id @param id to a remaining
+	// target
+	double
+	heuristic_(uint32_t id) const;
+
+	// build the bucket grid over the remaining targets
+	void
+	index_();
+
+	// remove target @param i from the remaining targets
+	void
+	settle_(uint32_t i);
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_MULTI_TARGET_SEARCH_H
@@ -0,0 +1,126 @@
+#ifndef WARTHOG_SEARCH_PRIORITIZED_PLANNER_H
+#define WARTHOG_SEARCH_PRIORITIZED_PLANNER_H
+
+// search/prioritized_planner.h
+//
+// Prioritized planning (Erdmann and Lozano-Perez, 1987; Silver, 2005) for
+// many agents on one gridmap. Agents are planned one at a time, in
+// priority order, with space-time A* (unidirectional_search over a
+// spacetime_expansion_policy). The path of every planned agent is added
+// to a reservation_table, which later agents must avoid; each agent stays
+// parked at its goal once it arrives.
+//
+// The planner is fast but incomplete: an agent may find no path because
+// of the reservations of agents planned before it, even when a
+// collision-free plan for all agents exists.
+//
+// Unless a horizon is set on the expansion policy, each agent is searched
+// up to the last reserved timestep plus the length of its shortest path
+// when alone on the map, plus a slack (see ::set_slack). An agent whose
+// goal is reserved forever by an agent before it, or which cannot reach
+// its goal even alone, fails without a space-time search.
+//
+// @created: 2026-10-19
+//
+
+#include "gridmap_expansion_policy.h"
+#include "problem_instance.h"
+#include "reservation_table.h"
+#include "search_metrics.h"
+#include "search_parameters.h"
+#include "spacetime_expansion_policy.h"
+#include "unidirectional_search.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/util/pqueue.h>
+
+#include <vector>
+
+namespace warthog::search
+{
+
+class prioritized_planner
+{
+public:
+	prioritized_planner(domain::gridmap* map, bool manhattan = false);
+
+	prioritized_planner(const prioritized_planner&) = delete;
+	prioritized_planner&
+	operator=(const prioritized_planner&)
+	    = delete;
+
+	// plan a path for every agent in @param agents, in order; earlier
+	// agents have priority. paths are planned against the reservations
+	// already in the table, and added to it.
+	//
+	// @param paths: on return, the cell of agent i at every timestep, from
+	// timestep 0 until it arrives at its goal; empty if no path was found
+	// @param met: if not null, the search metrics summed over all agents
+	// @return the number of agents for which a path was found
+	uint32_t
+	plan(
+	    std::vector<problem_instance>& agents, search_parameters* par,
+	    std::vector<std::vector<pack_id>>& paths,
+	    search_metrics* met = nullptr);
+
+	// the timesteps an agent may spend beyond the last reserved timestep
+	// and the length of its shortest path when alone
+	void
+	set_slack(uint32_t slack)
+	{
+		slack_ = slack;
+	}
+
+	uint32_t
+	get_slack() const
+	{
+		return slack_;
+	}
+
+	reservation_table&
+	get_reservations()
+	{
+		return reservations_;
+	}
+
+	spacetime_expansion_policy&
+	get_expander()
+	{
+		return expander_;
+	}
+
+	size_t
+	mem();
+
+private:
+	using space_time_astar = unidirectional_search<
+	    heuristic::octile_heuristic, spacetime_expansion_policy,
+	    util::pqueue_min, dummy_listener,
+	    admissibility_criteria::w_admissible,
+	    feasibility_criteria::until_cutoff>;
+
+	domain::gridmap* map_;
+	reservation_table reservations_;
+	spacetime_expansion_policy expander_;
+	heuristic::octile_heuristic heuristic_;
+	util::pqueue_min open_;
+	space_time_astar search_;
+	std::vector<pad_id> cells_;
+	uint32_t slack_ = 64;
+
+	// shortest paths ignoring other agents, which bound the horizon
+	gridmap_expansion_policy grid_;
+	util::pqueue_min grid_open_;
+	unidirectional_search<
+	    heuristic::octile_heuristic, gridmap_expansion_policy>
+	    grid_search_;
+
+	// the horizon of a space-time search for @param agent, or 0 if the
+	// agent cannot reach its goal
+	uint32_t
+	horizon_(problem_instance& agent, search_metrics* met);
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_PRIORITIZED_PLANNER_H
@@ -0,0 +1,175 @@
+#ifndef WARTHOG_SEARCH_RESERVATION_TABLE_H
+#define WARTHOG_SEARCH_RESERVATION_TABLE_H
+
+// search/reservation_table.h
+//
+// A table of (cell, timestep) reservations for multi-agent planning on a
+// gridmap. Cells are padded ids. A cell may be reserved at a single
+// timestep (vertex reservation), for every timestep from a given one on
+// (an agent parked at its goal), and a move out of a cell may be reserved
+// between two consecutive timesteps (edge reservation). Moves that swap
+// two agents, or that end in a reserved cell, are in conflict.
+//
+// The vertex and edge reservations of a (cell, timestep) pair share one
+// 16-byte slot of an open-addressing hash table with linear probing, so a
+// successor check usually touches one or two cache lines. The table grows
+// when it is half full. Parking and the last reserved timestep are kept per
+// cell, in flat arrays.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/constants.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::search
+{
+
+class reservation_table
+{
+public:
+	// @param width, @param height: dimensions of the padded gridmap
+	reservation_table(uint32_t width, uint32_t height);
+
+	reservation_table(const reservation_table&) = delete;
+	reservation_table&
+	operator=(const reservation_table&)
+	    = delete;
+
+	// remove every reservation
+	void
+	clear();
+
+	void
+	reserve_vertex(pad_id cell, uint32_t t);
+
+	// reserve the move from @param from at timestep @param t to the
+	// adjacent cell @param to at timestep t+1
+	void
+	reserve_edge(pad_id from, pad_id to, uint32_t t);
+
+	// reserve @param cell at every timestep from @param t on
+	void
+	reserve_forever(pad_id cell, uint32_t t);
+
+	// reserve a path given as the cell occupied at each timestep, starting
+	// at timestep 0. the agent is parked at the last cell.
+	void
+	reserve_path(const std::vector<pad_id>& path);
+
+	inline bool
+	vertex_free(pad_id cell, uint32_t t) const
+	{
+		if(t >= parked_[cell.id]) { return false; }
+		if(t >= last_[cell.id]) { return true; }
+		const slot* s = find(key(cell, t));
+		return s == nullptr || !s->vertex_;
+	}
+
+	// @return true if the move from @param from at timestep @param t to
+	// @param to at timestep t+1 conflicts with no reservation
+	inline bool
+	edge_free(pad_id from, pad_id to, uint32_t t) const
+	{
+		if(!vertex_free(to, t + 1)) { return false; }
+		// a swap: another agent moves from @param to into @param from
+		if(t >= last_[to.id]) { return true; }
+		const slot* s = find(key(to, t));
+		return s == nullptr || !(s->edges_ & direction(to, from));
+	}
+
+	// @return true if @param cell is not reserved at timestep @param t
+	// or at any later timestep
+	inline bool
+	free_from(pad_id cell, uint32_t t) const
+	{
+		return parked_[cell.id] == NEVER && t >= last_[cell.id];
+	}
+
+	// one more than the largest timestep with a reservation (0 if none),
+	// parked agents excluded
+	uint32_t
+	get_horizon() const
+	{
+		return horizon_;
+	}
+
+	size_t
+	size() const
+	{
+		return size_;
+	}
+
+	size_t
+	mem() const;
+
+private:
+	static constexpr uint64_t EMPTY = UINT64_MAX;
+	static constexpr uint32_t NEVER = UINT32_MAX;
+
+	struct slot
+	{
+		uint64_t key_;
+		uint8_t vertex_;
+		uint8_t edges_; // one bit per move direction; see ::direction
+	};
+
+	std::vector<slot> slots_;
+	uint64_t mask_;
+	uint32_t shift_;
+	size_t size_;
+	uint32_t width_;
+	uint32_t horizon_;
+	// per cell: the first timestep from which the cell is always reserved
+	std::vector<uint32_t> parked_;
+	// per cell: one more than the last timestep with a reservation
+	std::vector<uint32_t> last_;
+
+	static inline uint64_t
+	key(pad_id cell, uint32_t t)
+	{
+		return (uint64_t{t} << 32) | uint32_t(cell.id);
+	}
+
+	// fibonacci hashing: the top bits of the product index the table
+	inline uint64_t
+	hash(uint64_t key) const
+	{
+		return (key * 0x9E3779B97F4A7C15ull) >> shift_;
+	}
+
+	inline const slot*
+	find(uint64_t k) const
+	{
+		for(uint64_t i = hash(k);; i = (i + 1) & mask_)
+		{
+			const slot& s = slots_[i];
+			if(s.key_ == k) { return &s; }
+			if(s.key_ == EMPTY) { return nullptr; }
+		}
+	}
+
+	// the bit for the move from @param from to the adjacent cell @param to
+	inline uint8_t
+	direction(pad_id from, pad_id to) const
+	{
+		int64_t d  = int64_t(to.id) - int64_t(from.id);
+		int64_t dy = d < -1 ? -1 : (d > 1 ? 1 : 0);
+		int64_t dx = d - dy * int64_t(width_);
+		// row-major over the 3x3 neighbourhood, without the centre
+		uint32_t index = uint32_t((dy + 1) * 3 + (dx + 1));
+		return uint8_t(1u << (index - (index > 4)));
+	}
+
+	slot&
+	insert(pad_id cell, uint32_t t);
+
+	void
+	grow();
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_RESERVATION_TABLE_H
@@ -29,6 +29,8 @@ struct search_metrics
 		nodes_surplus_     = other.nodes_surplus_;
 		nodes_reopen_      = other.nodes_reopen_;
 		heap_ops_          = other.heap_ops_;
+		messages_sent_     = other.messages_sent_;
+		comm_time_nano_    = other.comm_time_nano_;
 		lb_                = other.lb_;
 		ub_                = other.ub_;
 		return *this;
@@ -43,6 +45,8 @@ struct search_metrics
 		nodes_surplus_     = 0;
 		nodes_reopen_      = 0;
 		heap_ops_          = 0;
+		messages_sent_     = 0;
+		comm_time_nano_    = {};
 		lb_                = warthog::COST_MAX;
 		ub_                = warthog::COST_MAX;
 	}
@@ -54,6 +58,11 @@ struct search_metrics
 	uint32_t nodes_reopen_;
 	uint32_t heap_ops_;
 
+	// parallel searches only: states sent from one thread to another, and
+	// the total time all threads spent sending and receiving them
+	uint32_t messages_sent_;
+	std::chrono::nanoseconds comm_time_nano_;
+
 	// bounds established during the search
 	cost_t lb_;
 	cost_t ub_;
@@ -0,0 +1,230 @@
+#ifndef WARTHOG_SEARCH_SEARCH_TREE_CACHE_H
+#define WARTHOG_SEARCH_SEARCH_TREE_CACHE_H
+
+// search/search_tree_cache.h
+//
+// Reuse of search trees between queries which share a start or a target,
+// such as an agent planning again from where it stands, or many agents
+// heading to the same target. It is an engine with the interface of
+// unidirectional_search, over the moves of gridmap_expansion_policy.
+//
+// A tree is an A* search (or a Dijkstra search; see the constructor)
+// rooted at the start of a query (forward) or at its target (backward);
+// the moves cost the same both ways, so a backward tree is a search from
+// the target. The tree keeps its g-values, parents, closed set and open
+// list. The octile heuristic is consistent, so closed cells have their
+// exact cost from the root, and every later query whose other endpoint is
+// closed is answered from the tree. Otherwise the search resumes from the
+// saved open list, rekeyed if the other endpoint differs, until that
+// endpoint is closed: any shortest path from the root to it leaves the
+// closed set through an open cell whose g-value is exact.
+//
+// Trees are cached by (root, direction), up to a fixed number; the least
+// recently used is evicted to make room. The cache is cleared when the
+// version of the map changes, so the key is in effect (map version, root,
+// direction). A query uses the forward tree of its start or the backward
+// tree of its target, whichever is cached and has closed more cells, or
+// else builds a new tree in the default direction.
+//
+// Each tree holds a double and two uint32_t for every cell of the padded
+// map, plus its open list. The cells are allocated once, and outlive a
+// change of the map; a tree built in place of an evicted or dropped one
+// tells its cells from the old ones by stamp, as search_node does with
+// search numbers, instead of clearing them.
+//
+// @created: 2026-10-19
+//
+
+#include "gridmap_expansion_policy.h"
+#include "problem_instance.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::search
+{
+
+enum class tree_direction
+{
+	forward, // rooted at the start of a query
+	backward // rooted at the target of a query
+};
+
+class search_tree_cache
+{
+public:
+	// keep at most @param capacity trees (at least 1); @param astar set to
+	// false grows the trees as Dijkstra searches
+	search_tree_cache(
+	    domain::gridmap* map, uint32_t capacity = 8, bool astar = true);
+
+	search_tree_cache(const search_tree_cache&) = delete;
+	search_tree_cache&
+	operator=(const search_tree_cache&)
+	    = delete;
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol);
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol);
+
+	// the direction of trees built by a query that can use none
+	void
+	set_direction(tree_direction dir) noexcept
+	{
+		direction_ = dir;
+	}
+
+	tree_direction
+	get_direction() const noexcept
+	{
+		return direction_;
+	}
+
+	// drop all trees; their memory is kept for the trees built next
+	void
+	clear();
+
+	// converts between scenario coordinates and pack_ids
+	gridmap_expansion_policy*
+	get_expander()
+	{
+		return &expander_;
+	}
+
+	uint32_t
+	get_capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	uint32_t
+	get_num_trees() const noexcept
+	{
+		return num_trees_;
+	}
+
+	// queries answered by a cached tree as it was
+	uint64_t
+	get_num_hits() const noexcept
+	{
+		return hits_;
+	}
+
+	// queries which resumed a cached tree
+	uint64_t
+	get_num_resumes() const noexcept
+	{
+		return resumes_;
+	}
+
+	// queries which built a new tree
+	uint64_t
+	get_num_misses() const noexcept
+	{
+		return misses_;
+	}
+
+	size_t
+	mem();
+
+private:
+	struct open_entry
+	{
+		double f_;
+		double g_;
+		uint32_t id_; // padded
+	};
+
+	// a cell is in the tree if its stamp is that of the tree, and closed
+	// if its stamp is one more
+	struct cell
+	{
+		double g_;
+		uint32_t parent_; // padded
+		uint32_t stamp_;
+	};
+
+	struct tree
+	{
+		uint32_t root_; // padded
+		tree_direction dir_;
+		// the padded id the open list is keyed towards
+		uint32_t goal_;
+		uint32_t num_closed_;
+		uint32_t stamp_;
+		// the trees used just after and just before this one
+		uint32_t newer_;
+		uint32_t older_;
+		// per padded id
+		std::vector<cell> cells_;
+		std::vector<open_entry> open_;
+
+		bool
+		closed(uint32_t id) const
+		{
+			return cells_[id].stamp_ == stamp_ + 1;
+		}
+
+		double
+		g(uint32_t id) const
+		{
+			return cells_[id].stamp_ >= stamp_ ? cells_[id].g_
+			                                   : warthog::COST_MAX;
+		}
+	};
+
+	domain::gridmap* map_;
+	gridmap_expansion_policy expander_;
+	// scaled to 0 for Dijkstra trees
+	heuristic::octile_heuristic heuristic_;
+	uint32_t capacity_;
+	bool astar_;
+	tree_direction direction_ = tree_direction::backward;
+	uint64_t version_;
+	uint64_t hits_    = 0;
+	uint64_t resumes_ = 0;
+	uint64_t misses_  = 0;
+	// the first ::num_trees_ are cached, the others were dropped by clear
+	std::vector<tree> trees_;
+	uint32_t num_trees_ = 0;
+	// the ends of the list of trees by use, as indexes in trees_
+	uint32_t newest_ = UINT32_MAX;
+	uint32_t oldest_ = UINT32_MAX;
+
+	void
+	search_(
+	    problem_instance* pi, search_parameters* par, solution* sol,
+	    bool path);
+
+	// the cached tree rooted at padded id @param root, or nullptr
+	tree*
+	find_(uint32_t root, tree_direction dir);
+
+	// a new tree rooted at padded id @param root, in place of the least
+	// recently used one if the cache is full
+	tree*
+	build_(uint32_t root, tree_direction dir);
+
+	// grow @param t until padded id @param goal is closed, or the open
+	// list is empty or a cutoff of @param par is reached
+	void
+	grow_(tree& t, uint32_t goal, search_parameters* par, solution* sol);
+
+	// make tree @param t the most recently used
+	void
+	link_(uint32_t t);
+
+	void
+	unlink_(uint32_t t);
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_SEARCH_TREE_CACHE_H
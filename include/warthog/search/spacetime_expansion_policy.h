@@ -0,0 +1,154 @@
+#ifndef WARTHOG_SEARCH_SPACETIME_EXPANSION_POLICY_H
+#define WARTHOG_SEARCH_SPACETIME_EXPANSION_POLICY_H
+
+// search/spacetime_expansion_policy.h
+//
+// A time-expanded ExpansionPolicy for multi-agent planning on a gridmap.
+// A state is a (cell, timestep) pair: the timestep is stored in the high
+// 32 bits of the state id and the padded cell id in the low 32 bits, so
+// spatial heuristics (e.g. octile_heuristic) apply unchanged.
+//
+// From (c, t) the policy generates (c', t+1) for every move c -> c' made
+// by gridmap_expansion_policy, plus a wait action (c, t+1) with cost
+// ::WAIT_COST. Moves and waits that conflict with the reservation_table
+// are not generated.
+//
+// The target is the goal cell at timestep ::TIME_INF: reaching the goal
+// cell at a timestep from which it is never reserved again generates the
+// target instead. Paths from unidirectional_search therefore list the cell
+// occupied at every timestep, ending with the arrival at the goal.
+//
+// The time-expanded state space is too large for a node pool indexed by
+// state, so search nodes live in a hash table which is emptied at the
+// start of every search; ::generate and ::get_ptr hide the node-pool
+// versions of expansion_policy.
+//
+// @created: 2026-10-19
+//
+
+#include "expansion_policy.h"
+#include "gridmap_expansion_policy.h"
+#include "problem_instance.h"
+#include "reservation_table.h"
+#include "search_node.h"
+#include <warthog/domain/gridmap.h>
+
+#include <deque>
+#include <unordered_map>
+
+namespace warthog::search
+{
+
+class spacetime_expansion_policy : public expansion_policy
+{
+public:
+	static constexpr uint32_t TIME_INF = UINT32_MAX;
+	static constexpr cost_t WAIT_COST  = 1;
+
+	spacetime_expansion_policy(
+	    domain::gridmap* map, reservation_table* reservations,
+	    bool manhattan = false);
+
+	static inline pad_id
+	make_id(pad_id cell, uint32_t t)
+	{
+		return pad_id{(sn_id_t{t} << 32) | uint32_t(cell.id)};
+	}
+
+	static inline pad_id
+	get_cell(pad_id id)
+	{
+		return pad_id{id.id & UINT32_MAX};
+	}
+
+	static inline uint32_t
+	get_time(pad_id id)
+	{
+		return uint32_t(id.id >> 32);
+	}
+
+	// no state is generated at or after timestep @param horizon.
+	// a horizon of 0 (the default) sets it, at the start of every search,
+	// to the last reserved timestep plus the number of cells on the map;
+	// if the target is reachable at all it is reachable by then.
+	void
+	set_horizon(uint32_t horizon)
+	{
+		horizon_ = horizon;
+	}
+
+	uint32_t
+	get_horizon() const
+	{
+		return horizon_;
+	}
+
+	search_node*
+	generate(pad_id node_id);
+
+	search_node*
+	get_ptr(pad_id node_id, uint32_t search_number);
+
+	void
+	expand(search_node*, search_problem_instance*) override;
+
+	search_node*
+	generate_start_node(search_problem_instance* pi) override;
+
+	search_node*
+	generate_target_node(search_problem_instance* pi) override;
+
+	search_problem_instance
+	get_problem_instance(problem_instance* pi) override;
+
+	pack_id
+	get_state(pad_id node_id) override;
+
+	// the state for @param node_id at timestep 0
+	pad_id
+	unget_state(pack_id node_id) override;
+
+	/// get unpadded xy
+	void
+	get_xy(pack_id node_id, int32_t& x, int32_t& y);
+
+	/// unpadded xy to pack
+	pack_id
+	get_pack(int32_t x, int32_t y);
+
+	domain::gridmap*
+	get_map() const noexcept
+	{
+		return map_;
+	}
+
+	reservation_table*
+	get_reservations() const noexcept
+	{
+		return reservations_;
+	}
+
+	void
+	print_node(search_node* n, std::ostream& out) override;
+
+	size_t
+	mem() override;
+
+private:
+	domain::gridmap* map_;
+	reservation_table* reservations_;
+	gridmap_expansion_policy grid_;
+	uint32_t horizon_        = 0;
+	uint32_t search_horizon_ = 0;
+
+	std::unordered_map<sn_id_t, search_node*> nodes_;
+	std::deque<search_node> storage_;
+	search_node cell_node_;
+
+	void
+	add_successor_(pad_id cell, uint32_t t, pad_id goal, cost_t cost);
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_SPACETIME_EXPANSION_POLICY_H
@@ -0,0 +1,342 @@
+#ifndef WARTHOG_SEARCH_SUBPATH_CACHE_H
+#define WARTHOG_SEARCH_SUBPATH_CACHE_H
+
+// search/subpath_cache.h
+//
+// Answers queries which lie on paths returned earlier. Every sub-path of
+// an optimal path is optimal, so when the start and the target of a query
+// both lie on a cached path, the start first, the answer is the slice of
+// that path between them; there is no search.
+//
+// The cache wraps an engine with the interface of unidirectional_search.
+// Each path the engine returns is kept with the cost from its first cell
+// to each of its cells, found by expanding each cell with the engine's
+// expander; paths with steps which are not moves of the expander, such as
+// any-angle paths, are not cached. An index maps each cell to the path
+// that last went through it, and its offset there. A query is tried on
+// the path of its start and on the path of its target; the other endpoint
+// is looked for along that path.
+//
+// The cells of all cached paths are bounded by a budget; the least
+// recently used paths, kept in a list ordered by use, are evicted to stay
+// within it. The cache is cleared when the version of the map changes,
+// that is after any call to its set_label.
+//
+// @created: 2026-10-19
+//
+
+#include "problem_instance.h"
+#include "search_node.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace warthog::search
+{
+
+template<class Engine>
+class subpath_cache
+{
+public:
+	// keep at most @param max_cells cells over all cached paths
+	subpath_cache(Engine* engine, size_t max_cells = size_t{1} << 20)
+	    : engine_(engine), max_cells_(max_cells)
+	{
+		auto* map = engine->get_expander()->get_map();
+		version_  = map->get_version();
+		index_.assign(
+		    size_t(map->header_width()) * map->header_height(), NO_ENTRY);
+	}
+
+	subpath_cache(const subpath_cache&) = delete;
+	subpath_cache&
+	operator=(const subpath_cache&)
+	    = delete;
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		query_(pi, par, sol, true);
+	}
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		query_(pi, par, sol, false);
+	}
+
+	// drop all paths
+	void
+	clear()
+	{
+		std::fill(index_.begin(), index_.end(), NO_ENTRY);
+		paths_.clear();
+		free_.clear();
+		num_cells_ = 0;
+		newest_    = UINT32_MAX;
+		oldest_    = UINT32_MAX;
+	}
+
+	auto*
+	get_expander()
+	{
+		return engine_->get_expander();
+	}
+
+	Engine*
+	get_engine()
+	{
+		return engine_;
+	}
+
+	uint32_t
+	get_num_paths() const noexcept
+	{
+		return uint32_t(paths_.size() - free_.size());
+	}
+
+	size_t
+	get_num_cells() const noexcept
+	{
+		return num_cells_;
+	}
+
+	uint64_t
+	get_num_hits() const noexcept
+	{
+		return hits_;
+	}
+
+	uint64_t
+	get_num_misses() const noexcept
+	{
+		return misses_;
+	}
+
+	size_t
+	mem()
+	{
+		size_t size = sizeof(*this) + index_.capacity() * sizeof(entry)
+		    + paths_.capacity() * sizeof(cached_path)
+		    + free_.capacity() * sizeof(uint32_t);
+		for(const cached_path& p : paths_)
+		{
+			size += p.cells_.capacity() * sizeof(pack_id)
+			    + p.cost_.capacity() * sizeof(cost_t);
+		}
+		return size;
+	}
+
+private:
+	// the path through a cell, and the offset of the cell on it
+	struct entry
+	{
+		uint32_t path_;
+		uint32_t offset_;
+
+		bool
+		operator==(const entry&) const
+		    = default;
+	};
+	static constexpr entry NO_ENTRY = {UINT32_MAX, UINT32_MAX};
+
+	struct cached_path
+	{
+		std::vector<pack_id> cells_;
+		// the cost from the first cell to each cell
+		std::vector<cost_t> cost_;
+		// the paths used just after and just before this one
+		uint32_t newer_;
+		uint32_t older_;
+	};
+
+	Engine* engine_;
+	size_t max_cells_;
+	size_t num_cells_ = 0;
+	uint64_t version_;
+	uint64_t hits_   = 0;
+	uint64_t misses_ = 0;
+
+	// per unpadded id
+	std::vector<entry> index_;
+	// cached paths, and the indexes of those evicted
+	std::vector<cached_path> paths_;
+	std::vector<uint32_t> free_;
+	// the ends of the list of cached paths by use
+	uint32_t newest_ = UINT32_MAX;
+	uint32_t oldest_ = UINT32_MAX;
+
+	void
+	query_(
+	    problem_instance* pi, search_parameters* par, solution* sol,
+	    bool keep_path)
+	{
+		util::timer mytimer;
+		mytimer.start();
+		uint64_t version = engine_->get_expander()->get_map()->get_version();
+		if(version != version_)
+		{
+			clear();
+			version_ = version;
+		}
+
+		if(pi->start_.id < index_.size() && pi->target_.id < index_.size()
+		   && (slice_(index_[pi->start_.id].path_, pi, par, sol, keep_path)
+		       || slice_(
+		           index_[pi->target_.id].path_, pi, par, sol, keep_path)))
+		{
+			hits_++;
+			sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+			return;
+		}
+
+		misses_++;
+		engine_->get_path(pi, par, sol);
+		insert_(sol->path_);
+		if(!keep_path) { sol->path_.clear(); }
+	}
+
+	// answer with the slice of path @param p, if it holds the start and
+	// then the target of @param pi
+	bool
+	slice_(
+	    uint32_t p, problem_instance* pi, search_parameters* par,
+	    solution* sol, bool keep_path)
+	{
+		if(p == UINT32_MAX) { return false; }
+		cached_path& cp = paths_[p];
+		uint32_t from   = find_(p, pi->start_);
+		uint32_t to     = find_(p, pi->target_);
+		if(from == UINT32_MAX || to == UINT32_MAX || from > to)
+		{
+			return false;
+		}
+
+		cost_t cost = cp.cost_[to] - cp.cost_[from];
+		if(cost > par->get_max_cost_cutoff()) { return false; }
+		unlink_(p);
+		link_(p);
+		sol->sum_of_edge_costs_ = cost;
+		sol->met_.reset();
+		sol->met_.lb_ = cost;
+		sol->met_.ub_ = cost;
+		if(keep_path)
+		{
+			sol->path_.assign(
+			    cp.cells_.begin() + from, cp.cells_.begin() + to + 1);
+		}
+		return true;
+	}
+
+	// the offset of @param id on path @param p, or UINT32_MAX
+	uint32_t
+	find_(uint32_t p, pack_id id) const
+	{
+		const entry& e = index_[id.id];
+		if(e.path_ == p) { return e.offset_; }
+		const std::vector<pack_id>& cells = paths_[p].cells_;
+		auto it = std::find(cells.begin(), cells.end(), id);
+		return it == cells.end() ? UINT32_MAX : uint32_t(it - cells.begin());
+	}
+
+	// cache @param path, unless its steps are not moves of the expander
+	void
+	insert_(const std::vector<pack_id>& path)
+	{
+		if(path.empty() || path.size() > max_cells_) { return; }
+
+		std::vector<cost_t> cost(path.size());
+		cost[0]        = 0;
+		auto* expander = engine_->get_expander();
+		search_problem_instance spi{pad_id::max(), pad_id::max()};
+		search_node current;
+		for(size_t i = 1; i < path.size(); i++)
+		{
+			current.set_id(expander->unget_state(path[i - 1]));
+			expander->expand(&current, &spi);
+			pad_id next    = expander->unget_state(path[i]);
+			search_node* n = nullptr;
+			cost_t c       = 0;
+			uint32_t j     = 0;
+			for(; j < expander->get_num_successors(); j++)
+			{
+				expander->get_successor(j, n, c);
+				if(n->get_id() == next) { break; }
+			}
+			if(j == expander->get_num_successors()) { return; }
+			cost[i] = cost[i - 1] + c;
+		}
+
+		while(num_cells_ + path.size() > max_cells_)
+		{
+			evict_();
+		}
+		uint32_t p;
+		if(free_.empty())
+		{
+			p = uint32_t(paths_.size());
+			paths_.emplace_back();
+		}
+		else
+		{
+			p = free_.back();
+			free_.pop_back();
+		}
+		cached_path& cp = paths_[p];
+		cp.cells_       = path;
+		cp.cost_        = std::move(cost);
+		num_cells_     += path.size();
+		link_(p);
+		for(uint32_t i = 0; i < path.size(); i++)
+		{
+			index_[path[i].id] = {p, i};
+		}
+	}
+
+	// drop the least recently used path
+	void
+	evict_()
+	{
+		uint32_t p      = oldest_;
+		cached_path& cp = paths_[p];
+		for(pack_id id : cp.cells_)
+		{
+			if(index_[id.id].path_ == p) { index_[id.id] = NO_ENTRY; }
+		}
+		num_cells_ -= cp.cells_.size();
+		cp.cells_.clear();
+		cp.cost_.clear();
+		unlink_(p);
+		free_.push_back(p);
+	}
+
+	// make path @param p the most recently used
+	void
+	link_(uint32_t p)
+	{
+		paths_[p].newer_ = UINT32_MAX;
+		paths_[p].older_ = newest_;
+		if(newest_ != UINT32_MAX) { paths_[newest_].newer_ = p; }
+		else { oldest_ = p; }
+		newest_ = p;
+	}
+
+	void
+	unlink_(uint32_t p)
+	{
+		cached_path& cp = paths_[p];
+		if(cp.newer_ != UINT32_MAX) { paths_[cp.newer_].older_ = cp.older_; }
+		else { newest_ = cp.older_; }
+		if(cp.older_ != UINT32_MAX) { paths_[cp.older_].newer_ = cp.newer_; }
+		else { oldest_ = cp.newer_; }
+	}
+};
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_SUBPATH_CACHE_H
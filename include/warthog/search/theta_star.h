@@ -0,0 +1,283 @@
+#ifndef WARTHOG_SEARCH_THETA_STAR_H
+#define WARTHOG_SEARCH_THETA_STAR_H
+
+// search/theta_star.h
+//
+// Any-angle search on gridmaps: Theta* (Nash, Daniel, Koenig and Felner,
+// 2007) and Lazy Theta* (Nash, Koenig and Tovey, 2010).
+//
+// Both are A* over the moves of a grid expansion policy, where the parent
+// of a node need not be adjacent to it. When a node n is generated from s,
+// it takes the parent p of s as its own parent if p can see n (see
+// domain::gridmap::line_of_sight), and s otherwise. Path costs are
+// Euclidean distances between consecutive waypoints, and the path in the
+// solution is the list of waypoints.
+//
+// Theta* tests line of sight for every generated node. Lazy Theta*
+// assumes it when a node is generated and only tests it when the node is
+// expanded; if the test fails, the node takes the best of its expanded
+// neighbours as parent instead. Far fewer tests are made, since most
+// generated nodes are never expanded.
+//
+// Paths are usually much shorter than grid paths but are not always
+// optimal (see anya for optimal any-angle paths). The heuristic should be
+// heuristic::euclidean_heuristic and E must be a grid expansion policy
+// (gridmap_expansion_policy) with a node pool.
+//
+// @created: 2026-10-19
+//
+
+#include "problem_instance.h"
+#include "search_node.h"
+#include "search_parameters.h"
+#include "solution.h"
+#include <warthog/constants.h>
+#include <warthog/heuristic/heuristic_value.h>
+#include <warthog/util/log.h>
+#include <warthog/util/pqueue.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace warthog::search
+{
+
+// H is a heuristic function
+// E is a grid expansion policy
+// Q is the open list
+// Lazy selects Lazy Theta*
+template<class H, class E, class Q = util::pqueue_min, bool Lazy = false>
+class theta_star
+{
+public:
+	theta_star(H* heuristic, E* expander, Q* queue)
+	    : heuristic_(heuristic), expander_(expander), open_(queue)
+	{ }
+
+	theta_star(const theta_star&) = delete;
+	theta_star&
+	operator=(const theta_star&)
+	    = delete;
+
+	void
+	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		search(&spi, par, sol);
+	}
+
+	void
+	get_path(problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		search(&spi, par, sol);
+		if(!sol->s_node_) { return; }
+
+		// follow backpointers; every node on the path is a waypoint
+		for(search_node* n = sol->s_node_;;
+		    n = expander_->generate(n->get_parent()))
+		{
+			sol->path_.push_back(expander_->get_state(n->get_id()));
+			if(n->get_parent() == pad_id::max()) { break; }
+		}
+		std::reverse(sol->path_.begin(), sol->path_.end());
+	}
+
+	E*
+	get_expander()
+	{
+		return expander_;
+	}
+
+	H*
+	get_heuristic()
+	{
+		return heuristic_;
+	}
+
+	// number of line of sight tests made by the last query
+	uint64_t
+	get_los_checks() const
+	{
+		return los_checks_;
+	}
+
+	inline size_t
+	mem()
+	{
+		return open_->mem() + expander_->mem() + heuristic_->mem()
+		    + sizeof(*this);
+	}
+
+private:
+	H* heuristic_;
+	E* expander_;
+	Q* open_;
+	uint64_t los_checks_ = 0;
+
+	cost_t
+	distance_(pad_id a, pad_id b)
+	{
+		uint32_t w = expander_->get_map()->width();
+		double dx  = double(a.id % w) - double(b.id % w);
+		double dy  = double(a.id / w) - double(b.id / w);
+		return std::sqrt(dx * dx + dy * dy);
+	}
+
+	bool
+	los_(pad_id a, pad_id b)
+	{
+		los_checks_++;
+		return expander_->get_map()->line_of_sight(a, b);
+	}
+
+	cost_t
+	h_(pad_id id, search_problem_instance* pi, search_parameters* par)
+	{
+		heuristic::heuristic_value hv(id, pi->target_);
+		heuristic_->h(&hv);
+		return hv.lb_ * par->get_w_admissibility();
+	}
+
+	// Lazy Theta*: the parent of @param n was assumed to see it; if it does
+	// not, take the best expanded neighbour of n as its parent instead.
+	// expects the successors of n to be in the expander.
+	void
+	set_vertex_(search_node* n, search_problem_instance* pi)
+	{
+		pad_id p = n->get_parent();
+		if(p == pad_id::max() || los_(p, n->get_id())) { return; }
+
+		cost_t best_g = COST_MAX;
+		search_node* m = nullptr;
+		cost_t cost    = 0;
+		for(uint32_t i = 0; i < expander_->get_num_successors(); i++)
+		{
+			expander_->get_successor(i, m, cost);
+			if(m->get_search_number() != pi->instance_id_
+			   || !m->get_expanded())
+			{
+				continue;
+			}
+			if(m->get_g() + cost < best_g)
+			{
+				best_g = m->get_g() + cost;
+				p      = m->get_id();
+			}
+		}
+		// the node that generated n is one of its expanded neighbours
+		assert(best_g != COST_MAX);
+		n->set_f(n->get_f() - n->get_g() + best_g);
+		n->set_g(best_g);
+		n->set_parent(p);
+	}
+
+	void
+	search(search_problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		util::timer mytimer;
+		mytimer.start();
+		open_->clear();
+		los_checks_ = 0;
+
+		search_node* start = nullptr;
+		if(pi->start_ != pad_id::max())
+		{
+			start = expander_->generate_start_node(pi);
+		}
+		if(!start)
+		{
+			sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+			return;
+		}
+		start->init(pi->instance_id_, pad_id::max(), 0, h_(pi->start_, pi, par));
+		open_->push(start);
+
+		while(open_->size())
+		{
+			search_node* current = open_->pop();
+			current->set_expanded(true);
+			bool expanded = false;
+			if constexpr(Lazy)
+			{
+				if(current->get_parent() != pad_id::max())
+				{
+					expander_->expand(current, pi);
+					expanded = true;
+					set_vertex_(current, pi);
+				}
+			}
+
+			if(current->get_id() == pi->target_)
+			{
+				sol->s_node_            = current;
+				sol->sum_of_edge_costs_ = current->get_g();
+				break;
+			}
+			if(current->get_f() > par->get_max_cost_cutoff())
+			{
+				info(par->verbose_, "cost cutoff", current->get_f());
+				break;
+			}
+			if(sol->met_.nodes_expanded_ >= par->get_max_expansions_cutoff())
+			{
+				info(
+				    par->verbose_, "expansions cutoff",
+				    sol->met_.nodes_expanded_);
+				break;
+			}
+
+			if(!expanded) { expander_->expand(current, pi); }
+			sol->met_.nodes_expanded_++;
+			sol->met_.lb_ = current->get_f();
+			trace(pi->verbose_, "Expanding:", *current);
+
+			pad_id parent  = current->get_parent();
+			search_node* n = nullptr;
+			cost_t cost    = 0;
+			for(uint32_t i = 0; i < expander_->get_num_successors(); i++)
+			{
+				expander_->get_successor(i, n, cost);
+				sol->met_.nodes_generated_++;
+				bool seen = n->get_search_number() == pi->instance_id_;
+				if(seen && n->get_expanded()) { continue; }
+
+				// path 2: straight from the parent of current
+				pad_id via = current->get_id();
+				cost_t g   = current->get_g() + cost;
+				if(parent != pad_id::max()
+				   && (Lazy || los_(parent, n->get_id())))
+				{
+					via = parent;
+					g   = expander_->generate(parent)->get_g()
+					    + distance_(parent, n->get_id());
+				}
+
+				if(!seen)
+				{
+					n->init(
+					    pi->instance_id_, via, g, g + h_(n->get_id(), pi, par));
+					open_->push(n);
+				}
+				else if(g < n->get_g())
+				{
+					n->relax(g, via);
+					open_->decrease_key(n);
+				}
+			}
+		}
+
+		sol->met_.nodes_surplus_     = open_->size();
+		sol->met_.heap_ops_          = open_->get_heap_ops();
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+	}
+};
+
+template<class H, class E, class Q = util::pqueue_min>
+using lazy_theta_star = theta_star<H, E, Q, true>;
+
+} // namespace warthog::search
+
+#endif // WARTHOG_SEARCH_THETA_STAR_H
@@ -24,6 +24,7 @@
 #include <warthog/util/timer.h>
 #include <warthog/util/vec_io.h>
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -32,6 +33,14 @@
 namespace warthog::search
 {
 
+// the state of a time-sliced search; see unidirectional_search::begin
+enum class search_status
+{
+	idle,      // no search in progress
+	suspended, // slice budget exhausted; OPEN and node state are retained
+	finished   // search terminated; solution (if any) is available
+};
+
 // H is a heuristic function
 // E is an expansion policy
 // Q is the open list
@@ -59,7 +68,8 @@ public:
 	void
 	get_pathcost(problem_instance* pi, search_parameters* par, solution* sol)
 	{
-		search(pi, par, sol);
+		search_problem_instance spi = expander_->get_problem_instance(pi);
+		search(&spi, par, sol);
 	}
 
 	void
@@ -72,45 +82,74 @@ public:
 	get_path(
 	    search_problem_instance* spi, search_parameters* par, solution* sol)
 	{
-		// if successful the search returns an incumbent node. this can be
-		// the target node or it can be another node from which the
-		// heuristic knows a concrete path to the target.
 		search(spi, par, sol);
-		if(!sol->s_node_) { return; }
+		extract_path_(spi, sol);
+	}
 
-		// follow backpointers to extract the path, from start to incumbent
-		search_node* current = sol->s_node_;
-		while(current)
-		{
-			sol->path_.push_back(expander_->get_state(current->get_id()));
-			if(current->get_parent() == pad_id::max()) break;
-			current = expander_->generate(current->get_parent());
-		}
-		assert(sol->path_.back() == expander_->get_state(spi->start_));
-		std::reverse(sol->path_.begin(), sol->path_.end());
+	// Time-sliced interface. A search is started with ::begin and then
+	// advanced by calling ::resume with a budget of expansions and/or time.
+	// When the budget is exhausted the search is suspended: OPEN, the node
+	// pool and the metrics in @param sol are left intact, so the next call
+	// to ::resume continues exactly where the previous one stopped.
+	//
+	// The search only holds pointers to @param pi, @param par and
+	// @param sol; these must outlive the search. Interleaved queries each
+	// need their own expansion policy and open list, as node state lives in
+	// the node pool of the expander.
+	void
+	begin(search_problem_instance* pi, search_parameters* par, solution* sol)
+	{
+		pi_     = pi;
+		par_    = par;
+		sol_    = sol;
+		status_ = search_status::suspended;
+		sol->met_.time_elapsed_nano_ = {};
 
-		// extract the rest of the path, from incumbent to target
-		if(sol->s_node_->get_id() != spi->target_)
-		{
-			heuristic::heuristic_value hv(
-			    sol->s_node_->get_id(), spi->target_, &sol->path_);
-			heuristic_->h(&hv);
-		}
+		util::timer mytimer;
+		mytimer.start();
+		if(!search_init_(pi, par, sol)) { status_ = search_status::finished; }
+		sol->met_.time_elapsed_nano_ += mytimer.elapsed_time_nano();
+	}
 
-		DO_ON_DEBUG_IF(spi->verbose_)
+	// continue a suspended search for at most @param max_expansions node
+	// expansions or @param max_time of wallclock time, whichever comes
+	// first. once the search has finished the path to the incumbent is
+	// extracted into the solution passed to ::begin.
+	// @param max_expansions must be at least 1: a slice which expands
+	// nothing would leave the search suspended forever.
+	search_status
+	resume(
+	    uint32_t max_expansions,
+	    std::chrono::nanoseconds max_time = std::chrono::nanoseconds::max())
+	{
+		assert(max_expansions > 0);
+		if(status_ != search_status::suspended) { return status_; }
+
+		if(!search_loop_<true>(pi_, par_, sol_, max_expansions, max_time))
 		{
-			for(auto& node_id : sol->path_)
-			{
-				int32_t x, y;
-				expander_->get_xy(node_id, x, y);
-				std::cerr << "final path: (" << x << ", " << y << ")...";
-				search_node* n
-				    = expander_->generate(expander_->unget_state(node_id));
-				assert(n->get_search_number() == spi->instance_id_);
-				n->print(std::cerr);
-				std::cerr << std::endl;
-			}
+			return status_;
 		}
+
+		search_finish_(pi_, sol_);
+		extract_path_(pi_, sol_);
+		status_ = search_status::finished;
+		return status_;
+	}
+
+	// abandon any time-sliced search in progress
+	void
+	cancel()
+	{
+		pi_     = nullptr;
+		par_    = nullptr;
+		sol_    = nullptr;
+		status_ = search_status::idle;
+	}
+
+	search_status
+	get_status() const
+	{
+		return status_;
 	}
 
 	void
@@ -153,6 +192,12 @@ private:
 	Q* open_;
 	L* listener_;
 
+	// time-sliced search state
+	search_problem_instance* pi_ = nullptr;
+	search_parameters* par_      = nullptr;
+	solution* sol_               = nullptr;
+	search_status status_        = search_status::idle;
+
 	// no copy ctor
 	unidirectional_search(const unidirectional_search& other) { }
 	unidirectional_search&
@@ -193,6 +238,43 @@ private:
 		}
 	}
 
+	// Lazy A*. with a heuristic which has an expensive bound, h_full (see
+	// heuristic/lazy_heuristic.h), nodes enter OPEN keyed on the cheap
+	// bound and the expensive one is only computed for @param n, at the
+	// top of OPEN. @return false if the f-value of @param n grew past the
+	// next node; it is then back in OPEN, or dropped if dominated by the
+	// incumbent.
+	bool
+	evaluate_full_(
+	    search_node* n, search_problem_instance* pi, search_parameters* par,
+	    solution* sol)
+	{
+		if constexpr(requires(H& h, heuristic::heuristic_value* hv) {
+			             h.h_full(hv);
+		             })
+		{
+			heuristic::heuristic_value hv(n->get_id(), pi->target_);
+			heuristic_->h_full(&hv);
+			cost_t f = n->get_g() + (hv.lb_ * par->get_w_admissibility());
+			if(f > n->get_f())
+			{
+				n->set_f(f);
+				// still no worse than the rest of OPEN
+				if(open_->size() == 0 || f <= open_->peek()->get_f())
+				{
+					return f < sol->sum_of_edge_costs_;
+				}
+				if(f < sol->sum_of_edge_costs_)
+				{
+					open_->push(n);
+					trace(pi->verbose_, "Deferred;", *n);
+				}
+				return false;
+			}
+		}
+		return true;
+	}
+
 	void
 	update_ub(search_node* n, solution* sol, search_problem_instance* pi)
 	{
@@ -208,29 +290,57 @@ private:
 	void
 	search(search_problem_instance* pi, search_parameters* par, solution* sol)
 	{
+		sol->met_.time_elapsed_nano_ = {};
 		util::timer mytimer;
 		mytimer.start();
+		if(!search_init_(pi, par, sol)) { return; }
+		sol->met_.time_elapsed_nano_ += mytimer.elapsed_time_nano();
+
+		search_loop_<false>(
+		    pi, par, sol, UINT32_MAX, std::chrono::nanoseconds::max());
+		search_finish_(pi, sol);
+	}
+
+	// initialise the start node and push to OPEN
+	// @return false if the start node is invalid
+	bool
+	search_init_(
+	    search_problem_instance* pi, search_parameters* par, solution* sol)
+	{
 		open_->clear();
+		if(pi->start_ == pad_id::max()) { return false; }
+
+		search_node* start = expander_->generate_start_node(pi);
+		if(!start) { return false; }
+		// search_node* target = expander_->generate_target_node(pi);
+		// pi.target_ = target.id_;
+
+		initialise_node_(start, pad_id::max(), 0, pi, par, sol);
+		open_->push(start);
+		listener_->generate_node(0, start, 0, UINT32_MAX);
+		user(pi->verbose_, pi);
+		trace(pi->verbose_, "Start node:", *start);
+		update_ub(start, sol, pi);
+		return true;
+	}
 
-		// initialise the start node and push to OPEN
-		{
-			if(pi->start_ == pad_id::max()) { return; }
-
-			search_node* start = expander_->generate_start_node(pi);
-			if(!start) { return; }
-			// search_node* target = expander_->generate_target_node(pi);
-			// pi.target_ = target.id_;
-
-			initialise_node_(start, pad_id::max(), 0, pi, par, sol);
-			open_->push(start);
-			listener_->generate_node(0, start, 0, UINT32_MAX);
-			user(pi->verbose_, pi);
-			trace(pi->verbose_, "Start node:", *start);
-			update_ub(start, sol, pi);
-		}
+	// keep expanding until it is no longer feasible to do so;
+	// e.g., we exceeded a cutoff or prove that no solution exists.
+	// when Sliced is set the loop also stops after @param max_expansions
+	// expansions or @param max_time nanoseconds.
+	// @return true if the search terminated, false if it was suspended
+	template<bool Sliced>
+	bool
+	search_loop_(
+	    search_problem_instance* pi, search_parameters* par, solution* sol,
+	    uint32_t max_expansions, std::chrono::nanoseconds max_time)
+	{
+		util::timer mytimer;
+		mytimer.start();
+		// time spent in earlier slices of this search
+		const std::chrono::nanoseconds elapsed = sol->met_.time_elapsed_nano_;
+		uint32_t slice_expansions              = 0;
 
-		// keep expanding until it is no longer feasible to do so;
-		// e.g., we exceeded a cutoff or prove that no solution exists
 		while(feasible<FC>(open_->peek(), &sol->met_, par))
 		{
 			// check if the incumbent solution is admissible
@@ -240,9 +350,24 @@ private:
 				break;
 			}
 
+			if constexpr(Sliced)
+			{
+				if(slice_expansions >= max_expansions
+				   || mytimer.elapsed_time_nano() >= max_time)
+				{
+					sol->met_.time_elapsed_nano_
+					    = elapsed + mytimer.elapsed_time_nano();
+					sol->met_.nodes_surplus_ = open_->size();
+					sol->met_.heap_ops_      = open_->get_heap_ops();
+					return false;
+				}
+				slice_expansions++;
+			}
+
 			// incumbent is not not admissible. expand the most
 			// promising node from the OPEN list:
 			search_node* current = open_->pop();
+			if(!evaluate_full_(current, pi, par, sol)) { continue; }
 			expander_->expand(current, pi);
 			current->set_expanded(true); // NB: set before generating succ
 			sol->met_.nodes_expanded_++;
@@ -307,13 +432,20 @@ private:
 			if constexpr(FC == feasibility_criteria::until_cutoff)
 			{
 				// patched until AC FC RP reworked
-				sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+				sol->met_.time_elapsed_nano_
+				    = elapsed + mytimer.elapsed_time_nano();
 			}
 		}
 
-		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
-		sol->met_.nodes_surplus_     = open_->size();
-		sol->met_.heap_ops_          = open_->get_heap_ops();
+		sol->met_.time_elapsed_nano_ = elapsed + mytimer.elapsed_time_nano();
+		return true;
+	}
+
+	void
+	search_finish_([[maybe_unused]] search_problem_instance* pi, solution* sol)
+	{
+		sol->met_.nodes_surplus_ = open_->size();
+		sol->met_.heap_ops_      = open_->get_heap_ops();
 
 		DO_ON_DEBUG_IF(pi->verbose_)
 		{
@@ -324,6 +456,49 @@ private:
 			else { user(pi->verbose_, "Solution found", *sol->s_node_); }
 		}
 	}
+
+	void
+	extract_path_(search_problem_instance* spi, solution* sol)
+	{
+		// if successful the search returns an incumbent node. this can be
+		// the target node or it can be another node from which the
+		// heuristic knows a concrete path to the target.
+		if(!sol->s_node_) { return; }
+
+		// follow backpointers to extract the path, from start to incumbent
+		search_node* current = sol->s_node_;
+		while(current)
+		{
+			sol->path_.push_back(expander_->get_state(current->get_id()));
+			if(current->get_parent() == pad_id::max()) break;
+			current = expander_->generate(current->get_parent());
+		}
+		assert(sol->path_.back() == expander_->get_state(spi->start_));
+		std::reverse(sol->path_.begin(), sol->path_.end());
+
+		// extract the rest of the path, from incumbent to target
+		if(sol->s_node_->get_id() != spi->target_)
+		{
+			heuristic::heuristic_value hv(
+			    sol->s_node_->get_id(), spi->target_, &sol->path_);
+			heuristic_->h(&hv);
+		}
+
+		DO_ON_DEBUG_IF(spi->verbose_)
+		{
+			for(auto& node_id : sol->path_)
+			{
+				int32_t x, y;
+				expander_->get_xy(node_id, x, y);
+				std::cerr << "final path: (" << x << ", " << y << ")...";
+				search_node* n
+				    = expander_->generate(expander_->unget_state(node_id));
+				assert(n->get_search_number() == spi->instance_id_);
+				n->print(std::cerr);
+				std::cerr << std::endl;
+			}
+		}
+	}
 };
 
 template<
@@ -30,6 +30,7 @@
 
 #include "expansion_policy.h"
 #include "search_node.h"
+#include <warthog/domain/grid_components.h>
 #include <warthog/domain/labelled_gridmap.h>
 #include <warthog/util/cost_table.h>
 
@@ -78,6 +79,13 @@ public:
 		return costs_;
 	}
 
+	// as in gridmap_expansion_policy_base
+	void
+	set_components(const domain::grid_components* components) noexcept
+	{
+		components_ = components;
+	}
+
 	void
 	print_node(search_node* n, std::ostream& out) override;
 
@@ -87,6 +95,10 @@ public:
 protected:
 	domain::vl_gridmap* map_;
 	util::cost_table& costs_;
+	const domain::grid_components* components_ = nullptr;
+
+	bool
+	unreachable_(search_problem_instance* pi) const noexcept;
 };
 
 class vl_gridmap_expansion_policy : public vl_gridmap_expansion_policy_base
@@ -0,0 +1,67 @@
+#ifndef WARTHOG_SUBGOAL_SUBGOAL_EXPANSION_POLICY_H
+#define WARTHOG_SUBGOAL_SUBGOAL_EXPANSION_POLICY_H
+
+// subgoal/subgoal_expansion_policy.h
+//
+// An ExpansionPolicy for a subgoal_graph. Successors of a subgoal are the
+// heads of its stored edges, at their octile distance.
+//
+// When the start node is generated, the start and target are connected to
+// the subgoals direct-h-reachable from them (and to each other, if the
+// target is direct-h-reachable from the start). Local subgoals next to
+// the start are expanded through their own edges. Local subgoals next to
+// the target are not stored at their global neighbours, so their edges
+// are added in reverse for the current search only; the graph itself is
+// left unchanged.
+//
+// @created: 2026-10-19
+//
+
+#include "subgoal_graph.h"
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace warthog::subgoal
+{
+
+class subgoal_expansion_policy : public search::gridmap_expansion_policy_base
+{
+public:
+	subgoal_expansion_policy(domain::gridmap* map, subgoal_graph* graph);
+
+	void
+	expand(search::search_node*, search::search_problem_instance*) override;
+
+	search::search_node*
+	generate_start_node(search::search_problem_instance* pi) override;
+
+	search::search_node*
+	generate_target_node(search::search_problem_instance* pi) override;
+
+	subgoal_graph*
+	get_graph() const
+	{
+		return graph_;
+	}
+
+	size_t
+	mem() override;
+
+private:
+	subgoal_graph* graph_;
+	pad_id start_  = pad_id::max();
+	pad_id target_ = pad_id::max();
+	// edges from the start, into the target, and into local subgoals next
+	// to the target, for the current search
+	std::vector<std::pair<pad_id, cost_t>> start_edges_;
+	std::vector<std::pair<pad_id, cost_t>> target_edges_;
+	std::vector<std::tuple<pad_id, pad_id, cost_t>> local_edges_;
+	std::vector<pad_id> reached_;
+};
+
+} // namespace warthog::subgoal
+
+#endif // WARTHOG_SUBGOAL_SUBGOAL_EXPANSION_POLICY_H
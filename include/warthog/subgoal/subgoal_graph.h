@@ -0,0 +1,264 @@
+#ifndef WARTHOG_SUBGOAL_SUBGOAL_GRAPH_H
+#define WARTHOG_SUBGOAL_SUBGOAL_GRAPH_H
+
+// subgoal/subgoal_graph.h
+//
+// Simple subgoal graphs (SSG) and two-level subgoal graphs (TSG) for
+// octile grids (Uras, Koenig and Hernandez, 2013).
+//
+// A subgoal is a traversable cell at a convex corner of an obstacle: some
+// diagonal neighbour is blocked while the two cardinal neighbours next to
+// it are not. Two cells are h-reachable if a path between them has the
+// octile distance as its length, and direct-h-reachable if in addition no
+// such path passes through a subgoal. The SSG joins every pair of
+// direct-h-reachable subgoals with an edge whose cost is their octile
+// distance. A shortest path on the grid can be found by connecting the
+// start and target to the subgoals direct-h-reachable from them and
+// searching the graph.
+//
+// A TSG additionally marks some subgoals as local: a subgoal is local if
+// its neighbours are not local and every pair of its neighbours is
+// joined, either by an existing edge or by a new edge through the
+// subgoal whose cost is still the octile distance. The remaining global
+// subgoals form a smaller graph which, together with the local subgoals
+// next to the start and target, still contains a shortest path.
+//
+// The graph is stored in CSR form and is read in place, from a memory
+// mapped file with layout:
+//
+//   ssg_header
+//   uint32_t cell[num_nodes]           padded id of each subgoal; global
+//                                      subgoals first
+//   uint32_t offset[num_nodes + 1]     index of the first edge of each node
+//   ssg_edge edge[num_edges]
+//
+// Edges between global subgoals are stored at both ends. A local subgoal
+// keeps the edges it had when it became local, all of which lead to
+// global subgoals; these are not stored at the other end.
+//
+// @created: 2026-10-19
+//
+
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/util/mmap_file.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace warthog::subgoal
+{
+
+constexpr uint32_t SSG_MAGIC   = 0x47535357; // "WSSG"
+constexpr uint32_t SSG_VERSION = 1;
+constexpr uint32_t NO_NODE     = UINT32_MAX;
+
+struct ssg_header
+{
+	uint32_t magic_;
+	uint32_t version_;
+	// padded dimensions of the map
+	uint32_t width_;
+	uint32_t height_;
+	uint32_t num_nodes_;
+	// nodes [0, num_global_) are global subgoals, the rest are local.
+	// for a simple subgoal graph every subgoal is global.
+	uint32_t num_global_;
+	uint32_t num_edges_;
+	uint32_t reserved_;
+	// see domain::gridmap::signature
+	uint64_t signature_;
+};
+static_assert(sizeof(ssg_header) == 40);
+
+struct ssg_edge
+{
+	// node index of the other end of the edge
+	uint32_t head_;
+	// the subgoal this edge was made through when its middle subgoal
+	// became local; ::NO_NODE for an edge between direct-h-reachable
+	// subgoals
+	uint32_t via_;
+};
+
+// the byte offsets of each section of a graph file
+struct ssg_layout
+{
+	ssg_layout(uint32_t num_nodes, uint32_t num_edges)
+	{
+		cell_   = sizeof(ssg_header);
+		offset_ = cell_ + size_t{num_nodes} * sizeof(uint32_t);
+		edge_   = offset_ + (size_t{num_nodes} + 1) * sizeof(uint32_t);
+		size_   = edge_ + size_t{num_edges} * sizeof(ssg_edge);
+	}
+
+	size_t cell_;
+	size_t offset_;
+	size_t edge_;
+	size_t size_;
+};
+
+// is the padded id @param id a subgoal of @param map?
+bool
+is_subgoal(const domain::gridmap& map, pad_id id);
+
+// the octile distance between two padded ids of @param map
+cost_t
+octile_distance(const domain::gridmap& map, pad_id a, pad_id b);
+
+// append to @param out every cell direct-h-reachable from @param from for
+// which @param is_goal is true; is_goal must hold at least for every
+// subgoal. Diagonal moves are scanned first: from each cell reached
+// diagonally, cardinal scans are cut short where an earlier scan stopped,
+// so every cell is visited at most once per octant.
+template<class F>
+void
+get_direct_h_reachable(
+    const domain::gridmap& map, pad_id from, F&& is_goal,
+    std::vector<pad_id>& out)
+{
+	const int64_t w       = map.width();
+	const int64_t card[4] = {-w, 1, w, -1}; // N, E, S, W
+	auto open = [&map](int64_t id) {
+		return map.get_label(pad_id{uint64_t(id)}) != 0;
+	};
+	// walk from @param p in direction @param d for at most @param max
+	// steps, stopping at obstacles and goals.
+	// @return the number of steps taken to cells which are not goals
+	auto scan = [&](int64_t p, int64_t d, uint32_t max) {
+		for(uint32_t k = 1; k <= max; k++)
+		{
+			int64_t q = p + k * d;
+			if(!open(q)) { return k - 1; }
+			if(is_goal(pad_id{uint64_t(q)}))
+			{
+				out.push_back(pad_id{uint64_t(q)});
+				return k - 1;
+			}
+		}
+		return max;
+	};
+
+	int64_t start = int64_t(from.id);
+	uint32_t clearance[4];
+	for(uint32_t c = 0; c < 4; c++)
+	{
+		clearance[c] = scan(start, card[c], UINT32_MAX);
+	}
+	for(uint32_t c1 = 0; c1 < 4; c1++)
+	{
+		uint32_t c2   = (c1 + 1) % 4;
+		uint32_t max1 = clearance[c1];
+		uint32_t max2 = clearance[c2];
+		int64_t diag  = card[c1] + card[c2];
+		int64_t p     = start;
+		while(open(p + card[c1]) && open(p + card[c2]) && open(p + diag))
+		{
+			p += diag;
+			if(is_goal(pad_id{uint64_t(p)}))
+			{
+				out.push_back(pad_id{uint64_t(p)});
+				break;
+			}
+			max1 = scan(p, card[c1], max1);
+			max2 = scan(p, card[c2], max2);
+		}
+	}
+}
+
+// read-only access to a subgoal graph file
+class subgoal_graph
+{
+public:
+	subgoal_graph() = default;
+
+	subgoal_graph(const subgoal_graph&) = delete;
+	subgoal_graph&
+	operator=(const subgoal_graph&)
+	    = delete;
+
+	// map the graph in @param filename. fails if the file is not a graph
+	// for @param map.
+	// @return false on failure
+	bool
+	load(const char* filename, const domain::gridmap& map);
+
+	bool
+	is_loaded() const
+	{
+		return header_ != nullptr;
+	}
+
+	uint32_t
+	get_num_nodes() const
+	{
+		return header_->num_nodes_;
+	}
+
+	uint32_t
+	get_num_edges() const
+	{
+		return header_->num_edges_;
+	}
+
+	bool
+	is_global(uint32_t node) const
+	{
+		return node < header_->num_global_;
+	}
+
+	pad_id
+	get_cell(uint32_t node) const
+	{
+		return pad_id{cell_[node]};
+	}
+
+	// the node at the padded id @param id, or ::NO_NODE
+	uint32_t
+	get_node(pad_id id) const
+	{
+		return node_[uint32_t(id.id)];
+	}
+
+	const ssg_edge*
+	edges_begin(uint32_t node) const
+	{
+		return edge_ + offset_[node];
+	}
+
+	const ssg_edge*
+	edges_end(uint32_t node) const
+	{
+		return edge_ + offset_[node + 1];
+	}
+
+	// the via of the edge between nodes @param a and @param b, ::NO_NODE
+	// for a direct edge or if there is no edge
+	uint32_t
+	get_via(uint32_t a, uint32_t b) const;
+
+	size_t
+	file_size() const
+	{
+		return file_.size();
+	}
+
+	size_t
+	mem() const
+	{
+		return sizeof(*this) + node_.capacity() * sizeof(uint32_t);
+	}
+
+private:
+	util::mmap_file file_;
+	const ssg_header* header_ = nullptr;
+	const uint32_t* cell_     = nullptr;
+	const uint32_t* offset_   = nullptr;
+	const ssg_edge* edge_     = nullptr;
+	// node of each padded id; rebuilt on load
+	std::vector<uint32_t> node_;
+};
+
+} // namespace warthog::subgoal
+
+#endif // WARTHOG_SUBGOAL_SUBGOAL_GRAPH_H
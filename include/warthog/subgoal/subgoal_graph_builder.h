@@ -0,0 +1,104 @@
+#ifndef WARTHOG_SUBGOAL_SUBGOAL_GRAPH_BUILDER_H
+#define WARTHOG_SUBGOAL_SUBGOAL_GRAPH_BUILDER_H
+
+// subgoal/subgoal_graph_builder.h
+//
+// Offline construction of a simple or two-level subgoal graph (see
+// subgoal/subgoal_graph.h).
+//
+// The direct-h-reachable subgoals of every subgoal are found
+// independently, so the scans are distributed over all cores with
+// util::parallel_compute. Edges are then made symmetric.
+//
+// For a two-level graph, subgoals are visited in order of increasing
+// degree and made local where possible, as described in subgoal_graph.h.
+// A subgoal whose neighbours cannot all be joined, or which has a local
+// neighbour, stays global. This pass is sequential; its cost grows with
+// the square of the degree, and subgoals with more than
+// ::MAX_LOCAL_DEGREE neighbours are always global.
+//
+// @created: 2026-10-19
+//
+
+#include "subgoal_graph.h"
+#include <warthog/domain/gridmap.h>
+
+#include <chrono>
+#include <vector>
+
+namespace warthog::subgoal
+{
+
+class subgoal_graph_builder
+{
+public:
+	static constexpr uint32_t MAX_LOCAL_DEGREE = 32;
+
+	subgoal_graph_builder(domain::gridmap* map);
+
+	subgoal_graph_builder(const subgoal_graph_builder&) = delete;
+	subgoal_graph_builder&
+	operator=(const subgoal_graph_builder&)
+	    = delete;
+
+	// find the subgoals and their edges. with @param two_level, also
+	// split the subgoals into global and local ones.
+	void
+	build(bool two_level = false);
+
+	// write the graph to @param filename, in the layout described in
+	// subgoal/subgoal_graph.h
+	// @return the number of bytes written, or 0 on failure
+	size_t
+	save(const char* filename) const;
+
+	// wallclock time of the last call to ::build
+	std::chrono::nanoseconds
+	get_build_time() const
+	{
+		return build_time_;
+	}
+
+	uint32_t
+	get_num_nodes() const
+	{
+		return uint32_t(cells_.size());
+	}
+
+	uint32_t
+	get_num_global() const
+	{
+		return num_global_;
+	}
+
+	uint32_t
+	get_num_edges() const;
+
+	size_t
+	mem() const;
+
+private:
+	domain::gridmap* map_;
+	// padded id of each subgoal; global subgoals first once built
+	std::vector<pad_id> cells_;
+	// subgoal at each padded id, or ::NO_NODE
+	std::vector<uint32_t> node_;
+	// sorted by head
+	std::vector<std::vector<ssg_edge>> edges_;
+	uint32_t num_global_ = 0;
+	std::chrono::nanoseconds build_time_{0};
+
+	static void*
+	build_worker_(void* params);
+
+	void
+	make_local_();
+
+	// renumber the subgoals so that global ones come first
+	void
+	sort_nodes_(const std::vector<uint8_t>& local);
+};
+
+} // namespace warthog::subgoal
+
+#endif // WARTHOG_SUBGOAL_SUBGOAL_GRAPH_BUILDER_H
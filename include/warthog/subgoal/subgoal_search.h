@@ -0,0 +1,112 @@
+#ifndef WARTHOG_SUBGOAL_SUBGOAL_SEARCH_H
+#define WARTHOG_SUBGOAL_SUBGOAL_SEARCH_H
+
+// subgoal/subgoal_search.h
+//
+// Optimal grid pathfinding with a simple or two-level subgoal graph. A
+// query is answered in two steps:
+//
+//  1. A* over the subgoal graph, with the start and target connected to
+//     it (see subgoal_expansion_policy).
+//  2. Refinement: every edge on the path is replaced by a grid path. An
+//     edge made through a local subgoal is split at that subgoal; an edge
+//     between h-reachable cells is walked with diagonal moves first, or
+//     from its other end if that is blocked. A* over
+//     gridmap_expansion_policy is the last resort, and is only needed if
+//     the map changed behind the graph.
+//
+// ::get_pathcost stops after step 1.
+//
+// @created: 2026-10-19
+//
+
+#include "subgoal_expansion_policy.h"
+#include "subgoal_graph.h"
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/search/search_parameters.h>
+#include <warthog/search/solution.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <vector>
+
+namespace warthog::subgoal
+{
+
+class subgoal_search
+{
+public:
+	subgoal_search(domain::gridmap* map, subgoal_graph* graph);
+
+	subgoal_search(const subgoal_search&) = delete;
+	subgoal_search&
+	operator=(const subgoal_search&)
+	    = delete;
+
+	void
+	get_path(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	void
+	get_pathcost(
+	    search::problem_instance* pi, search::search_parameters* par,
+	    search::solution* sol);
+
+	// the grid expander used for refinement
+	search::gridmap_expansion_policy*
+	get_expander()
+	{
+		return &refine_expander_;
+	}
+
+	subgoal_expansion_policy*
+	get_abstract_expander()
+	{
+		return &abstract_expander_;
+	}
+
+	size_t
+	mem();
+
+private:
+	template<class E>
+	using astar = search::unidirectional_search<
+	    heuristic::octile_heuristic, E, util::pqueue_min,
+	    search::dummy_listener, search::admissibility_criteria::w_admissible,
+	    search::feasibility_criteria::until_cutoff>;
+
+	domain::gridmap* map_;
+	subgoal_graph* graph_;
+	heuristic::octile_heuristic heuristic_;
+	subgoal_expansion_policy abstract_expander_;
+	search::gridmap_expansion_policy refine_expander_;
+	util::pqueue_min abstract_open_;
+	util::pqueue_min refine_open_;
+	astar<subgoal_expansion_policy> abstract_;
+	astar<search::gridmap_expansion_policy> refine_;
+	search::solution abstract_sol_;
+	search::solution segment_;
+	std::vector<pad_id> path_;
+
+	// append a grid path from @param from to @param to, without @param
+	// from, to ::path_
+	// @return false if there is no such path
+	bool
+	refine_edge_(pad_id from, pad_id to, search::search_metrics& met);
+
+	// append the h-reachable path from @param from to @param to which
+	// starts with diagonal moves, if it is not blocked
+	bool
+	walk_(pad_id from, pad_id to);
+
+	static void
+	add_metrics_(
+	    search::search_metrics& to, const search::search_metrics& from);
+};
+
+} // namespace warthog::subgoal
+
+#endif // WARTHOG_SUBGOAL_SUBGOAL_SEARCH_H
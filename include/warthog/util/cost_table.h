@@ -50,6 +50,12 @@ public:
 		return costs_[index];
 	}
 
+	warthog::cost_t
+	operator[](uint8_t index) const
+	{
+		return costs_[index];
+	}
+
 private:
 	std::array<warthog::cost_t, 256> costs_;
 };
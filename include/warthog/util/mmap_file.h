@@ -0,0 +1,64 @@
+#ifndef WARTHOG_UTIL_MMAP_FILE_H
+#define WARTHOG_UTIL_MMAP_FILE_H
+
+// util/mmap_file.h
+//
+// A read-only memory mapping of a file. Precomputed data (path databases,
+// heuristic tables, etc.) is written in a fixed binary layout so that it
+// can be used in place, without parsing; pages are loaded on demand and
+// shared between processes using the same file.
+//
+// @created: 2026-10-19
+//
+
+#include <cstddef>
+#include <cstdint>
+
+namespace warthog::util
+{
+
+class mmap_file
+{
+public:
+	mmap_file() = default;
+	~mmap_file();
+
+	mmap_file(const mmap_file&) = delete;
+	mmap_file&
+	operator=(const mmap_file&)
+	    = delete;
+
+	// map @param filename, unmapping any file mapped before
+	// @return false if the file cannot be opened or mapped
+	bool
+	open(const char* filename);
+
+	void
+	close();
+
+	bool
+	is_open() const
+	{
+		return data_ != nullptr;
+	}
+
+	const uint8_t*
+	data() const
+	{
+		return data_;
+	}
+
+	size_t
+	size() const
+	{
+		return size_;
+	}
+
+private:
+	const uint8_t* data_ = nullptr;
+	size_t size_         = 0;
+};
+
+} // namespace warthog::util
+
+#endif // WARTHOG_UTIL_MMAP_FILE_H
@@ -0,0 +1,101 @@
+#ifndef WARTHOG_UTIL_SPSC_QUEUE_H
+#define WARTHOG_UTIL_SPSC_QUEUE_H
+
+// util/spsc_queue.h
+//
+// A bounded, lock-free, single-producer single-consumer ring buffer.
+// Exactly one thread may call ::push and exactly one (other) thread may
+// call ::pop. Neither call ever blocks; ::push fails when the queue is
+// full and ::pop fails when it is empty.
+//
+// @created: 2026-10-19
+//
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+namespace warthog::util
+{
+
+template<class T>
+class spsc_queue
+{
+public:
+	// @param capacity is rounded up to a power of two
+	explicit spsc_queue(size_t capacity)
+	    : capacity_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)),
+	      buf_(new T[capacity_])
+	{ }
+
+	spsc_queue(const spsc_queue&) = delete;
+	spsc_queue&
+	operator=(const spsc_queue&)
+	    = delete;
+
+	bool
+	push(const T& value)
+	{
+		size_t tail = tail_.load(std::memory_order_relaxed);
+		if(tail - head_cache_ == capacity_)
+		{
+			head_cache_ = head_.load(std::memory_order_acquire);
+			if(tail - head_cache_ == capacity_) { return false; }
+		}
+		buf_[tail & (capacity_ - 1)] = value;
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool
+	pop(T& value)
+	{
+		size_t head = head_.load(std::memory_order_relaxed);
+		if(head == tail_cache_)
+		{
+			tail_cache_ = tail_.load(std::memory_order_acquire);
+			if(head == tail_cache_) { return false; }
+		}
+		value = buf_[head & (capacity_ - 1)];
+		head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// approximate when called concurrently with ::push or ::pop
+	bool
+	empty() const
+	{
+		return head_.load(std::memory_order_acquire)
+		    == tail_.load(std::memory_order_acquire);
+	}
+
+	size_t
+	capacity() const
+	{
+		return capacity_;
+	}
+
+	size_t
+	mem() const
+	{
+		return capacity_ * sizeof(T) + sizeof(*this);
+	}
+
+private:
+	const size_t capacity_;
+	std::unique_ptr<T[]> buf_;
+
+	// consumer side
+	alignas(64) std::atomic<size_t> head_ = 0;
+	size_t tail_cache_                    = 0;
+
+	// producer side
+	alignas(64) std::atomic<size_t> tail_ = 0;
+	size_t head_cache_                    = 0;
+};
+
+} // namespace warthog::util
+
+#endif // WARTHOG_UTIL_SPSC_QUEUE_H
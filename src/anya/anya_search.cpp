@@ -0,0 +1,671 @@
+#include <warthog/anya/anya_search.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace warthog::anya
+{
+
+namespace
+{
+
+constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+// interval ends are projections of grid points and are compared with a
+// tolerance; ends this close to a grid point are snapped onto it
+constexpr double EPS = 1e-8;
+
+double
+snap(double x)
+{
+	double r = std::round(x);
+	return std::fabs(x - r) < EPS ? r : x;
+}
+
+bool
+is_point(double x)
+{
+	return std::fabs(x - std::round(x)) < EPS;
+}
+
+double
+distance(double x1, double y1, double x2, double y2)
+{
+	return std::sqrt((x1 - x2) * (x1 - x2) + (y1 - y2) * (y1 - y2));
+}
+
+// ordering of the open list: least f first, ties to the greatest g
+struct open_after
+{
+	template<class T>
+	bool
+	operator()(const T& a, const T& b) const
+	{
+		return a.f_ > b.f_ || (a.f_ == b.f_ && a.g_ < b.g_);
+	}
+};
+
+} // namespace
+
+anya_search::anya_search(domain::gridmap* map)
+    : map_(map), expander_(map), width_(int32_t(map->header_width())),
+      height_(int32_t(map->header_height())),
+      words_per_row_(map->width() / 64), target_x_(0), target_y_(0),
+      met_(nullptr), stamp_(0)
+{
+	// only used to convert coordinates
+	expander_.set_nodes_pool_size(0);
+	root_g_.resize(size_t(width_ + 1) * size_t(height_ + 1));
+	root_stamp_.resize(root_g_.size(), 0);
+}
+
+size_t
+anya_search::node_key_hash::operator()(const node_key& k) const noexcept
+{
+	size_t h = std::hash<double>{}(k.left_);
+	h        = h * 31 + std::hash<double>{}(k.right_);
+	h        = h * 31 + size_t(uint32_t(k.row_));
+	h        = h * 31 + k.root_;
+	return h * 4 + size_t(k.left_open_) * 2 + size_t(k.right_open_);
+}
+
+bool
+anya_search::free_(int32_t x, int32_t y) const
+{
+	if(x < 0 || y < 0 || x >= width_ || y >= height_) { return false; }
+	return map_->get_label(map_->to_padded_id_from_unpadded(x, y));
+}
+
+uint64_t
+anya_search::word_(int32_t cy, uint32_t k) const
+{
+	// padded rows start on a 64-bit boundary; the rows just outside the
+	// map and the cells past the end of each row are padding (blocked)
+	uint32_t first = uint32_t(cy + int32_t(domain::gridmap::PADDED_ROWS))
+	        * map_->width()
+	    + 64 * k;
+	return map_->get_neighbours_slider(pad_id{first}).get_block_64bit_le();
+}
+
+int32_t
+anya_search::scan_right_(int32_t cy, int32_t x, bool state) const
+{
+	if(x >= width_) { return width_; }
+	uint64_t flip = state ? ~uint64_t{0} : 0;
+	uint32_t k    = uint32_t(x) >> 6;
+	uint64_t bits = (word_(cy, k) ^ flip) & (~uint64_t{0} << (x & 63));
+	while(bits == 0)
+	{
+		if(++k >= words_per_row_) { return width_; }
+		bits = word_(cy, k) ^ flip;
+	}
+	return std::min(int32_t(64 * k) + std::countr_zero(bits), width_);
+}
+
+int32_t
+anya_search::scan_left_(int32_t cy, int32_t x, bool state) const
+{
+	if(x < 0) { return -1; }
+	uint64_t flip = state ? ~uint64_t{0} : 0;
+	uint32_t k    = uint32_t(x) >> 6;
+	uint64_t mask = (x & 63) == 63 ? ~uint64_t{0}
+	                               : (uint64_t{1} << ((x & 63) + 1)) - 1;
+	uint64_t bits = (word_(cy, k) ^ flip) & mask;
+	while(bits == 0)
+	{
+		if(k == 0) { return -1; }
+		bits = word_(cy, --k) ^ flip;
+	}
+	return int32_t(64 * k) + 63 - std::countl_zero(bits);
+}
+
+void
+anya_search::run_(int32_t cy, int32_t x, int32_t& lo, int32_t& hi) const
+{
+	assert(free_(x, cy));
+	lo = scan_left_(cy, x, true) + 1;
+	hi = scan_right_(cy, x, true);
+}
+
+int32_t
+anya_search::next_corner_(int32_t y, int32_t x) const
+{
+	if(x >= width_) { return width_; }
+	int32_t above = scan_right_(y - 1, x, free_(x, y - 1));
+	int32_t below = scan_right_(y, x, free_(x, y));
+	return std::min(above, below);
+}
+
+int32_t
+anya_search::prev_corner_(int32_t y, int32_t x) const
+{
+	if(x <= 0) { return 0; }
+	int32_t above = scan_left_(y - 1, x - 1, free_(x - 1, y - 1)) + 1;
+	int32_t below = scan_left_(y, x - 1, free_(x - 1, y)) + 1;
+	return std::max(above, below);
+}
+
+void
+anya_search::words_(
+    int32_t y, uint32_t k, uint64_t& above, uint64_t& below,
+    uint64_t& prev_above, uint64_t& prev_below) const
+{
+	above      = word_(y - 1, k);
+	below      = word_(y, k);
+	prev_above = (above << 1) | (k ? word_(y - 1, k - 1) >> 63 : 0);
+	prev_below = (below << 1) | (k ? word_(y, k - 1) >> 63 : 0);
+}
+
+bool
+anya_search::double_corner_(int32_t x, int32_t y) const
+{
+	bool nw = free_(x - 1, y - 1), ne = free_(x, y - 1);
+	bool sw = free_(x - 1, y), se = free_(x, y);
+	return (nw && se && !ne && !sw) || (ne && sw && !nw && !se);
+}
+
+int32_t
+anya_search::flat_end_right_(int32_t y, int32_t x) const
+{
+	if(x >= width_) { return width_; }
+	uint64_t a, b, pa, pb;
+	uint32_t k = uint32_t(x) >> 6;
+	// edges [c, c + 1] from x on, double corners after x
+	uint64_t edge_mask   = ~uint64_t{0} << (x & 63);
+	uint64_t corner_mask = edge_mask << 1;
+	while(true)
+	{
+		words_(y, k, a, b, pa, pb);
+		uint64_t blocked = ~(a | b);
+		uint64_t corners = (pa & b & ~a & ~pb) | (a & pb & ~pa & ~b);
+		uint64_t bits    = (blocked & edge_mask) | (corners & corner_mask);
+		if(bits)
+		{
+			return std::min(int32_t(64 * k) + std::countr_zero(bits), width_);
+		}
+		if(++k >= words_per_row_) { return width_; }
+		edge_mask = corner_mask = ~uint64_t{0};
+	}
+}
+
+int32_t
+anya_search::flat_end_left_(int32_t y, int32_t x) const
+{
+	if(x <= 0) { return 0; }
+	uint64_t a, b, pa, pb;
+	uint32_t k = uint32_t(x) >> 6;
+	// edges [q - 1, q] up to x, double corners before x
+	uint64_t corner_mask = (uint64_t{1} << (x & 63)) - 1;
+	uint64_t edge_mask   = (corner_mask << 1) | 1;
+	while(true)
+	{
+		words_(y, k, a, b, pa, pb);
+		uint64_t blocked = ~(pa | pb);
+		uint64_t corners = (pa & b & ~a & ~pb) | (a & pb & ~pa & ~b);
+		uint64_t bits    = (blocked & edge_mask) | (corners & corner_mask);
+		if(bits) { return int32_t(64 * k) + 63 - std::countl_zero(bits); }
+		if(k-- == 0) { return 0; }
+		edge_mask = corner_mask = ~uint64_t{0};
+	}
+}
+
+double
+anya_search::heuristic_(const node& n) const
+{
+	// the shortest path from the root through the interval to the
+	// target; if the root and target are on the same side of the row,
+	// the target is mirrored to the other side
+	double rx = n.root_x_, ry = n.root_y_;
+	double tx = target_x_, ty = target_y_;
+	double y  = n.row_;
+	double px;
+	if(ty == y) { px = tx; }
+	else if(ry == y) { px = rx; }
+	else
+	{
+		double my = (ty - y) * (ry - y) > 0 ? 2 * y - ty : ty;
+		px        = rx + (tx - rx) * (y - ry) / (my - ry);
+	}
+	px = std::clamp(px, n.left_, n.right_);
+	return distance(rx, ry, px, y) + distance(px, y, tx, ty);
+}
+
+void
+anya_search::push_(const node& n)
+{
+	uint32_t root = uint32_t(n.root_y_) * uint32_t(width_ + 1)
+	    + uint32_t(n.root_x_);
+	auto [it, added] = generated_.try_emplace(
+	    {n.left_, n.right_, n.row_, root, n.left_open_, n.right_open_}, n.g_);
+	if(!added)
+	{
+		if(n.g_ > it->second - EPS) { return; }
+		it->second = n.g_;
+	}
+
+	node m = n;
+	m.f_   = m.g_ + heuristic_(m);
+	nodes_.push_back(m);
+	open_.push_back({m.f_, m.g_, uint32_t(nodes_.size() - 1)});
+	std::push_heap(open_.begin(), open_.end(), open_after{});
+	met_->nodes_generated_++;
+	met_->heap_ops_++;
+}
+
+void
+anya_search::push_cone_(
+    double lo, bool lo_open, double hi, bool hi_open, int32_t row,
+    int32_t rx, int32_t ry, double g, uint32_t parent)
+{
+	lo = snap(std::max(lo, 0.0));
+	hi = snap(std::min(hi, double(width_)));
+	if(lo > hi + EPS) { return; }
+	hi = std::max(lo, hi);
+	if(hi - lo < EPS && (lo_open || hi_open)) { return; }
+
+	// split at corners, so that paths only turn at the ends of intervals
+	node n{lo, hi, row, rx, ry, parent, g, 0, lo_open, false};
+	while(true)
+	{
+		int32_t q = next_corner_(row, int32_t(std::floor(n.left_)));
+		if(q >= hi - EPS)
+		{
+			n.right_      = hi;
+			n.right_open_ = hi_open;
+			push_(n);
+			return;
+		}
+		n.right_ = q;
+		push_(n);
+		n.left_      = q;
+		n.left_open_ = false;
+	}
+}
+
+bool
+anya_search::turns_(double x, bool open, int32_t y) const
+{
+	return !open && is_point(x) && !double_corner_(int32_t(std::round(x)), y);
+}
+
+bool
+anya_search::relax_root_(int32_t x, int32_t y, double g)
+{
+	size_t id = size_t(y) * size_t(width_ + 1) + size_t(x);
+	if(root_stamp_[id] == stamp_)
+	{
+		if(g > root_g_[id] + EPS) { return false; }
+		root_g_[id] = std::min(root_g_[id], g);
+		return true;
+	}
+	root_stamp_[id] = stamp_;
+	root_g_[id]     = g;
+	return true;
+}
+
+void
+anya_search::expand_start_(uint32_t index)
+{
+	node s     = nodes_[index];
+	int32_t sx = s.root_x_, sy = s.root_y_;
+
+	int32_t e = flat_end_right_(sy, sx);
+	if(e > sx)
+	{
+		double q = std::min(e, next_corner_(sy, sx));
+		push_({double(sx), q, sy, sx, sy, index, 0, 0});
+	}
+	e = flat_end_left_(sy, sx);
+	if(e < sx)
+	{
+		double q = std::max(e, prev_corner_(sy, sx));
+		push_({q, double(sx), sy, sx, sy, index, 0, 0});
+	}
+
+	// the rows above and below, through the cells on either side of sx
+	for(int32_t d : {-1, 1})
+	{
+		int32_t cy = d > 0 ? sy : sy - 1;
+		int32_t lo = std::numeric_limits<int32_t>::max();
+		int32_t hi = std::numeric_limits<int32_t>::min();
+		int32_t c, f;
+		if(free_(sx - 1, cy))
+		{
+			run_(cy, sx - 1, c, f);
+			lo = std::min(lo, c);
+			hi = std::max(hi, f);
+		}
+		if(free_(sx, cy))
+		{
+			run_(cy, sx, c, f);
+			lo = std::min(lo, c);
+			hi = std::max(hi, f);
+		}
+		if(lo <= hi)
+		{
+			push_cone_(lo, false, hi, false, sy + d, sx, sy, 0, index);
+		}
+	}
+}
+
+void
+anya_search::expand_flat_(uint32_t index)
+{
+	node n     = nodes_[index];
+	int32_t y  = n.row_;
+	bool right = n.right_ > n.root_x_;
+	int32_t p  = int32_t(std::round(right ? n.right_ : n.left_));
+	double pg  = n.g_ + distance(n.root_x_, n.root_y_, p, y);
+	int32_t lo, hi;
+	// the row ends here, and passing the corner would squeeze through it
+	if(double_corner_(p, y)) { return; }
+
+	if(right)
+	{
+		// the row continues in sight of the root
+		int32_t e = flat_end_right_(y, p);
+		if(e > p)
+		{
+			double q = std::min(e, next_corner_(y, p));
+			push_({double(p), q, y, n.root_x_, n.root_y_, index, n.g_, 0});
+		}
+
+		// turn around the end of an obstacle below or above the row
+		if(!free_(p - 1, y) && free_(p, y) && relax_root_(p, y, pg))
+		{
+			run_(y, p, lo, hi);
+			push_cone_(p, false, hi, false, y + 1, p, y, pg, index);
+		}
+		if(!free_(p - 1, y - 1) && free_(p, y - 1) && relax_root_(p, y, pg))
+		{
+			run_(y - 1, p, lo, hi);
+			push_cone_(p, false, hi, false, y - 1, p, y, pg, index);
+		}
+		return;
+	}
+
+	int32_t e = flat_end_left_(y, p);
+	if(e < p)
+	{
+		double q = std::max(e, prev_corner_(y, p));
+		push_({q, double(p), y, n.root_x_, n.root_y_, index, n.g_, 0});
+	}
+	if(!free_(p, y) && free_(p - 1, y) && relax_root_(p, y, pg))
+	{
+		run_(y, p - 1, lo, hi);
+		push_cone_(lo, false, p, false, y + 1, p, y, pg, index);
+	}
+	if(!free_(p, y - 1) && free_(p - 1, y - 1) && relax_root_(p, y, pg))
+	{
+		run_(y - 1, p - 1, lo, hi);
+		push_cone_(lo, false, p, false, y - 1, p, y, pg, index);
+	}
+}
+
+void
+anya_search::expand_cone_(uint32_t index)
+{
+	node n     = nodes_[index];
+	int32_t rx = n.root_x_, ry = n.root_y_;
+	int32_t y  = n.row_;
+	int32_t d  = y > ry ? 1 : -1;
+	int32_t y2 = y + d;
+	// the cells behind the interval (towards the root) and in front of it
+	int32_t cb    = d > 0 ? y - 1 : y;
+	int32_t cf    = d > 0 ? y : y - 1;
+	bool has_next = y2 >= 0 && y2 <= height_;
+	double scale  = double(y2 - ry) / double(y - ry);
+	auto project  = [&](double x) { return rx + (x - rx) * scale; };
+	int32_t c, e;
+
+	// observable successors: the interval seen through each run of free
+	// cells in front of it
+	if(has_next)
+	{
+		int32_t i    = std::max(0, int32_t(std::ceil(n.left_ - EPS)) - 1);
+		int32_t last
+		    = std::min(width_ - 1, int32_t(std::floor(n.right_ + EPS)));
+		while(i <= last)
+		{
+			int32_t j = free_(i, cf) ? i : scan_right_(cf, i, false);
+			if(j > last) { break; }
+			run_(cf, j, c, e);
+
+			// the part of the interval over the run; a ray through a side
+			// of the run at a double corner squeezes through it
+			double lo = n.left_, hi = n.right_;
+			bool lo_open = n.left_open_, hi_open = n.right_open_;
+			if(c > lo - EPS)
+			{
+				lo_open = (c < lo + EPS && lo_open) || double_corner_(c, y);
+				lo      = c;
+			}
+			if(e < hi + EPS)
+			{
+				hi_open = (e > hi - EPS && hi_open) || double_corner_(e, y);
+				hi      = e;
+			}
+			if(lo <= hi + EPS)
+			{
+				// ends clipped by the sides of the run are reached along them
+				double plo = project(lo), phi = project(hi);
+				push_cone_(
+				    std::max(plo, double(c)), lo_open && plo > c - EPS,
+				    std::min(phi, double(e)), hi_open && phi < e + EPS, y2, rx,
+				    ry, n.g_, index);
+			}
+			i = e + 1;
+		}
+	}
+
+	// non-observable successors: paths which turn around an obstacle
+	// corner at either end of the interval. From the corner they reach the
+	// rest of its row, and the part of the next row beyond the ray from the
+	// root through the corner; all of a run in front which only touches
+	// the interval at the corner is beyond it.
+	if(turns_(n.left_, n.left_open_, y))
+	{
+		int32_t a = int32_t(std::round(n.left_));
+		double ag = n.g_ + distance(rx, ry, a, y);
+		if(!free_(a - 1, cb) && free_(a - 1, cf) && relax_root_(a, y, ag))
+		{
+			int32_t f = flat_end_left_(y, a);
+			double q  = std::max(f, prev_corner_(y, a));
+			push_({q, double(a), y, a, y, index, ag, 0});
+		}
+
+		double lo = 0, hi = -1;
+		if(has_next && free_(a - 1, cf))
+		{
+			run_(cf, a - 1, c, e);
+			lo = c;
+			if(!free_(a, cf)) { hi = e; }
+			else if(!free_(a - 1, cb))
+			{
+				hi = std::min(double(e), project(a));
+			}
+		}
+		else if(has_next && free_(a, cf))
+		{
+			run_(cf, a, c, e);
+			lo = a;
+			hi = std::min(double(e), project(a));
+		}
+		if(hi - lo > EPS && relax_root_(a, y, ag))
+		{
+			push_cone_(lo, false, hi, false, y2, a, y, ag, index);
+		}
+	}
+	if(turns_(n.right_, n.right_open_, y))
+	{
+		int32_t b = int32_t(std::round(n.right_));
+		double bg = n.g_ + distance(rx, ry, b, y);
+		if(!free_(b, cb) && free_(b, cf) && relax_root_(b, y, bg))
+		{
+			int32_t f = flat_end_right_(y, b);
+			double q  = std::min(f, next_corner_(y, b));
+			push_({double(b), q, y, b, y, index, bg, 0});
+		}
+
+		double lo = 0, hi = -1;
+		if(has_next && free_(b, cf))
+		{
+			run_(cf, b, c, e);
+			if(!free_(b - 1, cf)) { lo = c; }
+			else if(!free_(b, cb))
+			{
+				lo = std::max(double(c), project(b));
+			}
+			else { lo = e; }
+			hi = e;
+		}
+		else if(has_next && free_(b - 1, cf))
+		{
+			run_(cf, b - 1, c, e);
+			lo = std::max(double(c), project(b));
+			hi = b;
+		}
+		if(hi - lo > EPS && relax_root_(b, y, bg))
+		{
+			push_cone_(lo, false, hi, false, y2, b, y, bg, index);
+		}
+	}
+}
+
+void
+anya_search::search_(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol, bool path)
+{
+	util::timer mytimer;
+	mytimer.start();
+	nodes_.clear();
+	open_.clear();
+	generated_.clear();
+	met_ = &sol->met_;
+	if(++stamp_ == 0)
+	{
+		std::fill(root_stamp_.begin(), root_stamp_.end(), 0);
+		stamp_ = 1;
+	}
+
+	uint32_t map_size = uint32_t(width_) * uint32_t(height_);
+	if(uint32_t{pi->start_} >= map_size || uint32_t{pi->target_} >= map_size)
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+	int32_t sx = int32_t(uint32_t{pi->start_} % width_);
+	int32_t sy = int32_t(uint32_t{pi->start_} / width_);
+	target_x_  = int32_t(uint32_t{pi->target_} % width_);
+	target_y_  = int32_t(uint32_t{pi->target_} / width_);
+
+	// the start and target must be corners of some free cell
+	auto on_grid = [this](int32_t x, int32_t y) {
+		return free_(x - 1, y - 1) || free_(x, y - 1) || free_(x - 1, y)
+		    || free_(x, y);
+	};
+	if(!on_grid(sx, sy) || !on_grid(target_x_, target_y_))
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	relax_root_(sx, sy, 0);
+	push_({double(sx), double(sx), sy, sx, sy, NO_PARENT, 0, 0});
+
+	uint32_t found = NO_PARENT;
+	while(!open_.empty())
+	{
+		std::pop_heap(open_.begin(), open_.end(), open_after{});
+		uint32_t index = open_.back().node_;
+		open_.pop_back();
+		sol->met_.heap_ops_++;
+		const node& n = nodes_[index];
+
+		// skip nodes whose root has since been reached more cheaply
+		size_t rid
+		    = size_t(n.root_y_) * size_t(width_ + 1) + size_t(n.root_x_);
+		if(n.g_ > root_g_[rid] + EPS) { continue; }
+
+		double tx = target_x_;
+		if(n.row_ == target_y_
+		   && (n.left_ < tx - EPS || (!n.left_open_ && n.left_ < tx + EPS))
+		   && (tx < n.right_ - EPS || (!n.right_open_ && tx < n.right_ + EPS)))
+		{
+			found = index;
+			break;
+		}
+		if(n.f_ > par->get_max_cost_cutoff()) { break; }
+		if(sol->met_.nodes_expanded_ >= par->get_max_expansions_cutoff())
+		{
+			break;
+		}
+
+		sol->met_.nodes_expanded_++;
+		sol->met_.lb_ = n.f_;
+		if(n.parent_ == NO_PARENT) { expand_start_(index); }
+		else if(n.row_ == n.root_y_) { expand_flat_(index); }
+		else { expand_cone_(index); }
+	}
+
+	if(found != NO_PARENT)
+	{
+		const node& n = nodes_[found];
+		sol->sum_of_edge_costs_
+		    = n.g_ + distance(n.root_x_, n.root_y_, target_x_, target_y_);
+		if(path)
+		{
+			// the turning points are the distinct roots of the ancestors
+			auto add = [this, sol](int32_t x, int32_t y) {
+				pack_id id = map_->to_unpadded_id_from_unpadded(x, y);
+				if(sol->path_.empty() || sol->path_.back() != id)
+				{
+					sol->path_.push_back(id);
+				}
+			};
+			add(target_x_, target_y_);
+			for(uint32_t i = found; i != NO_PARENT; i = nodes_[i].parent_)
+			{
+				add(nodes_[i].root_x_, nodes_[i].root_y_);
+			}
+			std::reverse(sol->path_.begin(), sol->path_.end());
+		}
+	}
+
+	sol->met_.nodes_surplus_     = uint32_t(open_.size());
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+void
+anya_search::get_path(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	search_(pi, par, sol, true);
+}
+
+void
+anya_search::get_pathcost(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	search_(pi, par, sol, false);
+}
+
+size_t
+anya_search::mem()
+{
+	return sizeof(*this) + expander_.mem()
+	    + nodes_.capacity() * sizeof(node)
+	    + open_.capacity() * sizeof(open_entry)
+	    + generated_.size()
+	    * (sizeof(node_key) + sizeof(double) + sizeof(void*))
+	    + root_g_.capacity() * sizeof(double)
+	    + root_stamp_.capacity() * sizeof(uint32_t);
+}
+
+} // namespace warthog::anya
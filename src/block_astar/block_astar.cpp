@@ -0,0 +1,392 @@
+#include <warthog/block_astar/block_astar.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace warthog::block_astar
+{
+
+namespace
+{
+
+constexpr double EPS = 1e-8;
+
+// the cells of a block which are not on its border
+constexpr uint16_t INTERIOR = 0x0660;
+
+// min-heap order on f, breaking ties in favour of larger g as
+// cmp_less_search_node does
+struct open_after
+{
+	template<class Entry>
+	bool
+	operator()(const Entry& a, const Entry& b) const
+	{
+		return a.f_ > b.f_ || (a.f_ == b.f_ && a.g_ < b.g_);
+	}
+};
+
+// the moves of gridmap_expansion_policy: tiles mask, dx, dy
+struct move
+{
+	uint32_t tiles_;
+	int32_t dx_;
+	int32_t dy_;
+};
+constexpr move MOVES[8]
+    = {{514, 0, -1},  {1536, 1, 0},   {131584, 0, 1},  {768, -1, 0},
+       {1542, 1, -1}, {394752, 1, 1}, {197376, -1, 1}, {771, -1, -1}};
+
+// does the distance @param a plus @param b equal @param total?
+bool
+sums_to(uint8_t a, uint8_t b, uint8_t total)
+{
+	return (a & 15) + (b & 15) == (total & 15)
+	    && (a >> 4) + (b >> 4) == (total >> 4);
+}
+
+} // namespace
+
+block_astar::block_astar(domain::gridmap* map)
+    : map_(map), expander_(map),
+      blocks_per_row_(map->width() / lddb::BLOCK_SIZE),
+      block_rows_((map->height() + lddb::BLOCK_SIZE - 1) / lddb::BLOCK_SIZE)
+{
+	// only used to convert coordinates
+	expander_.set_nodes_pool_size(0);
+
+	uint32_t num_blocks = blocks_per_row_ * block_rows_;
+	patterns_.resize(num_blocks);
+	for(uint32_t by = 0; by < block_rows_; by++)
+	{
+		for(uint32_t bx = 0; bx < blocks_per_row_; bx++)
+		{
+			patterns_[by * blocks_per_row_ + bx] = read_pattern_(bx, by);
+		}
+	}
+
+	// the last block row may extend past the map
+	size_t cells = size_t(block_rows_) * lddb::BLOCK_SIZE * map->width();
+	g_.resize(cells);
+	parent_.resize(cells);
+	stamp_.resize(num_blocks, 0);
+	ingress_.resize(num_blocks, 0);
+	key_.resize(num_blocks);
+}
+
+uint16_t
+block_astar::read_pattern_(uint32_t bx, uint32_t by) const
+{
+	uint32_t x0 = bx * lddb::BLOCK_SIZE;
+	uint32_t y0 = by * lddb::BLOCK_SIZE;
+	uint32_t h  = map_->height();
+
+	// rows of the block, each read as the 64-bit word holding the block
+	uint64_t rows[lddb::BLOCK_SIZE] = {};
+	uint64_t tiles[3];
+	if(y0 + 2 < h)
+	{
+		map_->get_neighbours_64bit(
+		    map_->to_padded_id_from_padded(x0, y0 + 1), tiles);
+		rows[0] = tiles[0];
+		rows[1] = tiles[1];
+		rows[2] = tiles[2];
+		if(y0 + 3 < h)
+		{
+			map_->get_neighbours_64bit(
+			    map_->to_padded_id_from_padded(x0, y0 + 2), tiles);
+			rows[3] = tiles[2];
+		}
+	}
+	// otherwise the block is in the padding below the map
+
+	uint16_t pattern = 0;
+	for(uint32_t r = 0; r < lddb::BLOCK_SIZE; r++)
+	{
+		pattern |= uint16_t(((rows[r] >> (x0 & 63)) & 0xf) << (r * 4));
+	}
+	return pattern;
+}
+
+void
+block_astar::set_label(uint32_t x, uint32_t y, bool label)
+{
+	map_->set_label(x, y, label);
+	uint32_t px, py;
+	map_->to_padded_xy(map_->to_padded_id_from_unpadded(x, y), px, py);
+	patterns_[block_(px, py)] = read_pattern_(
+	    px / lddb::BLOCK_SIZE, py / lddb::BLOCK_SIZE);
+}
+
+double
+block_astar::heuristic_(uint32_t x, uint32_t y) const
+{
+	uint32_t dx = x > target_x_ ? x - target_x_ : target_x_ - x;
+	uint32_t dy = y > target_y_ ? y - target_y_ : target_y_ - y;
+	uint32_t d  = std::min(dx, dy);
+	return d * warthog::DBL_ROOT_TWO + (std::max(dx, dy) - d);
+}
+
+void
+block_astar::touch_(uint32_t block)
+{
+	if(stamp_[block] == search_stamp_) { return; }
+	stamp_[block]   = search_stamp_;
+	ingress_[block] = 0;
+	key_[block]     = warthog::COST_MAX;
+	for(uint32_t i = 0; i < lddb::CELLS; i++)
+	{
+		g_[cell_(block, i).id] = warthog::COST_MAX;
+	}
+}
+
+void
+block_astar::relax_(uint32_t x, uint32_t y, double g, pad_id from)
+{
+	uint32_t block = block_(x, y);
+	touch_(block);
+	pad_id id = map_->to_padded_id_from_padded(x, y);
+	if(g >= g_[id.id] - EPS) { return; }
+	g_[id.id]      = g;
+	parent_[id.id] = from.id;
+	met_->nodes_generated_++;
+	if(id == target_) { target_g_ = std::min(target_g_, g); }
+
+	ingress_[block] |= uint16_t(1u << index_(x, y));
+	double f         = g + heuristic_(x, y);
+	if(f < key_[block])
+	{
+		key_[block] = f;
+		open_.push_back({f, g, block});
+		std::push_heap(open_.begin(), open_.end(), open_after{});
+		met_->heap_ops_++;
+	}
+}
+
+void
+block_astar::expand_(uint32_t block)
+{
+	uint16_t ingress    = ingress_[block];
+	ingress_[block]     = 0;
+	key_[block]         = warthog::COST_MAX;
+	const uint8_t* dist = lddb_.get(patterns_[block]);
+
+	pad_id cells[lddb::CELLS];
+	for(uint32_t i = 0; i < lddb::CELLS; i++)
+	{
+		cells[i] = cell_(block, i);
+	}
+
+	// carry the new g-values of the ingress cells across the block
+	uint16_t changed = ingress;
+	for(uint32_t in = ingress; in; in &= in - 1)
+	{
+		uint32_t u = uint32_t(std::countr_zero(in));
+		double g   = g_[cells[u].id];
+		for(uint32_t c = 0; c < lddb::CELLS; c++)
+		{
+			uint8_t d = dist[u * lddb::CELLS + c];
+			if(d == lddb::NONE || c == u) { continue; }
+			double gc = g + lddb_.cost(d);
+			if(gc >= g_[cells[c].id] - EPS) { continue; }
+			g_[cells[c].id]      = gc;
+			parent_[cells[c].id] = cells[u].id;
+			changed              |= uint16_t(1u << c);
+		}
+	}
+	if(block == block_(target_x_, target_y_))
+	{
+		target_g_ = std::min(target_g_, g_[target_.id]);
+	}
+
+	// and from the border into the neighbouring blocks
+	for(uint32_t out = changed & ~INTERIOR; out; out &= out - 1)
+	{
+		uint32_t c = uint32_t(std::countr_zero(out));
+		int32_t cx = int32_t(c % lddb::BLOCK_SIZE);
+		int32_t cy = int32_t(c / lddb::BLOCK_SIZE);
+		uint32_t x, y;
+		map_->to_padded_xy(cells[c], x, y);
+		uint32_t tiles = 0;
+		map_->get_neighbours(cells[c], (uint8_t*)&tiles);
+		double g = g_[cells[c].id];
+		for(const move& m : MOVES)
+		{
+			if((tiles & m.tiles_) != m.tiles_) { continue; }
+			if(cx + m.dx_ >= 0 && cx + m.dx_ < int32_t(lddb::BLOCK_SIZE)
+			   && cy + m.dy_ >= 0 && cy + m.dy_ < int32_t(lddb::BLOCK_SIZE))
+			{
+				continue;
+			}
+			double cost
+			    = m.dx_ != 0 && m.dy_ != 0 ? warthog::DBL_ROOT_TWO : 1;
+			relax_(x + m.dx_, y + m.dy_, g + cost, cells[c]);
+		}
+	}
+}
+
+void
+block_astar::local_path_(
+    uint32_t block, uint32_t from, uint32_t to, std::vector<pad_id>& out)
+{
+	const uint8_t* dist = lddb_.get(patterns_[block]);
+	uint32_t between[lddb::CELLS];
+	uint32_t num = 0;
+	for(uint32_t cur = from; cur != to;)
+	{
+		int32_t cx = int32_t(cur % lddb::BLOCK_SIZE);
+		int32_t cy = int32_t(cur / lddb::BLOCK_SIZE);
+		for(const move& m : MOVES)
+		{
+			int32_t nx = cx + m.dx_;
+			int32_t ny = cy + m.dy_;
+			if(nx < 0 || nx >= int32_t(lddb::BLOCK_SIZE) || ny < 0
+			   || ny >= int32_t(lddb::BLOCK_SIZE))
+			{
+				continue;
+			}
+			uint32_t next = uint32_t(ny) * lddb::BLOCK_SIZE + uint32_t(nx);
+			uint8_t step  = dist[cur * lddb::CELLS + next];
+			if(step != (m.dx_ != 0 && m.dy_ != 0 ? lddb::DIAGONAL
+			                                     : lddb::CARDINAL))
+			{
+				continue;
+			}
+			if(sums_to(
+			       step, dist[next * lddb::CELLS + to],
+			       dist[cur * lddb::CELLS + to]))
+			{
+				cur = next;
+				break;
+			}
+		}
+		if(cur != to) { between[num++] = cur; }
+	}
+	while(num > 0)
+	{
+		out.push_back(cell_(block, between[--num]));
+	}
+}
+
+void
+block_astar::search_(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol, bool path)
+{
+	util::timer mytimer;
+	mytimer.start();
+	open_.clear();
+	met_ = &sol->met_;
+	if(++search_stamp_ == 0)
+	{
+		std::fill(stamp_.begin(), stamp_.end(), 0);
+		search_stamp_ = 1;
+	}
+
+	uint32_t map_size = map_->header_width() * map_->header_height();
+	if(uint32_t{pi->start_} >= map_size || uint32_t{pi->target_} >= map_size)
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+	pad_id start = map_->to_padded_id(pi->start_);
+	target_      = map_->to_padded_id(pi->target_);
+	if(!map_->get_label(start) || !map_->get_label(target_))
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+	uint32_t sx, sy;
+	map_->to_padded_xy(start, sx, sy);
+	map_->to_padded_xy(target_, target_x_, target_y_);
+
+	uint32_t block = block_(sx, sy);
+	touch_(block);
+	g_[start.id]      = 0;
+	parent_[start.id] = start.id;
+	ingress_[block]   = uint16_t(1u << index_(sx, sy));
+	key_[block]       = heuristic_(sx, sy);
+	open_.push_back({key_[block], 0, block});
+	target_g_ = start == target_ ? 0 : warthog::COST_MAX;
+
+	while(!open_.empty())
+	{
+		std::pop_heap(open_.begin(), open_.end(), open_after{});
+		open_entry e = open_.back();
+		open_.pop_back();
+		sol->met_.heap_ops_++;
+
+		// skip blocks since queued with a smaller key, or expanded
+		if(e.f_ != key_[e.block_]) { continue; }
+		if(e.f_ >= target_g_ - EPS) { break; }
+		if(e.f_ > par->get_max_cost_cutoff()) { break; }
+		if(sol->met_.nodes_expanded_ >= par->get_max_expansions_cutoff())
+		{
+			break;
+		}
+
+		sol->met_.nodes_expanded_++;
+		sol->met_.lb_ = e.f_;
+		expand_(e.block_);
+	}
+
+	if(target_g_ < warthog::COST_MAX)
+	{
+		sol->sum_of_edge_costs_ = target_g_;
+		if(path)
+		{
+			std::vector<pad_id> cells{target_};
+			for(pad_id cur = target_; cur != start;)
+			{
+				pad_id prev{parent_[cur.id]};
+				uint32_t cx, cy, px, py;
+				map_->to_padded_xy(cur, cx, cy);
+				map_->to_padded_xy(prev, px, py);
+				uint32_t b = block_(cx, cy);
+				if(b == block_(px, py))
+				{
+					local_path_(b, index_(px, py), index_(cx, cy), cells);
+				}
+				cells.push_back(prev);
+				cur = prev;
+			}
+			for(auto it = cells.rbegin(); it != cells.rend(); ++it)
+			{
+				sol->path_.push_back(map_->to_unpadded_id(*it));
+			}
+		}
+	}
+
+	sol->met_.nodes_surplus_     = uint32_t(open_.size());
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+void
+block_astar::get_path(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	search_(pi, par, sol, true);
+}
+
+void
+block_astar::get_pathcost(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	search_(pi, par, sol, false);
+}
+
+size_t
+block_astar::mem()
+{
+	return sizeof(*this) + expander_.mem() + lddb_.mem()
+	    + patterns_.capacity() * sizeof(uint16_t)
+	    + (g_.capacity() + key_.capacity()) * sizeof(double)
+	    + (parent_.capacity() + stamp_.capacity()) * sizeof(uint32_t)
+	    + ingress_.capacity() * sizeof(uint16_t)
+	    + open_.capacity() * sizeof(open_entry);
+}
+
+} // namespace warthog::block_astar
@@ -0,0 +1,87 @@
+#include <warthog/block_astar/lddb.h>
+
+namespace warthog::block_astar
+{
+
+lddb::lddb()
+    : table_(size_t(PATTERNS) * CELLS * CELLS), computed_(PATTERNS / 64, 0)
+{
+	for(uint32_t d = 0; d < 256; d++)
+	{
+		costs_[d] = (d & 15) + (d >> 4) * warthog::DBL_ROOT_TWO;
+	}
+	costs_[NONE] = warthog::COST_MAX;
+}
+
+void
+lddb::compute_(uint16_t pattern)
+{
+	auto free = [pattern](int32_t x, int32_t y) {
+		return x >= 0 && x < int32_t(BLOCK_SIZE) && y >= 0
+		    && y < int32_t(BLOCK_SIZE)
+		    && (pattern & (1u << (y * BLOCK_SIZE + x)));
+	};
+
+	uint8_t* dist = &table_[size_t(pattern) * CELLS * CELLS];
+	std::fill_n(dist, CELLS * CELLS, NONE);
+	for(uint32_t from = 0; from < CELLS; from++)
+	{
+		if(!(pattern & (1u << from))) { continue; }
+
+		// dijkstra over the 16 cells
+		uint8_t* d = dist + from * CELLS;
+		bool closed[CELLS] = {};
+		d[from]            = 0;
+		while(true)
+		{
+			uint32_t best = CELLS;
+			for(uint32_t i = 0; i < CELLS; i++)
+			{
+				if(!closed[i] && d[i] != NONE
+				   && (best == CELLS || costs_[d[i]] < costs_[d[best]]))
+				{
+					best = i;
+				}
+			}
+			if(best == CELLS) { break; }
+			closed[best] = true;
+
+			int32_t x = int32_t(best % BLOCK_SIZE);
+			int32_t y = int32_t(best / BLOCK_SIZE);
+			for(int32_t dy = -1; dy <= 1; dy++)
+			{
+				for(int32_t dx = -1; dx <= 1; dx++)
+				{
+					if((dx == 0 && dy == 0) || !free(x + dx, y + dy))
+					{
+						continue;
+					}
+					// no corner cutting
+					if(dx != 0 && dy != 0
+					   && (!free(x + dx, y) || !free(x, y + dy)))
+					{
+						continue;
+					}
+					uint32_t next = uint32_t(y + dy) * BLOCK_SIZE + (x + dx);
+					uint8_t nd
+					    = d[best] + (dx != 0 && dy != 0 ? DIAGONAL : CARDINAL);
+					if(d[next] == NONE || costs_[nd] < costs_[d[next]])
+					{
+						d[next] = nd;
+					}
+				}
+			}
+		}
+	}
+	computed_[pattern >> 6] |= uint64_t{1} << (pattern & 63);
+	num_computed_++;
+}
+
+size_t
+lddb::mem() const
+{
+	return sizeof(*this) + table_.capacity()
+	    + computed_.capacity() * sizeof(uint64_t);
+}
+
+} // namespace warthog::block_astar
@@ -0,0 +1,48 @@
+#include <warthog/cpd/cpd.h>
+
+namespace warthog::cpd
+{
+
+cpd_layout::cpd_layout(
+    uint32_t width, uint32_t height, uint32_t num_nodes, uint64_t num_runs)
+{
+	rank_   = sizeof(cpd_header);
+	offset_ = rank_ + size_t{width} * height * sizeof(uint32_t);
+	offset_ = (offset_ + 7) & ~size_t{7};
+	run_    = offset_ + (size_t{num_nodes} + 1) * sizeof(uint64_t);
+	size_   = run_ + num_runs * sizeof(uint32_t);
+}
+
+bool
+cpd::load(const char* filename, const domain::gridmap& map)
+{
+	header_ = nullptr;
+	if(!file_.open(filename)) { return false; }
+	if(file_.size() < sizeof(cpd_header)) { return false; }
+
+	const cpd_header* header
+	    = reinterpret_cast<const cpd_header*>(file_.data());
+	if(header->magic_ != CPD_MAGIC || header->version_ != CPD_VERSION
+	   || header->width_ != map.width() || header->height_ != map.height())
+	{
+		return false;
+	}
+	cpd_layout layout(
+	    header->width_, header->height_, header->num_nodes_,
+	    header->num_runs_);
+	if(file_.size() != layout.size_) { return false; }
+	if(header->signature_ != map.signature()) { return false; }
+
+	const uint8_t* base = file_.data();
+	rank_   = reinterpret_cast<const uint32_t*>(base + layout.rank_);
+	offset_ = reinterpret_cast<const uint64_t*>(base + layout.offset_);
+	run_    = reinterpret_cast<const uint32_t*>(base + layout.run_);
+	for(uint32_t m = 0; m < NUM_MOVES; m++)
+	{
+		delta_[m] = uint32_t(MOVE_DY[m] * int32_t(map.width()) + MOVE_DX[m]);
+	}
+	header_ = header;
+	return true;
+}
+
+} // namespace warthog::cpd
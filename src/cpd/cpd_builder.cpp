@@ -0,0 +1,262 @@
+#include <warthog/cpd/cpd_builder.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/util/helpers.h>
+#include <warthog/util/timer.h>
+
+#include <bit>
+#include <cassert>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace warthog::cpd
+{
+
+namespace
+{
+
+// every move is optimal to the source itself
+constexpr uint16_t ANY_MOVE = (1u << NUM_MOVES) - 1;
+// two path costs are equal if they differ by less than this
+constexpr double COST_EPS = 1e-6;
+
+uint32_t
+move_between(pad_id from, pad_id to, uint32_t width)
+{
+	int64_t delta = int64_t(to.id) - int64_t(from.id);
+	for(uint32_t m = 0; m < NUM_MOVES; m++)
+	{
+		if(delta == MOVE_DY[m] * int64_t(width) + MOVE_DX[m]) { return m; }
+	}
+	assert(false);
+	return NO_MOVE;
+}
+
+} // namespace
+
+cpd_builder::cpd_builder(domain::gridmap* map) : map_(map)
+{
+	compute_ranks_();
+}
+
+void
+cpd_builder::compute_ranks_()
+{
+	search::gridmap_expansion_policy expander(map_);
+	expander.set_nodes_pool_size(0);
+	search::search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search::search_node current;
+
+	uint32_t size = map_->width() * map_->height();
+	rank_.assign(size, NO_RANK);
+	cells_.clear();
+	component_begin_.clear();
+	component_end_.clear();
+
+	// depth-first preorder; each component gets a contiguous range of ranks
+	std::vector<pad_id> stack;
+	for(uint32_t root = 0; root < size; root++)
+	{
+		if(!map_->get_label(pad_id{root}) || rank_[root] != NO_RANK)
+		{
+			continue;
+		}
+		uint32_t begin = uint32_t(cells_.size());
+		stack.push_back(pad_id{root});
+		while(!stack.empty())
+		{
+			pad_id id = stack.back();
+			stack.pop_back();
+			if(rank_[uint32_t(id.id)] != NO_RANK) { continue; }
+			rank_[uint32_t(id.id)] = uint32_t(cells_.size());
+			cells_.push_back(id);
+
+			current.set_id(id);
+			expander.expand(&current, &spi);
+			search::search_node* n = nullptr;
+			cost_t cost            = 0;
+			for(uint32_t i = expander.get_num_successors(); i-- > 0;)
+			{
+				expander.get_successor(i, n, cost);
+				if(rank_[uint32_t(n->get_id().id)] == NO_RANK)
+				{
+					stack.push_back(n->get_id());
+				}
+			}
+		}
+		uint32_t end = uint32_t(cells_.size());
+		component_begin_.insert(component_begin_.end(), end - begin, begin);
+		component_end_.insert(component_end_.end(), end - begin, end);
+	}
+	assert(cells_.size() <= MAX_RANK);
+}
+
+void
+cpd_builder::build()
+{
+	util::timer mytimer;
+	mytimer.start();
+	rows_.assign(cells_.size(), {});
+	util::parallel_compute(build_worker_, this, get_num_nodes());
+	build_time_ = mytimer.elapsed_time_nano();
+}
+
+void*
+cpd_builder::build_worker_(void* params)
+{
+	util::thread_params* par = static_cast<util::thread_params*>(params);
+	cpd_builder* builder     = static_cast<cpd_builder*>(par->shared_);
+	domain::gridmap* map     = builder->map_;
+	uint32_t num_nodes       = builder->get_num_nodes();
+
+	search::gridmap_expansion_policy expander(map);
+	expander.set_nodes_pool_size(0);
+	search::search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search::search_node current;
+
+	// indexed by rank
+	std::vector<double> dist(num_nodes);
+	std::vector<uint16_t> moves(num_nodes);
+	using entry = std::pair<double, uint32_t>;
+	std::priority_queue<entry, std::vector<entry>, std::greater<entry>> open;
+
+	for(uint32_t source = par->thread_id_; source < num_nodes;
+	    source += par->max_threads_)
+	{
+		uint32_t begin = builder->component_begin_[source];
+		uint32_t end   = builder->component_end_[source];
+		std::fill(
+		    dist.begin() + begin, dist.begin() + end,
+		    std::numeric_limits<double>::infinity());
+		std::fill(moves.begin() + begin, moves.begin() + end, 0);
+
+		// Dijkstra; moves[r] is the set of optimal first moves to rank r
+		dist[source]  = 0;
+		moves[source] = ANY_MOVE;
+		open.push({0, source});
+		while(!open.empty())
+		{
+			auto [d, r] = open.top();
+			open.pop();
+			if(d > dist[r]) { continue; }
+
+			pad_id id = builder->cells_[r];
+			current.set_id(id);
+			expander.expand(&current, &spi);
+			search::search_node* n = nullptr;
+			cost_t cost            = 0;
+			for(uint32_t i = 0; i < expander.get_num_successors(); i++)
+			{
+				expander.get_successor(i, n, cost);
+				pad_id nid  = n->get_id();
+				uint32_t nr = builder->rank_[uint32_t(nid.id)];
+				uint16_t via
+				    = r == source
+				    ? uint16_t(1u << move_between(id, nid, map->width()))
+				    : moves[r];
+				double nd = d + cost;
+				if(nd < dist[nr] - COST_EPS)
+				{
+					dist[nr]  = nd;
+					moves[nr] = via;
+					open.push({nd, nr});
+				}
+				else if(nd < dist[nr] + COST_EPS) { moves[nr] |= via; }
+			}
+		}
+
+		// greedy run-length compression, in target order
+		std::vector<uint32_t>& row = builder->rows_[source];
+		uint16_t common            = 0;
+		for(uint32_t target = begin; target < end; target++)
+		{
+			assert(moves[target] != 0);
+			if((common & moves[target]) == 0)
+			{
+				if(common != 0)
+				{
+					row.back() |= uint32_t(std::countr_zero(common));
+				}
+				row.push_back(target << MOVE_BITS);
+				common = moves[target];
+			}
+			else { common &= moves[target]; }
+		}
+		row.back() |= uint32_t(std::countr_zero(common));
+		if(end < num_nodes) { row.push_back((end << MOVE_BITS) | NO_MOVE); }
+		row.shrink_to_fit();
+		par->nprocessed_++;
+	}
+	return 0;
+}
+
+uint64_t
+cpd_builder::get_num_runs() const
+{
+	uint64_t num_runs = 0;
+	for(const auto& row : rows_)
+	{
+		num_runs += row.size();
+	}
+	return num_runs;
+}
+
+size_t
+cpd_builder::save(const char* filename) const
+{
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if(!out) { return 0; }
+
+	cpd_header header{};
+	header.magic_     = CPD_MAGIC;
+	header.version_   = CPD_VERSION;
+	header.width_     = map_->width();
+	header.height_    = map_->height();
+	header.num_nodes_ = get_num_nodes();
+	header.num_runs_  = get_num_runs();
+	header.signature_ = map_->signature();
+	cpd_layout layout(
+	    header.width_, header.height_, header.num_nodes_, header.num_runs_);
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.write(
+	    reinterpret_cast<const char*>(rank_.data()),
+	    rank_.size() * sizeof(uint32_t));
+	const char zeros[8] = {};
+	out.write(zeros, layout.offset_ - (layout.rank_ + rank_.size() * 4));
+
+	uint64_t offset = 0;
+	for(const auto& row : rows_)
+	{
+		out.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+		offset += row.size();
+	}
+	out.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+	for(const auto& row : rows_)
+	{
+		out.write(
+		    reinterpret_cast<const char*>(row.data()),
+		    row.size() * sizeof(uint32_t));
+	}
+	if(!out) { return 0; }
+	return layout.size_;
+}
+
+size_t
+cpd_builder::mem() const
+{
+	size_t size = sizeof(*this) + rank_.capacity() * sizeof(uint32_t)
+	    + cells_.capacity() * sizeof(pad_id)
+	    + component_begin_.capacity() * sizeof(uint32_t)
+	    + component_end_.capacity() * sizeof(uint32_t)
+	    + rows_.capacity() * sizeof(std::vector<uint32_t>);
+	for(const auto& row : rows_)
+	{
+		size += row.capacity() * sizeof(uint32_t);
+	}
+	return size;
+}
+
+} // namespace warthog::cpd
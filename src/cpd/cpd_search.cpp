@@ -0,0 +1,76 @@
+#include <warthog/cpd/cpd_search.h>
+#include <warthog/util/timer.h>
+
+namespace warthog::cpd
+{
+
+cpd_search::cpd_search(domain::gridmap* map, cpd* db)
+    : map_(map), db_(db), expander_(map)
+{
+	expander_.set_nodes_pool_size(0);
+}
+
+void
+cpd_search::get_path(
+    search::problem_instance* pi, search::search_parameters*,
+    search::solution* sol)
+{
+	walk_(pi, sol, true);
+}
+
+void
+cpd_search::get_pathcost(
+    search::problem_instance* pi, search::search_parameters*,
+    search::solution* sol)
+{
+	walk_(pi, sol, false);
+}
+
+void
+cpd_search::walk_(
+    search::problem_instance* pi, search::solution* sol, bool keep_path)
+{
+	util::timer mytimer;
+	mytimer.start();
+	sol->met_.time_elapsed_nano_ = {};
+
+	search::search_problem_instance spi = expander_.get_problem_instance(pi);
+	pad_id target                       = spi.target_;
+	pad_id current                      = spi.start_;
+	uint32_t target_rank = current == pad_id::max() || target == pad_id::max()
+	    ? NO_RANK
+	    : db_->get_rank(target);
+	if(target_rank == NO_RANK || db_->get_rank(current) == NO_RANK)
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	cost_t cost = 0;
+	if(keep_path) { sol->path_.push_back(map_->to_unpadded_id(current)); }
+	while(current != target)
+	{
+		uint32_t m
+		    = db_->get_move_by_rank(db_->get_rank(current), target_rank);
+		sol->met_.nodes_expanded_++;
+		if(m == NO_MOVE)
+		{
+			sol->path_.clear();
+			sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+			return;
+		}
+		cost    += m < NE ? 1 : warthog::DBL_ROOT_TWO;
+		current  = db_->step(current, m);
+		if(keep_path) { sol->path_.push_back(map_->to_unpadded_id(current)); }
+	}
+	sol->sum_of_edge_costs_      = cost;
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+size_t
+cpd_search::mem()
+{
+	return sizeof(*this) + db_->mem() + expander_.mem();
+}
+
+} // namespace warthog::cpd
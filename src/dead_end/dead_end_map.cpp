@@ -0,0 +1,231 @@
+#include <warthog/dead_end/dead_end_map.h>
+
+#include <bit>
+
+namespace warthog::dead_end
+{
+
+namespace
+{
+
+// the first cell >= @param x of a row of @param words words whose bit is
+// @param set; the width of the row if there is none
+uint32_t
+scan(const uint64_t* row, uint32_t words, uint32_t x, bool set)
+{
+	uint32_t k = x >> 6;
+	if(k >= words) { return words * 64; }
+	uint64_t w = (set ? row[k] : ~row[k]) & (~uint64_t{0} << (x & 63));
+	while(w == 0)
+	{
+		if(++k == words) { return words * 64; }
+		w = set ? row[k] : ~row[k];
+	}
+	return k * 64 + uint32_t(std::countr_zero(w));
+}
+
+// bits [@param lo, @param hi] of a word, 0 <= lo <= hi < 64
+uint64_t
+bits(uint32_t lo, uint32_t hi)
+{
+	return (~uint64_t{0} >> (63 - hi)) & (~uint64_t{0} << lo);
+}
+
+} // namespace
+
+dead_end_map::dead_end_map(const domain::gridmap* map)
+    : map_(map), words_per_row_(map->width() / 64)
+{
+	build();
+}
+
+void
+dead_end_map::find_runs_()
+{
+	runs_.clear();
+	row_first_.assign(map_->height() + 1, 0);
+
+	// rows of the gridmap are word aligned, and the padding after each row
+	// is blocked, so no run crosses into the next row
+	std::vector<uint64_t> row(words_per_row_);
+	for(uint32_t y = 0; y < map_->height(); y++)
+	{
+		row_first_[y] = uint32_t(runs_.size());
+		for(uint32_t k = 0; k < words_per_row_; k++)
+		{
+			pad_id id{y * map_->width() + k * 64};
+			row[k] = map_->get_neighbours_slider(id).get_block_64bit_le();
+		}
+		uint32_t x = scan(row.data(), words_per_row_, 0, true);
+		while(x < map_->width())
+		{
+			uint32_t end = scan(row.data(), words_per_row_, x, false);
+			runs_.push_back({x, end - 1, y});
+			x = scan(row.data(), words_per_row_, end, true);
+		}
+	}
+	row_first_[map_->height()] = uint32_t(runs_.size());
+}
+
+void
+dead_end_map::search_(
+    uint32_t root, uint32_t first, std::vector<uint32_t>& order,
+    std::vector<uint32_t>& parent, std::vector<uint32_t>& low)
+{
+	// the runs overlapping run_ are [cursor_, last_) of the row above it,
+	// then of the row below
+	struct frame
+	{
+		uint32_t run_;
+		uint32_t row_;
+		uint32_t cursor_;
+		uint32_t last_;
+	};
+	auto enter = [&](uint32_t v, uint32_t row) -> frame {
+		const run& r = runs_[v];
+		auto begin   = runs_.begin() + row_first_[row];
+		auto end     = runs_.begin() + row_first_[row + 1];
+		// the first run of the row which ends at or after r.x1_
+		auto cursor = std::lower_bound(
+		    begin, end, r.x1_,
+		    [](const run& o, uint32_t x) { return o.x2_ < x; });
+		return {
+		    v, row, uint32_t(cursor - runs_.begin()),
+		    uint32_t(end - runs_.begin())};
+	};
+	auto visit = [&](uint32_t v) {
+		pre_[v]  = first++;
+		low[v]   = pre_[v];
+		size_[v] = 1;
+		order.push_back(v);
+	};
+
+	// rows 0 and height - 1 are padding, and hold no runs
+	std::vector<frame> stack;
+	parent[root] = NONE;
+	visit(root);
+	stack.push_back(enter(root, runs_[root].y_ - 1));
+	while(!stack.empty())
+	{
+		frame& f     = stack.back();
+		uint32_t v   = f.run_;
+		const run& r = runs_[v];
+		if(f.cursor_ == f.last_ || runs_[f.cursor_].x1_ > r.x2_)
+		{
+			if(f.row_ < r.y_)
+			{
+				f = enter(v, r.y_ + 1);
+				continue;
+			}
+			stack.pop_back();
+			uint32_t p = parent[v];
+			if(p != NONE)
+			{
+				low[p]   = std::min(low[p], low[v]);
+				size_[p] += size_[v];
+			}
+			continue;
+		}
+
+		uint32_t u = f.cursor_++;
+		if(pre_[u] == NONE)
+		{
+			parent[u] = v;
+			visit(u);
+			stack.push_back(enter(u, runs_[u].y_ - 1));
+		}
+		else { low[v] = std::min(low[v], pre_[u]); }
+	}
+}
+
+void
+dead_end_map::build()
+{
+	find_runs_();
+	uint32_t n = uint32_t(runs_.size());
+	pre_.assign(n, NONE);
+	size_.assign(n, 1);
+	region_.assign(n, NONE);
+
+	std::vector<uint32_t> order, parent(n), low(n);
+	uint32_t first = 0;
+	for(uint32_t r = 0; r < n; r++)
+	{
+		if(pre_[r] != NONE) { continue; }
+		order.clear();
+		search_(r, first, order, parent, low);
+
+		// root the search again at the centroid, the smallest subtree with
+		// more than half of the runs, so the regions are the outskirts
+		uint32_t total    = uint32_t(order.size());
+		uint32_t centroid = r;
+		for(uint32_t v : order)
+		{
+			if(size_[v] * 2 > total && size_[v] < size_[centroid])
+			{
+				centroid = v;
+			}
+		}
+		if(centroid != r)
+		{
+			for(uint32_t v : order)
+			{
+				pre_[v] = NONE;
+			}
+			order.clear();
+			search_(centroid, first, order, parent, low);
+		}
+
+		// a run is a doorway to the subtree of each child whose subtree
+		// has no edge above it. the root is a doorway to every subtree but
+		// the largest, which holds the rest of the component
+		uint32_t root    = order[0];
+		uint32_t largest = NONE;
+		for(uint32_t v : order)
+		{
+			if(parent[v] == root
+			   && (largest == NONE || size_[v] > size_[largest]))
+			{
+				largest = v;
+			}
+		}
+		for(uint32_t i = 1; i < total; i++)
+		{
+			uint32_t v = order[i];
+			uint32_t p = parent[v];
+			bool door  = p == root ? v != largest : low[v] >= pre_[p];
+			region_[v] = door ? v : region_[p];
+		}
+		first += total;
+	}
+
+	mask_data_.assign(
+	    mask_table::calc_array_size(map_->width(), map_->height()), 0);
+	mask_.setup(mask_data_.data(), map_->width(), map_->height());
+	num_cells_ = 0;
+	for(uint32_t v = 0; v < n; v++)
+	{
+		if(region_[v] == NONE) { continue; }
+		const run& r  = runs_[v];
+		uint64_t* row = &mask_data_[size_t(r.y_) * words_per_row_];
+		for(uint32_t k = r.x1_ >> 6; k <= r.x2_ >> 6; k++)
+		{
+			uint32_t lo = k == r.x1_ >> 6 ? r.x1_ & 63 : 0;
+			uint32_t hi = k == r.x2_ >> 6 ? r.x2_ & 63 : 63;
+			row[k]      |= bits(lo, hi);
+		}
+		num_cells_ += r.x2_ - r.x1_ + 1;
+	}
+}
+
+size_t
+dead_end_map::mem() const
+{
+	return sizeof(*this) + runs_.capacity() * sizeof(run)
+	    + (row_first_.capacity() + pre_.capacity() + size_.capacity()
+	       + region_.capacity())
+	    * sizeof(uint32_t)
+	    + mask_data_.capacity() * sizeof(uint64_t);
+}
+
+} // namespace warthog::dead_end
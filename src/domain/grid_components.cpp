@@ -0,0 +1,270 @@
+#include <warthog/domain/grid_components.h>
+#include <warthog/util/cost_table.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace warthog::domain
+{
+
+namespace
+{
+
+// the first cell >= @param x of a row of @param words words whose bit is
+// @param set; @param width if there is none
+uint32_t
+scan(
+    const uint64_t* row, uint32_t words, uint32_t width, uint32_t x,
+    bool set)
+{
+	uint32_t k = x >> 6;
+	if(k >= words) { return width; }
+	uint64_t w = (set ? row[k] : ~row[k]) & (~uint64_t{0} << (x & 63));
+	while(w == 0)
+	{
+		if(++k == words) { return width; }
+		w = set ? row[k] : ~row[k];
+	}
+	return std::min(width, k * 64 + uint32_t(std::countr_zero(w)));
+}
+
+// cardinal neighbours, then the ring of 8 neighbours in order
+constexpr int32_t CARDINAL_X[4] = {0, 1, 0, -1};
+constexpr int32_t CARDINAL_Y[4] = {-1, 0, 1, 0};
+constexpr int32_t RING_X[8]     = {0, 1, 1, 1, 0, -1, -1, -1};
+constexpr int32_t RING_Y[8]     = {-1, -1, 0, 1, 1, 1, 0, -1};
+
+} // namespace
+
+grid_components::grid_components(const gridmap& map)
+    : width_(map.header_width()), height_(map.header_height()),
+      words_per_row_((map.header_width() + 63) / 64)
+{
+	// rows of the gridmap are word aligned, and the padding after each row
+	// is blocked
+	free_.resize(size_t(words_per_row_) * height_);
+	for(uint32_t y = 0; y < height_; y++)
+	{
+		for(uint32_t k = 0; k < words_per_row_; k++)
+		{
+			pad_id id = map.to_padded_id_from_unpadded(k * 64, y);
+			free_[y * words_per_row_ + k]
+			    = map.get_neighbours_slider(id).get_block_64bit_le();
+		}
+	}
+	build_();
+}
+
+grid_components::grid_components(vl_gridmap& map, util::cost_table& costs)
+    : width_(map.header_width()), height_(map.header_height()),
+      words_per_row_((map.header_width() + 63) / 64)
+{
+	free_.resize(size_t(words_per_row_) * height_);
+	for(uint32_t y = 0; y < height_; y++)
+	{
+		for(uint32_t x = 0; x < width_; x++)
+		{
+			pad_id id = map.to_padded_id_from_unpadded(x, y);
+			if(costs[map.get_label(id.id)] == 0) { continue; }
+			free_[y * words_per_row_ + (x >> 6)] |= uint64_t{1} << (x & 63);
+		}
+	}
+	build_();
+}
+
+void
+grid_components::build_()
+{
+	label_.assign(size_t(width_) * height_, NONE);
+	parent_.clear();
+	size_.clear();
+	num_components_ = 0;
+
+	for(uint32_t y = 0; y < height_; y++)
+	{
+		const uint64_t* row   = &free_[y * words_per_row_];
+		const uint64_t* above = y ? row - words_per_row_ : nullptr;
+		uint32_t* labels      = &label_[y * width_];
+
+		uint32_t x = scan(row, words_per_row_, width_, 0, true);
+		while(x < width_)
+		{
+			uint32_t end   = scan(row, words_per_row_, width_, x, false);
+			uint32_t label = new_label_();
+			size_[label]   = end - x;
+			std::fill(labels + x, labels + end, label);
+
+			// unite with each run above that overlaps [x, end); the
+			// overlaps start where a bit of the row above is set but the
+			// one before it (within the run) is not
+			for(uint32_t k = x >> 6; above && k <= (end - 1) >> 6; k++)
+			{
+				uint64_t in = ~uint64_t{0};
+				if(k == x >> 6) { in &= ~uint64_t{0} << (x & 63); }
+				if(k == (end - 1) >> 6)
+				{
+					in &= ~uint64_t{0} >> (63 - ((end - 1) & 63));
+				}
+				uint64_t over  = above[k] & in;
+				uint64_t carry = k > x >> 6 ? above[k - 1] >> 63 : 0;
+				for(uint64_t starts = over & ~((over << 1) | carry); starts;
+				    starts &= starts - 1)
+				{
+					uint32_t p = k * 64 + uint32_t(std::countr_zero(starts));
+					pack_id up{(y - 1) * width_ + p};
+					label = unite_(label, get_component(up));
+				}
+			}
+			x = scan(row, words_per_row_, width_, end, true);
+		}
+	}
+
+	// point every cell at its root, and number the roots from 0
+	std::vector<uint32_t> number(parent_.size(), NONE);
+	std::vector<uint32_t> size;
+	for(uint32_t i = 0; i < label_.size(); i++)
+	{
+		if(label_[i] == NONE) { continue; }
+		uint32_t root = get_component(pack_id{i});
+		if(number[root] == NONE)
+		{
+			number[root] = uint32_t(size.size());
+			size.push_back(size_[root]);
+		}
+		label_[i] = number[root];
+	}
+	parent_.resize(size.size());
+	for(uint32_t i = 0; i < parent_.size(); i++)
+	{
+		parent_[i] = i;
+	}
+	size_ = std::move(size);
+}
+
+uint32_t
+grid_components::new_label_()
+{
+	uint32_t label = uint32_t(parent_.size());
+	parent_.push_back(label);
+	size_.push_back(0);
+	num_components_++;
+	return label;
+}
+
+uint32_t
+grid_components::unite_(uint32_t a, uint32_t b)
+{
+	if(a == b) { return a; }
+	if(size_[a] < size_[b]) { std::swap(a, b); }
+	parent_[b] = a;
+	size_[a]   += size_[b];
+	num_components_--;
+	return a;
+}
+
+uint32_t
+grid_components::fill_(uint32_t x, uint32_t y, uint32_t label)
+{
+	uint32_t count = 0;
+	stack_.clear();
+	stack_.push_back(y * width_ + x);
+	label_[y * width_ + x] = label;
+	while(!stack_.empty())
+	{
+		uint32_t id = stack_.back();
+		stack_.pop_back();
+		count++;
+		int64_t cx = id % width_;
+		int64_t cy = id / width_;
+		for(int i = 0; i < 4; i++)
+		{
+			int64_t nx = cx + CARDINAL_X[i];
+			int64_t ny = cy + CARDINAL_Y[i];
+			if(!free_at_(nx, ny)) { continue; }
+			uint32_t nid = uint32_t(ny * width_ + nx);
+			if(label_[nid] == label) { continue; }
+			label_[nid] = label;
+			stack_.push_back(nid);
+		}
+	}
+	return count;
+}
+
+void
+grid_components::set_label(uint32_t x, uint32_t y, bool traversable)
+{
+	uint64_t& word = free_[y * words_per_row_ + (x >> 6)];
+	uint64_t bit   = uint64_t{1} << (x & 63);
+	if(bool(word & bit) == traversable) { return; }
+	uint32_t id = y * width_ + x;
+
+	if(traversable)
+	{
+		word           |= bit;
+		uint32_t label  = new_label_();
+		size_[label]    = 1;
+		label_[id]      = label;
+		for(int i = 0; i < 4; i++)
+		{
+			int64_t nx = int64_t(x) + CARDINAL_X[i];
+			int64_t ny = int64_t(y) + CARDINAL_Y[i];
+			if(!free_at_(nx, ny)) { continue; }
+			label = unite_(
+			    label, get_component(pack_id{uint32_t(ny * width_ + nx)}));
+		}
+		return;
+	}
+
+	uint32_t root = get_component(pack_id{id});
+	word       &= ~bit;
+	label_[id]  = NONE;
+	if(--size_[root] == 0)
+	{
+		num_components_--;
+		return;
+	}
+
+	// the cardinal neighbours stay connected if they are on one arc of
+	// traversable cells around (x, y)
+	bool ring[8];
+	for(int i = 0; i < 8; i++)
+	{
+		ring[i] = free_at_(int64_t(x) + RING_X[i], int64_t(y) + RING_Y[i]);
+	}
+	uint32_t arcs = 0;
+	for(int i = 0; i < 8; i++)
+	{
+		if(!ring[i] || ring[(i + 7) % 8]) { continue; }
+		bool cardinal = false;
+		for(int j = i; ring[j % 8] && j < i + 8; j++)
+		{
+			cardinal = cardinal || j % 2 == 0;
+		}
+		arcs += cardinal;
+	}
+	if(arcs <= 1) { return; }
+
+	// otherwise flood fill the pieces with new labels, except for the last,
+	// which keeps the old one
+	uint32_t pending[4];
+	uint32_t num_pending = 0;
+	for(int i = 0; i < 4; i++)
+	{
+		int64_t nx = int64_t(x) + CARDINAL_X[i];
+		int64_t ny = int64_t(y) + CARDINAL_Y[i];
+		if(free_at_(nx, ny)) { pending[num_pending++] = uint32_t(i); }
+	}
+	for(uint32_t i = 0; i + 1 < num_pending; i++)
+	{
+		uint32_t nx = x + CARDINAL_X[pending[i]];
+		uint32_t ny = y + CARDINAL_Y[pending[i]];
+		if(get_component(pack_id{ny * width_ + nx}) != root) { continue; }
+		uint32_t label = new_label_();
+		size_[label]   = fill_(nx, ny, label);
+		size_[root]    -= size_[label];
+	}
+	// the old label is left without cells if the last piece was filled
+	if(size_[root] == 0) { num_components_--; }
+}
+
+} // namespace warthog::domain
@@ -1,7 +1,9 @@
 #include <warthog/domain/gridmap.h>
 
+#include <algorithm>
 #include <bit>
 #include <cassert>
+#include <cmath>
 #include <cstring>
 #include <fstream>
 #include <numeric>
@@ -74,6 +76,121 @@ gridmap::~gridmap()
 	delete[] db_;
 }
 
+uint64_t
+gridmap::signature() const noexcept
+{
+	// FNV-1a over the padded bit array
+	uint64_t hash = 14695981039346656037ull;
+	auto mix      = [&hash](uint64_t v) {
+		hash ^= v;
+		hash *= 1099511628211ull;
+	};
+	mix(width());
+	mix(height());
+	for(uint32_t i = 0; i < db_size_; i++)
+	{
+		mix(db_[i]);
+	}
+	return hash;
+}
+
+bool
+gridmap::line_of_sight(pad_id from, pad_id to) const noexcept
+{
+	// are the @param len cells starting at @param first all traversable?
+	// rows start on a word boundary, so the cells are read from aligned
+	// words, 64 at a time
+	auto span = [this](uint32_t first, uint32_t len) {
+		while(len > 0)
+		{
+			uint32_t bit  = first & 63;
+			uint32_t n    = std::min(len, 64 - bit);
+			uint64_t mask = (~uint64_t{0} >> (64 - n)) << bit;
+
+			gridmap_slider slider = get_neighbours_slider(pad_id{first - bit});
+			if((slider.get_block_64bit_le() & mask) != mask) { return false; }
+			first += n;
+			len   -= n;
+		}
+		return true;
+	};
+
+	uint32_t x0, y0, x1, y1;
+	to_padded_xy(from, x0, y0);
+	to_padded_xy(to, x1, y1);
+	if(y0 > y1)
+	{
+		std::swap(x0, x1);
+		std::swap(y0, y1);
+	}
+	if(y0 == y1)
+	{
+		uint32_t lo = x0 < x1 ? x0 : x1;
+		uint32_t hi = x0 < x1 ? x1 : x0;
+		return span(y0 * width() + lo, hi - lo + 1);
+	}
+
+	// in half-cell units cell centres are at 2x + 1, and the line is at
+	// X(Y) = (2x0 + 1) + (Y - 2y0 - 1) * dx / dy. X is kept as a numerator
+	// over dy so that every test is exact.
+	int64_t dx = int64_t(x1) - int64_t(x0);
+	int64_t dy = int64_t(y1) - int64_t(y0);
+	for(int64_t r = y0; r <= y1; r++)
+	{
+		// the part of the line within the closed row r
+		int64_t ya = std::max(2 * r, 2 * int64_t(y0) + 1);
+		int64_t yb = std::min(2 * r + 2, 2 * int64_t(y1) + 1);
+		int64_t na = (2 * int64_t(x0) + 1) * dy + (ya - 2 * y0 - 1) * dx;
+		int64_t nb = (2 * int64_t(x0) + 1) * dy + (yb - 2 * y0 - 1) * dx;
+		if(na > nb) { std::swap(na, nb); }
+		// cells c with 2c <= X <= 2c + 2 for some X in [na, nb] / dy;
+		// c = -1 is the padding at the end of the previous row
+		int64_t first = (na + 2 * dy - 1) / (2 * dy) - 1;
+		int64_t last  = nb / (2 * dy);
+		if(!span(uint32_t(r * width() + first), uint32_t(last - first + 1)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+double
+gridmap::smooth_path(std::vector<pack_id>& path) const
+{
+	auto distance = [this](pad_id a, pad_id b) {
+		uint32_t ax, ay, bx, by;
+		to_padded_xy(a, ax, ay);
+		to_padded_xy(b, bx, by);
+		double dx = double(ax) - double(bx);
+		double dy = double(ay) - double(by);
+		return std::sqrt(dx * dx + dy * dy);
+	};
+	if(path.size() < 2) { return 0; }
+
+	// greedy string pulling: keep a waypoint only where the last one kept
+	// cannot see past it
+	size_t kept   = 1;
+	pad_id anchor = to_padded_id(path[0]);
+	pad_id prev   = to_padded_id(path[1]);
+	double length = 0;
+	for(size_t i = 2; i < path.size(); i++)
+	{
+		pad_id next = to_padded_id(path[i]);
+		if(!line_of_sight(anchor, next))
+		{
+			length       += distance(anchor, prev);
+			path[kept++]  = path[i - 1];
+			anchor        = prev;
+		}
+		prev = next;
+	}
+	length       += distance(anchor, prev);
+	path[kept++]  = path.back();
+	path.resize(kept);
+	return length;
+}
+
 void
 gridmap::print(std::ostream& out)
 {
@@ -0,0 +1,217 @@
+#include <warthog/flow/distance_field.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+
+namespace warthog::flow
+{
+
+namespace
+{
+
+// the cells east of those of word @param k of @param row
+inline uint64_t
+east(const uint64_t* row, uint32_t k) noexcept
+{
+	return (row[k] << 1) | (k > 0 ? row[k - 1] >> 63 : 0);
+}
+
+// the cells west of those of word @param k of @param row
+inline uint64_t
+west(const uint64_t* row, uint32_t k, uint32_t words) noexcept
+{
+	return (row[k] >> 1) | (k + 1 < words ? row[k + 1] << 63 : 0);
+}
+
+} // namespace
+
+template<std::unsigned_integral D>
+distance_field<D>::distance_field(const domain::gridmap* map, bool diagonal)
+    : map_(map), diagonal_(diagonal), words_per_row_(map->width() / 64)
+{
+	assert(map->width() % 64 == 0);
+	size_t cells = size_t(map->header_width()) * map->header_height();
+	size_t words = size_t(words_per_row_) * map->height();
+	dist_.resize(cells, UNREACHED);
+	flow_.resize(cells, FLOW_NONE);
+	free_.resize(words, 0);
+	visited_.resize(words, 0);
+	front_.resize(words, 0);
+	next_.resize(words, 0);
+	stamp_.resize(words, 0);
+}
+
+template<std::unsigned_integral D>
+void
+distance_field<D>::compute(
+    const std::vector<pack_id>& sources, D max_distance)
+{
+	std::fill(dist_.begin(), dist_.end(), UNREACHED);
+	std::fill(flow_.begin(), flow_.end(), FLOW_NONE);
+	std::fill(visited_.begin(), visited_.end(), 0);
+	std::fill(stamp_.begin(), stamp_.end(), 0);
+	// rows are word aligned, and the padding is blocked
+	std::memcpy(
+	    free_.data(), map_->data(), free_.size() * sizeof(uint64_t));
+	front_words_.clear();
+	num_waves_ = 0;
+
+	for(pack_id src : sources)
+	{
+		pad_id p     = map_->to_padded_id(src);
+		uint32_t w   = p.id >> 6;
+		uint64_t bit = uint64_t{1} << (p.id & 63);
+		if(!(free_[w] & bit) || (visited_[w] & bit)) { continue; }
+
+		if(!front_[w]) { front_words_.push_back(w); }
+		visited_[w] |= bit;
+		front_[w] |= bit;
+		write_(w, bit, 0, FLOW_SOURCE);
+	}
+
+	// the wave stops short of UNREACHED
+	uint32_t last = std::min<uint32_t>(max_distance, UNREACHED - 1);
+	for(uint32_t d = 1; d <= last && !front_words_.empty(); d++)
+	{
+		step_(D(d));
+		num_waves_++;
+	}
+	for(uint32_t w : front_words_)
+	{
+		front_[w] = 0;
+	}
+}
+
+template<std::unsigned_integral D>
+void
+distance_field<D>::step_(D d)
+{
+	// stamps start from 1, once per computation
+	uint32_t stamp = num_waves_ + 1;
+	uint32_t words = words_per_row_;
+	next_words_.clear();
+	auto visit = [&](uint32_t c) {
+		if(stamp_[c] == stamp) { return; }
+		stamp_[c] = stamp;
+		if(uint64_t reached = reach_(c, d))
+		{
+			next_[c] = reached;
+			visited_[c] |= reached;
+			next_words_.push_back(c);
+		}
+	};
+	for(uint32_t w : front_words_)
+	{
+		// the words above, at and below w; those beside them only if the
+		// wavefront reaches the end of w. the wavefront is inside the
+		// map, and the padding around it is blocked
+		visit(w - words);
+		visit(w);
+		visit(w + words);
+		uint64_t f = front_[w];
+		uint32_t k = w % words;
+		if((f >> 63) && k + 1 < words)
+		{
+			visit(w + 1);
+			if(diagonal_)
+			{
+				visit(w + 1 - words);
+				visit(w + 1 + words);
+			}
+		}
+		if((f & 1) && k > 0)
+		{
+			visit(w - 1);
+			if(diagonal_)
+			{
+				visit(w - 1 - words);
+				visit(w - 1 + words);
+			}
+		}
+	}
+
+	// the old wavefront is the next one of the next step
+	for(uint32_t w : front_words_)
+	{
+		front_[w] = 0;
+	}
+	front_.swap(next_);
+	front_words_.swap(next_words_);
+}
+
+template<std::unsigned_integral D>
+uint64_t
+distance_field<D>::reach_(uint32_t w, D d)
+{
+	uint64_t avail = free_[w] & ~visited_[w];
+	if(!avail) { return 0; }
+
+	uint32_t words     = words_per_row_;
+	uint32_t k         = w % words;
+	const uint64_t* f  = &front_[w - k];
+	const uint64_t* n  = f - words; // row above
+	const uint64_t* s  = f + words; // row below
+	const uint64_t* fr = &free_[w - k];
+
+	// each cell takes the first direction to a predecessor
+	uint64_t reached = 0;
+	auto take        = [&](uint64_t from, uint8_t dir) {
+		from &= avail;
+		if(!from) { return; }
+		avail &= ~from;
+		reached |= from;
+		write_(w, from, d, dir);
+	};
+	take(n[k], FLOW_N);
+	take(west(f, k, words), FLOW_E);
+	take(s[k], FLOW_S);
+	take(east(f, k), FLOW_W);
+	if(diagonal_ && avail)
+	{
+		// both cells beside the move must be traversable
+		const uint64_t* fn = fr - words;
+		const uint64_t* fs = fr + words;
+		uint64_t fe        = west(fr, k, words);
+		uint64_t fw        = east(fr, k);
+		take(west(n, k, words) & fe & fn[k], FLOW_NE);
+		take(west(s, k, words) & fe & fs[k], FLOW_SE);
+		take(east(s, k) & fw & fs[k], FLOW_SW);
+		take(east(n, k) & fw & fn[k], FLOW_NW);
+	}
+	return reached;
+}
+
+template<std::unsigned_integral D>
+void
+distance_field<D>::write_(uint32_t w, uint64_t bits, D d, uint8_t dir)
+{
+	uint32_t y  = w / words_per_row_ - domain::gridmap::PADDED_ROWS;
+	size_t base = size_t(y) * map_->header_width()
+	    + size_t(w % words_per_row_) * 64;
+	for(; bits; bits &= bits - 1)
+	{
+		size_t id = base + std::countr_zero(bits);
+		dist_[id] = d;
+		flow_[id] = dir;
+	}
+}
+
+template<std::unsigned_integral D>
+size_t
+distance_field<D>::mem() const
+{
+	return sizeof(*this) + dist_.capacity() * sizeof(D) + flow_.capacity()
+	    + (free_.capacity() + visited_.capacity() + front_.capacity()
+	       + next_.capacity())
+	    * sizeof(uint64_t)
+	    + (front_words_.capacity() + next_words_.capacity()
+	       + stamp_.capacity())
+	    * sizeof(uint32_t);
+}
+
+template class distance_field<uint16_t>;
+template class distance_field<uint32_t>;
+
+} // namespace warthog::flow
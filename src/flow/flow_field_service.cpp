@@ -0,0 +1,287 @@
+#include <warthog/flow/flow_field_service.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace warthog::flow
+{
+
+namespace
+{
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+// the flow_dir of the move (@param dx, @param dy)
+constexpr uint8_t MOVE[3][3] = {
+    {FLOW_NW, FLOW_N, FLOW_NE},
+    {FLOW_W, FLOW_SOURCE, FLOW_E},
+    {FLOW_SW, FLOW_S, FLOW_SE}};
+
+} // namespace
+
+template<class Expander>
+flow_field_service<Expander>::flow_field_service(
+    Expander* expander, uint32_t capacity)
+    : expander_(expander), capacity_(std::max<uint32_t>(capacity, 1)),
+      version_(expander->get_map()->get_version())
+{
+	// fields are never moved, so references to them stay valid
+	fields_.reserve(capacity_);
+}
+
+template<class Expander>
+const std::vector<uint8_t>&
+flow_field_service<Expander>::get_field(pack_id target)
+{
+	uint64_t version = expander_->get_map()->get_version();
+	if(version != version_)
+	{
+		clear();
+		version_ = version;
+	}
+
+	auto it = index_.find(target.id);
+	if(it != index_.end())
+	{
+		hits_++;
+		unlink_(it->second);
+		link_(it->second);
+		return fields_[it->second].moves_;
+	}
+
+	misses_++;
+	uint32_t slot;
+	if(fields_.size() < capacity_)
+	{
+		slot = uint32_t(fields_.size());
+		fields_.emplace_back();
+	}
+	else
+	{
+		// evict the least recently used field, and reuse its memory
+		slot = oldest_;
+		unlink_(slot);
+		index_.erase(fields_[slot].target_.id);
+	}
+	link_(slot);
+	field& f          = fields_[slot];
+	f.target_         = target;
+	index_[target.id] = slot;
+
+	auto* map = expander_->get_map();
+	f.moves_.assign(
+	    size_t(map->header_width()) * map->header_height(), FLOW_NONE);
+	if(target.id < f.moves_.size())
+	{
+		dijkstra_(expander_->unget_state(target), f.moves_);
+	}
+	return f.moves_;
+}
+
+template<class Expander>
+void
+flow_field_service<Expander>::dijkstra_(
+    pad_id target, std::vector<uint8_t>& moves)
+{
+	if(!traversable_(target)) { return; }
+	search::search_problem_instance spi{target, target};
+
+	auto* map      = expander_->get_map();
+	uint32_t width = map->width();
+	dist_.assign(size_t(width) * map->height(), INF);
+	open_.clear();
+	auto greater = std::greater<std::pair<double, uint32_t>>();
+
+	search::search_node current;
+	dist_[target.id]                       = 0;
+	moves[expander_->get_state(target).id] = FLOW_SOURCE;
+	open_.push_back({0, uint32_t(target.id)});
+	while(!open_.empty())
+	{
+		std::pop_heap(open_.begin(), open_.end(), greater);
+		auto [d, id] = open_.back();
+		open_.pop_back();
+		if(met_) { met_->heap_ops_++; }
+		if(d > dist_[id]) { continue; }
+
+		if(met_) { met_->nodes_expanded_++; }
+		current.set_id(pad_id{id});
+		expander_->expand(&current, &spi);
+		search::search_node* n = nullptr;
+		cost_t cost            = 0;
+		for(uint32_t i = 0; i < expander_->get_num_successors(); i++)
+		{
+			expander_->get_successor(i, n, cost);
+			uint32_t nid = uint32_t(n->get_id().id);
+			if(met_) { met_->nodes_generated_++; }
+			if(d + cost >= dist_[nid]) { continue; }
+
+			// the first move from the successor is back to id
+			dist_[nid] = d + cost;
+			int32_t dx = int32_t(id % width) - int32_t(nid % width);
+			int32_t dy = int32_t(id / width) - int32_t(nid / width);
+			moves[expander_->get_state(pad_id{nid}).id]
+			    = MOVE[dy + 1][dx + 1];
+			open_.push_back({d + cost, nid});
+			std::push_heap(open_.begin(), open_.end(), greater);
+			if(met_) { met_->heap_ops_++; }
+		}
+	}
+}
+
+template<class Expander>
+pack_id
+flow_field_service<Expander>::next(pack_id target, pack_id from)
+{
+	uint8_t m = next_move(target, from);
+	if(m == FLOW_NONE) { return pack_id::max(); }
+	return follow_(m, from);
+}
+
+template<class Expander>
+pack_id
+flow_field_service<Expander>::follow_(uint8_t move, pack_id from) const
+{
+	if(move == FLOW_SOURCE) { return from; }
+	int32_t width = int32_t(expander_->get_map()->header_width());
+	return pack_id{
+	    uint32_t(int32_t(from.id) + FLOW_DY[move] * width + FLOW_DX[move])};
+}
+
+template<class Expander>
+bool
+flow_field_service<Expander>::traversable_(pad_id id)
+{
+	if constexpr(std::is_same_v<Expander, search::vl_gridmap_expansion_policy>)
+	{
+		return expander_->get_costs()[expander_->get_map()->get_label(
+		           uint32_t(id))]
+		    != 0;
+	}
+	else { return expander_->get_map()->get_label(id); }
+}
+
+template<class Expander>
+void
+flow_field_service<Expander>::get_path(
+    search::problem_instance* pi, search::search_parameters*,
+    search::solution* sol)
+{
+	walk_(pi, sol, true);
+}
+
+template<class Expander>
+void
+flow_field_service<Expander>::get_pathcost(
+    search::problem_instance* pi, search::search_parameters*,
+    search::solution* sol)
+{
+	walk_(pi, sol, false);
+}
+
+template<class Expander>
+void
+flow_field_service<Expander>::walk_(
+    search::problem_instance* pi, search::solution* sol, bool keep_path)
+{
+	util::timer mytimer;
+	mytimer.start();
+	sol->met_.time_elapsed_nano_ = {};
+
+	auto* map      = expander_->get_map();
+	uint32_t cells = map->header_width() * map->header_height();
+	if(pi->start_.id >= cells || pi->target_.id >= cells)
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+	met_                              = &sol->met_;
+	const std::vector<uint8_t>& moves = get_field(pi->target_);
+	met_                              = nullptr;
+	if(moves[pi->start_.id] == FLOW_NONE)
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	// the cost of each move is that of the expander
+	search::search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search::search_node current;
+	pack_id at  = pi->start_;
+	cost_t cost = 0;
+	if(keep_path) { sol->path_.push_back(at); }
+	while(at != pi->target_)
+	{
+		pack_id to = follow_(moves[at.id], at);
+		current.set_id(expander_->unget_state(at));
+		expander_->expand(&current, &spi);
+		pad_id succ            = expander_->unget_state(to);
+		search::search_node* n = nullptr;
+		cost_t c               = 0;
+		for(uint32_t i = 0; i < expander_->get_num_successors(); i++)
+		{
+			expander_->get_successor(i, n, c);
+			if(n->get_id() == succ) { break; }
+		}
+		cost += c;
+		at    = to;
+		if(keep_path) { sol->path_.push_back(at); }
+	}
+	sol->sum_of_edge_costs_      = cost;
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+template<class Expander>
+void
+flow_field_service<Expander>::clear()
+{
+	fields_.clear();
+	index_.clear();
+	newest_ = UINT32_MAX;
+	oldest_ = UINT32_MAX;
+}
+
+template<class Expander>
+void
+flow_field_service<Expander>::link_(uint32_t f)
+{
+	fields_[f].newer_ = UINT32_MAX;
+	fields_[f].older_ = newest_;
+	if(newest_ != UINT32_MAX) { fields_[newest_].newer_ = f; }
+	else { oldest_ = f; }
+	newest_ = f;
+}
+
+template<class Expander>
+void
+flow_field_service<Expander>::unlink_(uint32_t f)
+{
+	field& old = fields_[f];
+	if(old.newer_ != UINT32_MAX) { fields_[old.newer_].older_ = old.older_; }
+	else { newest_ = old.older_; }
+	if(old.older_ != UINT32_MAX) { fields_[old.older_].newer_ = old.newer_; }
+	else { oldest_ = old.newer_; }
+}
+
+template<class Expander>
+size_t
+flow_field_service<Expander>::mem()
+{
+	size_t size = sizeof(*this) + fields_.capacity() * sizeof(field)
+	    + index_.size() * (sizeof(uint32_t) * 2 + sizeof(void*))
+	    + dist_.capacity() * sizeof(double)
+	    + open_.capacity() * sizeof(std::pair<double, uint32_t>);
+	for(const field& f : fields_)
+	{
+		size += f.moves_.capacity();
+	}
+	return size;
+}
+
+template class flow_field_service<search::gridmap_expansion_policy>;
+template class flow_field_service<search::vl_gridmap_expansion_policy>;
+
+} // namespace warthog::flow
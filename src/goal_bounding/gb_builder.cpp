@@ -0,0 +1,185 @@
+#include <warthog/goal_bounding/gb_builder.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/util/helpers.h>
+#include <warthog/util/timer.h>
+
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace warthog::goal_bounding
+{
+
+namespace
+{
+
+// two path costs are equal if they differ by less than this
+constexpr double COST_EPS = 1e-6;
+
+// the index of the move from @param from to the adjacent @param to, in the
+// order of gridmap_expansion_policy
+uint32_t
+move_between(pad_id from, pad_id to, uint32_t width)
+{
+	static const int32_t dx[NUM_MOVES] = {0, 1, 0, -1, 1, 1, -1, -1};
+	static const int32_t dy[NUM_MOVES] = {-1, 0, 1, 0, -1, 1, 1, -1};
+	int64_t delta = int64_t(to.id) - int64_t(from.id);
+	for(uint32_t m = 0; m < NUM_MOVES; m++)
+	{
+		if(delta == dy[m] * int64_t(width) + dx[m]) { return m; }
+	}
+	return NUM_MOVES;
+}
+
+} // namespace
+
+gb_builder::gb_builder(domain::gridmap* map)
+    : map_(map), shift_(gb_shift(map->width(), map->height()))
+{
+	uint32_t size = map_->width() * map_->height();
+	index_.assign(size, NO_INDEX);
+	for(uint32_t id = 0; id < size; id++)
+	{
+		if(map_->get_label(pad_id{id}))
+		{
+			index_[id] = uint32_t(cells_.size());
+			cells_.push_back(pad_id{id});
+		}
+	}
+}
+
+void
+gb_builder::build()
+{
+	util::timer mytimer;
+	mytimer.start();
+	rects_.assign(size_t{get_num_nodes()} * NUM_MOVES, gb_rect{});
+	util::parallel_compute(build_worker_, this, get_num_nodes());
+	build_time_ = mytimer.elapsed_time_nano();
+}
+
+void*
+gb_builder::build_worker_(void* params)
+{
+	util::thread_params* par = static_cast<util::thread_params*>(params);
+	gb_builder* builder      = static_cast<gb_builder*>(par->shared_);
+	domain::gridmap* map     = builder->map_;
+	uint32_t num_nodes       = builder->get_num_nodes();
+
+	search::gridmap_expansion_policy expander(map);
+	expander.set_nodes_pool_size(0);
+	search::search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search::search_node current;
+
+	// indexed by row; moves[r] is the set of optimal first moves to row r
+	const double inf = std::numeric_limits<double>::infinity();
+	std::vector<double> dist(num_nodes, inf);
+	std::vector<uint8_t> moves(num_nodes, 0);
+	std::vector<uint32_t> reached;
+	using entry = std::pair<double, uint32_t>;
+	std::priority_queue<entry, std::vector<entry>, std::greater<entry>> open;
+
+	for(uint32_t source = par->thread_id_; source < num_nodes;
+	    source += par->max_threads_)
+	{
+		for(uint32_t r : reached)
+		{
+			dist[r]  = inf;
+			moves[r] = 0;
+		}
+		reached.clear();
+
+		dist[source] = 0;
+		reached.push_back(source);
+		open.push({0, source});
+		while(!open.empty())
+		{
+			auto [d, r] = open.top();
+			open.pop();
+			if(d > dist[r]) { continue; }
+
+			pad_id id = builder->cells_[r];
+			current.set_id(id);
+			expander.expand(&current, &spi);
+			search::search_node* n = nullptr;
+			cost_t cost            = 0;
+			for(uint32_t i = 0; i < expander.get_num_successors(); i++)
+			{
+				expander.get_successor(i, n, cost);
+				pad_id nid  = n->get_id();
+				uint32_t nr = builder->index_[uint32_t(nid.id)];
+				uint8_t via
+				    = r == source
+				    ? uint8_t(1u << move_between(id, nid, map->width()))
+				    : moves[r];
+				double nd = d + cost;
+				if(nd < dist[nr] - COST_EPS)
+				{
+					if(dist[nr] == inf) { reached.push_back(nr); }
+					dist[nr]  = nd;
+					moves[nr] = via;
+					open.push({nd, nr});
+				}
+				else if(nd < dist[nr] + COST_EPS) { moves[nr] |= via; }
+			}
+		}
+
+		// grow the rectangle of every optimal first move to each target
+		geometry::rectangle rect[NUM_MOVES];
+		for(uint32_t r : reached)
+		{
+			uint32_t x, y;
+			map->to_padded_xy(builder->cells_[r], x, y);
+			for(uint32_t m = 0; m < NUM_MOVES; m++)
+			{
+				if(moves[r] & (1u << m)) { rect[m].grow(x, y); }
+			}
+		}
+		gb_rect* row = &builder->rects_[size_t{source} * NUM_MOVES];
+		for(uint32_t m = 0; m < NUM_MOVES; m++)
+		{
+			row[m] = gb_quantise(rect[m], builder->shift_);
+		}
+		par->nprocessed_++;
+	}
+	return 0;
+}
+
+size_t
+gb_builder::save(const char* filename) const
+{
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if(!out) { return 0; }
+
+	gb_header header{};
+	header.magic_     = GB_MAGIC;
+	header.version_   = GB_VERSION;
+	header.width_     = map_->width();
+	header.height_    = map_->height();
+	header.num_nodes_ = get_num_nodes();
+	header.shift_     = shift_;
+	header.signature_ = map_->signature();
+	gb_layout layout(header.width_, header.height_, header.num_nodes_);
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	out.write(
+	    reinterpret_cast<const char*>(index_.data()),
+	    index_.size() * sizeof(uint32_t));
+	out.write(
+	    reinterpret_cast<const char*>(rects_.data()),
+	    rects_.size() * sizeof(gb_rect));
+	if(!out) { return 0; }
+	return layout.size_;
+}
+
+size_t
+gb_builder::mem() const
+{
+	return sizeof(*this) + index_.capacity() * sizeof(uint32_t)
+	    + cells_.capacity() * sizeof(pad_id)
+	    + rects_.capacity() * sizeof(gb_rect);
+}
+
+} // namespace warthog::goal_bounding
@@ -0,0 +1,52 @@
+#include <warthog/goal_bounding/gb_expansion_policy.h>
+
+namespace warthog::goal_bounding
+{
+
+gb_expansion_policy::gb_expansion_policy(
+    domain::gridmap* map, gb_table* table)
+    : gridmap_expansion_policy(map), table_(table)
+{ }
+
+void
+gb_expansion_policy::expand(
+    search::search_node* current, search::search_problem_instance*)
+{
+	reset();
+
+	// keep the moves whose rectangle contains the target
+	pad_id nodeid        = current->get_id();
+	const gb_rect* rects = table_->get_rects(nodeid);
+	uint32_t moves       = 0;
+	for(uint32_t i = 0; i < 8; i++)
+	{
+		moves |= uint32_t{rects[i].contains(target_x_, target_y_)} << i;
+	}
+	generate_moves_(nodeid, moves);
+}
+
+search::search_node*
+gb_expansion_policy::generate_start_node(search::search_problem_instance* pi)
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{pi->target_} >= max_id) { return 0; }
+	search::search_node* start
+	    = gridmap_expansion_policy::generate_start_node(pi);
+	if(start == nullptr) { return 0; }
+
+	uint32_t x, y;
+	map_->to_padded_xy(pi->target_, x, y);
+	target_x_ = x >> table_->get_shift();
+	target_y_ = y >> table_->get_shift();
+	return start;
+}
+
+size_t
+gb_expansion_policy::mem()
+{
+	return gridmap_expansion_policy::mem()
+	    + (sizeof(gb_expansion_policy) - sizeof(gridmap_expansion_policy))
+	    + table_->mem();
+}
+
+} // namespace warthog::goal_bounding
@@ -0,0 +1,32 @@
+#include <warthog/goal_bounding/gb_table.h>
+
+namespace warthog::goal_bounding
+{
+
+bool
+gb_table::load(const char* filename, const domain::gridmap& map)
+{
+	header_ = nullptr;
+	if(!file_.open(filename)) { return false; }
+	if(file_.size() < sizeof(gb_header)) { return false; }
+
+	const gb_header* header
+	    = reinterpret_cast<const gb_header*>(file_.data());
+	if(header->magic_ != GB_MAGIC || header->version_ != GB_VERSION
+	   || header->width_ != map.width() || header->height_ != map.height()
+	   || header->shift_ != gb_shift(map.width(), map.height()))
+	{
+		return false;
+	}
+	gb_layout layout(header->width_, header->height_, header->num_nodes_);
+	if(file_.size() != layout.size_) { return false; }
+	if(header->signature_ != map.signature()) { return false; }
+
+	const uint8_t* base = file_.data();
+	index_  = reinterpret_cast<const uint32_t*>(base + layout.index_);
+	rect_   = reinterpret_cast<const gb_rect*>(base + layout.rect_);
+	header_ = header;
+	return true;
+}
+
+} // namespace warthog::goal_bounding
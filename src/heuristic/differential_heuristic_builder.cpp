@@ -0,0 +1,204 @@
+#include <warthog/heuristic/differential_heuristic_builder.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/util/timer.h>
+
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace warthog::heuristic
+{
+
+namespace
+{
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+} // namespace
+
+differential_heuristic_builder::differential_heuristic_builder(
+    domain::gridmap* map)
+    : map_(map), expander_(map)
+{
+	expander_.set_nodes_pool_size(0);
+}
+
+void
+differential_heuristic_builder::dijkstra_(
+    pad_id source, std::vector<double>& dist)
+{
+	search::search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search::search_node current;
+	using entry = std::pair<double, uint32_t>;
+	std::priority_queue<entry, std::vector<entry>, std::greater<entry>> open;
+
+	dist.assign(size_t{map_->width()} * map_->height(), INF);
+	dist[uint32_t(source.id)] = 0;
+	open.push({0, uint32_t(source.id)});
+	while(!open.empty())
+	{
+		auto [d, id] = open.top();
+		open.pop();
+		if(d > dist[id]) { continue; }
+
+		current.set_id(pad_id{id});
+		expander_.expand(&current, &spi);
+		search::search_node* n = nullptr;
+		cost_t cost            = 0;
+		for(uint32_t i = 0; i < expander_.get_num_successors(); i++)
+		{
+			expander_.get_successor(i, n, cost);
+			uint32_t nid = uint32_t(n->get_id().id);
+			if(d + cost < dist[nid])
+			{
+				dist[nid] = d + cost;
+				open.push({d + cost, nid});
+			}
+		}
+	}
+}
+
+void
+differential_heuristic_builder::build(uint32_t num_pivots)
+{
+	util::timer mytimer;
+	mytimer.start();
+	pivots_.clear();
+	table_.clear();
+	stride_  = 0;
+	quantum_ = 1;
+
+	uint32_t size  = map_->width() * map_->height();
+	uint32_t first = 0;
+	while(first < size && !map_->get_label(pad_id{first}))
+	{
+		first++;
+	}
+	if(first == size || num_pivots == 0)
+	{
+		build_time_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	// the farthest cell from @param dist, preferring unreachable cells;
+	// @return false if every cell is a pivot already
+	auto farthest = [&](const std::vector<double>& dist, pad_id& best) {
+		double best_dist = 0;
+		for(uint32_t i = 0; i < size; i++)
+		{
+			if(map_->get_label(pad_id{i}) && dist[i] > best_dist)
+			{
+				best_dist = dist[i];
+				best      = pad_id{i};
+			}
+		}
+		return best_dist > 0;
+	};
+
+	// first pass: the pivots, and the largest finite distance from them
+	std::vector<double> dist;
+	dijkstra_(pad_id{first}, dist);
+	for(double& d : dist)
+	{
+		// stay in the component of the seed
+		if(d == INF) { d = 0; }
+	}
+	pad_id pivot{first};
+	farthest(dist, pivot);
+	std::vector<double> nearest(size, INF);
+	double max_finite = 0;
+	while(true)
+	{
+		pivots_.push_back(pivot);
+		dijkstra_(pivot, dist);
+		for(uint32_t i = 0; i < size; i++)
+		{
+			nearest[i] = std::min(nearest[i], dist[i]);
+			if(dist[i] != INF) { max_finite = std::max(max_finite, dist[i]); }
+		}
+		if(pivots_.size() == num_pivots) { break; }
+		if(!farthest(nearest, pivot)) { break; }
+	}
+	nearest = std::vector<double>();
+
+	// second pass: the distances of each pivot again, quantised
+	uint32_t k = uint32_t(pivots_.size());
+	stride_    = std::max(DH_LANES, (k + DH_LANES - 1) / DH_LANES * DH_LANES);
+	quantum_   = max_finite > 0 ? max_finite / (DH_INF - 1) : 1;
+	table_.assign(size_t{size} * stride_, DH_INF);
+	for(uint32_t p = 0; p < k; p++)
+	{
+		dijkstra_(pivots_[p], dist);
+		for(uint32_t i = 0; i < size; i++)
+		{
+			if(dist[i] == INF) { continue; }
+			table_[size_t{i} * stride_ + p] = uint16_t(
+			    std::min<double>(std::floor(dist[i] / quantum_), DH_INF - 1));
+		}
+	}
+	build_time_ = mytimer.elapsed_time_nano();
+}
+
+size_t
+differential_heuristic_builder::save(const char* filename) const
+{
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if(!out) { return 0; }
+
+	uint32_t k = uint32_t(pivots_.size());
+	dh_header header{};
+	header.magic_      = DH_MAGIC;
+	header.version_    = DH_VERSION;
+	header.width_      = map_->width();
+	header.height_     = map_->height();
+	header.num_pivots_ = k;
+	header.stride_
+	    = std::max(DH_LANES, (k + DH_LANES - 1) / DH_LANES * DH_LANES);
+	header.quantum_   = quantum_;
+	header.signature_ = map_->signature();
+	dh_layout layout(header.width_, header.height_, header.stride_);
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	std::vector<uint32_t> pivots(header.stride_, UINT32_MAX);
+	for(uint32_t p = 0; p < k; p++)
+	{
+		pivots[p] = uint32_t(pivots_[p].id);
+	}
+	out.write(
+	    reinterpret_cast<const char*>(pivots.data()),
+	    pivots.size() * sizeof(uint32_t));
+	const char zeros[16] = {};
+	out.write(zeros, layout.dist_ - (layout.pivot_ + pivots.size() * 4));
+
+	if(k == 0)
+	{
+		// no pivots: every cell has a row of DH_INF
+		std::vector<uint16_t> row(header.stride_, DH_INF);
+		for(uint32_t i = 0; i < header.width_ * header.height_; i++)
+		{
+			out.write(
+			    reinterpret_cast<const char*>(row.data()),
+			    row.size() * sizeof(uint16_t));
+		}
+	}
+	else
+	{
+		out.write(
+		    reinterpret_cast<const char*>(table_.data()),
+		    table_.size() * sizeof(uint16_t));
+	}
+	if(!out) { return 0; }
+	return layout.size_;
+}
+
+size_t
+differential_heuristic_builder::mem()
+{
+	return sizeof(*this) + expander_.mem()
+	    + pivots_.capacity() * sizeof(pad_id)
+	    + table_.capacity() * sizeof(uint16_t);
+}
+
+} // namespace warthog::heuristic
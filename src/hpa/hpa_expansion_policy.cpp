@@ -0,0 +1,88 @@
+#include <warthog/hpa/hpa_expansion_policy.h>
+
+namespace warthog::hpa
+{
+
+hpa_expansion_policy::hpa_expansion_policy(hpa_graph* graph)
+    : gridmap_expansion_policy_base(graph->get_map()), graph_(graph)
+{ }
+
+void
+hpa_expansion_policy::expand(
+    search::search_node* current, search::search_problem_instance*)
+{
+	reset();
+	pad_id id = current->get_id();
+
+	if(id == start_)
+	{
+		for(auto& [next, cost] : start_edges_)
+		{
+			add_neighbour(generate(next), cost);
+		}
+	}
+
+	uint32_t index = graph_->get_node_index(id);
+	if(index != hpa_graph::NO_INDEX)
+	{
+		const hpa_graph::cluster& c
+		    = graph_->get_cluster(graph_->get_cluster_id(id));
+		size_t n = c.nodes_.size();
+		for(size_t j = 0; j < n; j++)
+		{
+			cost_t cost = c.dist_[index * n + j];
+			if(j != index && cost != warthog::COST_MAX)
+			{
+				add_neighbour(generate(c.nodes_[j]), cost);
+			}
+		}
+		for(auto& [from, next] : c.exits_)
+		{
+			if(from == index) { add_neighbour(generate(next), 1); }
+		}
+	}
+
+	// edges are symmetric; an edge out of the target is an edge into it
+	for(auto& [prev, cost] : target_edges_)
+	{
+		if(prev == id) { add_neighbour(generate(target_), cost); }
+	}
+}
+
+search::search_node*
+hpa_expansion_policy::generate_start_node(search::search_problem_instance* pi)
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{pi->start_} >= max_id) { return 0; }
+	if(uint32_t{pi->target_} >= max_id) { return 0; }
+	if(map_->get_label(pi->start_) == 0) { return 0; }
+	if(map_->get_label(pi->target_) == 0) { return 0; }
+
+	// insert the start and target into the abstract graph
+	start_  = pi->start_;
+	target_ = pi->target_;
+	graph_->connect(start_, target_, start_edges_);
+	graph_->connect(target_, start_, target_edges_);
+	return generate(start_);
+}
+
+search::search_node*
+hpa_expansion_policy::generate_target_node(search::search_problem_instance* pi)
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{pi->target_} >= max_id) { return 0; }
+	if(map_->get_label(pi->target_) == 0) { return 0; }
+	return generate(pi->target_);
+}
+
+size_t
+hpa_expansion_policy::mem()
+{
+	return gridmap_expansion_policy_base::mem()
+	    + (sizeof(hpa_expansion_policy)
+	       - sizeof(gridmap_expansion_policy_base))
+	    + (start_edges_.capacity() + target_edges_.capacity())
+	    * sizeof(std::pair<pad_id, cost_t>);
+}
+
+} // namespace warthog::hpa
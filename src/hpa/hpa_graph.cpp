@@ -0,0 +1,318 @@
+#include <warthog/hpa/hpa_graph.h>
+#include <warthog/search/problem_instance.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+namespace warthog::hpa
+{
+
+hpa_graph::hpa_graph(domain::gridmap* map, uint32_t cluster_size)
+    : map_(map), expander_(map), cluster_size_(cluster_size)
+{
+	assert(cluster_size_ > 0);
+	expander_.set_nodes_pool_size(0);
+
+	uint32_t width  = map_->header_width();
+	uint32_t height = map_->header_height();
+	clusters_wide_  = (width + cluster_size_ - 1) / cluster_size_;
+	clusters_high_  = (height + cluster_size_ - 1) / cluster_size_;
+	clusters_.resize(size_t{clusters_wide_} * clusters_high_);
+	east_.resize(clusters_.size());
+	south_.resize(clusters_.size());
+	node_index_.assign(size_t{map_->width()} * map_->height(), NO_INDEX);
+	local_dist_.resize(size_t{cluster_size_} * cluster_size_);
+
+	for(uint32_t k = 0; k < clusters_.size(); k++)
+	{
+		cluster& c = clusters_[k];
+		c.x_       = (k % clusters_wide_) * cluster_size_;
+		c.y_       = (k / clusters_wide_) * cluster_size_;
+		c.width_   = std::min(cluster_size_, width - c.x_);
+		c.height_  = std::min(cluster_size_, height - c.y_);
+	}
+	for(uint32_t k = 0; k < clusters_.size(); k++)
+	{
+		if(k % clusters_wide_ + 1 < clusters_wide_) { build_border_(k, true); }
+		if(k / clusters_wide_ + 1 < clusters_high_)
+		{
+			build_border_(k, false);
+		}
+	}
+	for(uint32_t k = 0; k < clusters_.size(); k++)
+	{
+		build_cluster_(k);
+	}
+}
+
+uint32_t
+hpa_graph::get_cluster_id(pad_id id) const
+{
+	uint32_t x, y;
+	map_->to_unpadded_xy(id, x, y);
+	return (y / cluster_size_) * clusters_wide_ + (x / cluster_size_);
+}
+
+uint32_t
+hpa_graph::get_num_nodes() const
+{
+	uint32_t num_nodes = 0;
+	for(const cluster& c : clusters_)
+	{
+		num_nodes += uint32_t(c.nodes_.size());
+	}
+	return num_nodes;
+}
+
+void
+hpa_graph::build_border_(uint32_t cluster_id, bool east)
+{
+	const cluster& c = clusters_[cluster_id];
+	std::vector<uint32_t>& trans
+	    = east ? east_[cluster_id] : south_[cluster_id];
+	trans.clear();
+
+	// are the cells either side of the border, at offset i along it, open?
+	uint32_t length = east ? c.height_ : c.width_;
+	auto open       = [&](uint32_t i) {
+		if(east)
+		{
+			uint32_t x = c.x_ + c.width_ - 1;
+			return traversable_(x, c.y_ + i) && traversable_(x + 1, c.y_ + i);
+		}
+		uint32_t y = c.y_ + c.height_ - 1;
+		return traversable_(c.x_ + i, y) && traversable_(c.x_ + i, y + 1);
+	};
+
+	uint32_t i = 0;
+	while(i < length)
+	{
+		if(!open(i))
+		{
+			i++;
+			continue;
+		}
+		uint32_t first = i;
+		while(i < length && open(i))
+		{
+			i++;
+		}
+		uint32_t last   = i - 1;
+		uint32_t offset = east ? c.y_ : c.x_;
+		if(last - first + 1 < MAX_ENTRANCE_WIDTH)
+		{
+			trans.push_back(offset + (first + last) / 2);
+		}
+		else
+		{
+			trans.push_back(offset + first);
+			trans.push_back(offset + last);
+		}
+	}
+}
+
+void
+hpa_graph::build_cluster_(uint32_t cluster_id)
+{
+	cluster& c = clusters_[cluster_id];
+	for(pad_id id : c.nodes_)
+	{
+		node_index_[uint32_t(id.id)] = NO_INDEX;
+	}
+	c.nodes_.clear();
+	c.exits_.clear();
+
+	auto add = [&](uint32_t x, uint32_t y, uint32_t ox, uint32_t oy) {
+		pad_id id       = map_->to_padded_id_from_unpadded(x, y);
+		uint32_t& index = node_index_[uint32_t(id.id)];
+		if(index == NO_INDEX)
+		{
+			index = uint32_t(c.nodes_.size());
+			c.nodes_.push_back(id);
+		}
+		c.exits_.emplace_back(index, map_->to_padded_id_from_unpadded(ox, oy));
+	};
+
+	uint32_t cx = cluster_id % clusters_wide_;
+	uint32_t cy = cluster_id / clusters_wide_;
+	uint32_t x1 = c.x_ + c.width_ - 1;
+	uint32_t y1 = c.y_ + c.height_ - 1;
+	for(uint32_t y : east_[cluster_id])
+	{
+		add(x1, y, x1 + 1, y);
+	}
+	for(uint32_t x : south_[cluster_id])
+	{
+		add(x, y1, x, y1 + 1);
+	}
+	if(cx > 0)
+	{
+		for(uint32_t y : east_[cluster_id - 1])
+		{
+			add(c.x_, y, c.x_ - 1, y);
+		}
+	}
+	if(cy > 0)
+	{
+		for(uint32_t x : south_[cluster_id - clusters_wide_])
+		{
+			add(x, c.y_, x, c.y_ - 1);
+		}
+	}
+
+	size_t n = c.nodes_.size();
+	c.dist_.assign(n * n, warthog::COST_MAX);
+	for(size_t i = 0; i < n; i++)
+	{
+		search_cluster_(c, c.nodes_[i]);
+		for(size_t j = 0; j < n; j++)
+		{
+			uint32_t x, y;
+			map_->to_unpadded_xy(c.nodes_[j], x, y);
+			c.dist_[i * n + j]
+			    = local_dist_[(y - c.y_) * c.width_ + (x - c.x_)];
+		}
+	}
+	num_rebuilds_++;
+}
+
+void
+hpa_graph::search_cluster_(const cluster& c, pad_id source)
+{
+	search::search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search::search_node current;
+	using entry = std::pair<cost_t, uint32_t>;
+	std::priority_queue<entry, std::vector<entry>, std::greater<entry>> open;
+
+	auto local = [&](pad_id id, uint32_t& index) {
+		uint32_t x, y;
+		map_->to_unpadded_xy(id, x, y);
+		if(x < c.x_ || y < c.y_ || x >= c.x_ + c.width_
+		   || y >= c.y_ + c.height_)
+		{
+			return false;
+		}
+		index = (y - c.y_) * c.width_ + (x - c.x_);
+		return true;
+	};
+
+	std::fill(
+	    local_dist_.begin(), local_dist_.begin() + c.width_ * c.height_,
+	    warthog::COST_MAX);
+	uint32_t index = 0;
+	local(source, index);
+	local_dist_[index] = 0;
+	open.push({0, uint32_t(source.id)});
+	while(!open.empty())
+	{
+		auto [d, id] = open.top();
+		open.pop();
+		local(pad_id{id}, index);
+		if(d > local_dist_[index]) { continue; }
+
+		current.set_id(pad_id{id});
+		expander_.expand(&current, &spi);
+		search::search_node* n = nullptr;
+		cost_t cost            = 0;
+		for(uint32_t i = 0; i < expander_.get_num_successors(); i++)
+		{
+			expander_.get_successor(i, n, cost);
+			uint32_t next;
+			if(!local(n->get_id(), next)) { continue; }
+			if(d + cost < local_dist_[next])
+			{
+				local_dist_[next] = d + cost;
+				open.push({d + cost, uint32_t(n->get_id().id)});
+			}
+		}
+	}
+}
+
+void
+hpa_graph::connect(
+    pad_id id, pad_id other, std::vector<std::pair<pad_id, cost_t>>& out)
+{
+	out.clear();
+	const cluster& c = clusters_[get_cluster_id(id)];
+	search_cluster_(c, id);
+	auto dist = [&](pad_id to) {
+		uint32_t x, y;
+		map_->to_unpadded_xy(to, x, y);
+		return local_dist_[(y - c.y_) * c.width_ + (x - c.x_)];
+	};
+	for(pad_id node : c.nodes_)
+	{
+		cost_t d = dist(node);
+		if(node != id && d != warthog::COST_MAX) { out.emplace_back(node, d); }
+	}
+	if(other != id && get_cluster_id(other) == get_cluster_id(id))
+	{
+		cost_t d = dist(other);
+		if(d != warthog::COST_MAX) { out.emplace_back(other, d); }
+	}
+}
+
+void
+hpa_graph::set_label(uint32_t x, uint32_t y, bool label)
+{
+	if(traversable_(x, y) == label) { return; }
+	map_->set_label(x, y, label);
+
+	// intra-cluster costs depend only on the cells of a cluster, and the
+	// transitions of a border only on the cells either side of it
+	uint32_t cx       = x / cluster_size_;
+	uint32_t cy       = y / cluster_size_;
+	uint32_t k        = cy * clusters_wide_ + cx;
+	const cluster& c  = clusters_[k];
+	uint32_t dirty[5] = {k};
+	uint32_t num      = 1;
+	if(x == c.x_ + c.width_ - 1 && cx + 1 < clusters_wide_)
+	{
+		build_border_(k, true);
+		dirty[num++] = k + 1;
+	}
+	if(x == c.x_ && cx > 0)
+	{
+		build_border_(k - 1, true);
+		dirty[num++] = k - 1;
+	}
+	if(y == c.y_ + c.height_ - 1 && cy + 1 < clusters_high_)
+	{
+		build_border_(k, false);
+		dirty[num++] = k + clusters_wide_;
+	}
+	if(y == c.y_ && cy > 0)
+	{
+		build_border_(k - clusters_wide_, false);
+		dirty[num++] = k - clusters_wide_;
+	}
+	for(uint32_t i = 0; i < num; i++)
+	{
+		build_cluster_(dirty[i]);
+	}
+}
+
+size_t
+hpa_graph::mem()
+{
+	size_t size = sizeof(*this) + expander_.mem()
+	    + clusters_.capacity() * sizeof(cluster)
+	    + (east_.capacity() + south_.capacity()) * sizeof(std::vector<uint32_t>)
+	    + node_index_.capacity() * sizeof(uint32_t)
+	    + local_dist_.capacity() * sizeof(cost_t);
+	for(const cluster& c : clusters_)
+	{
+		size += c.nodes_.capacity() * sizeof(pad_id)
+		    + c.dist_.capacity() * sizeof(cost_t)
+		    + c.exits_.capacity() * sizeof(std::pair<uint32_t, pad_id>);
+	}
+	for(size_t k = 0; k < clusters_.size(); k++)
+	{
+		size += (east_[k].capacity() + south_[k].capacity())
+		    * sizeof(uint32_t);
+	}
+	return size;
+}
+
+} // namespace warthog::hpa
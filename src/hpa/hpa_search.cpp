@@ -0,0 +1,89 @@
+#include <warthog/hpa/hpa_search.h>
+#include <warthog/util/timer.h>
+
+namespace warthog::hpa
+{
+
+hpa_search::hpa_search(hpa_graph* graph)
+    : graph_(graph),
+      heuristic_(graph->get_map()->width(), graph->get_map()->height()),
+      abstract_expander_(graph), refine_expander_(graph->get_map()),
+      abstract_(&heuristic_, &abstract_expander_, &abstract_open_),
+      refine_(&heuristic_, &refine_expander_, &refine_open_)
+{ }
+
+void
+hpa_search::add_metrics_(
+    search::search_metrics& to, const search::search_metrics& from)
+{
+	to.nodes_expanded_  += from.nodes_expanded_;
+	to.nodes_generated_ += from.nodes_generated_;
+	to.nodes_surplus_   += from.nodes_surplus_;
+	to.nodes_reopen_    += from.nodes_reopen_;
+	to.heap_ops_        += from.heap_ops_;
+}
+
+void
+hpa_search::get_pathcost(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	abstract_.get_pathcost(pi, par, sol);
+}
+
+void
+hpa_search::get_path(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	util::timer mytimer;
+	mytimer.start();
+	sol->reset();
+
+	abstract_sol_.reset();
+	abstract_.get_path(pi, par, &abstract_sol_);
+	add_metrics_(sol->met_, abstract_sol_.met_);
+	if(abstract_sol_.path_.empty())
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	// refine each abstract edge into a grid path
+	search::search_parameters refine_par;
+	std::vector<pack_id>& abstract_path = abstract_sol_.path_;
+	cost_t cost                         = 0;
+	sol->path_.push_back(abstract_path.front());
+	for(size_t i = 1; i < abstract_path.size(); i++)
+	{
+		search::problem_instance edge(
+		    abstract_path[i - 1], abstract_path[i], pi->verbose_);
+		segment_.reset();
+		refine_.get_path(&edge, &refine_par, &segment_);
+		add_metrics_(sol->met_, segment_.met_);
+		if(segment_.path_.empty())
+		{
+			// cannot happen unless the map changed behind the graph
+			sol->path_.clear();
+			sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+			return;
+		}
+		sol->path_.insert(
+		    sol->path_.end(), segment_.path_.begin() + 1,
+		    segment_.path_.end());
+		cost += segment_.sum_of_edge_costs_;
+	}
+	sol->sum_of_edge_costs_      = cost;
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+size_t
+hpa_search::mem()
+{
+	return sizeof(*this) + graph_->mem() + abstract_expander_.mem()
+	    + refine_expander_.mem() + abstract_open_.mem() + refine_open_.mem()
+	    + (abstract_sol_.path_.capacity() + segment_.path_.capacity())
+	    * sizeof(pack_id);
+}
+
+} // namespace warthog::hpa
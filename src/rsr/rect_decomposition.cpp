@@ -0,0 +1,293 @@
+#include <warthog/rsr/rect_decomposition.h>
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+
+namespace warthog::rsr
+{
+
+namespace
+{
+
+// bits [@param lo, @param hi] of a word, 0 <= lo <= hi < 64
+uint64_t
+bits(uint32_t lo, uint32_t hi)
+{
+	return (~uint64_t{0} >> (63 - hi)) & (~uint64_t{0} << lo);
+}
+
+} // namespace
+
+rect_decomposition::rect_decomposition(domain::gridmap* map)
+    : map_(map), words_per_row_(map->width() / 64)
+{ }
+
+void
+rect_decomposition::build()
+{
+	reset_();
+	decompose_({0, 0, map_->width() - 1, map_->height() - 1});
+}
+
+void
+rect_decomposition::reset_()
+{
+	rects_.clear();
+	unused_.clear();
+	num_rects_ = 0;
+	rect_of_.assign(map_->padded_mapsize(), NO_RECT);
+
+	// rows of the gridmap are word aligned
+	avail_.resize(map_->padded_mapsize() / 64);
+	for(uint32_t i = 0; i < avail_.size(); i++)
+	{
+		pad_id id{i * 64};
+		avail_[i] = map_->get_neighbours_slider(id).get_block_64bit_le();
+	}
+}
+
+bool
+rect_decomposition::row_avail_(uint32_t y, uint32_t x1, uint32_t x2) const
+{
+	const uint64_t* row = &avail_[size_t(y) * words_per_row_];
+	for(uint32_t k = x1 >> 6; k <= x2 >> 6; k++)
+	{
+		uint32_t lo   = k == x1 >> 6 ? x1 & 63 : 0;
+		uint32_t hi   = k == x2 >> 6 ? x2 & 63 : 63;
+		uint64_t mask = bits(lo, hi);
+		if((row[k] & mask) != mask) { return false; }
+	}
+	return true;
+}
+
+bool
+rect_decomposition::col_avail_(uint32_t x, uint32_t y1, uint32_t y2) const
+{
+	uint64_t bit = uint64_t{1} << (x & 63);
+	for(uint32_t y = y1; y <= y2; y++)
+	{
+		if(!(avail_[size_t(y) * words_per_row_ + (x >> 6)] & bit))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+rect_decomposition::decompose_(const rsr_rect& r)
+{
+	for(uint32_t y = r.y1_; y <= r.y2_; y++)
+	{
+		const uint64_t* row = &avail_[size_t(y) * words_per_row_];
+		for(uint32_t k = r.x1_ >> 6; k <= r.x2_ >> 6; k++)
+		{
+			uint32_t lo = k == r.x1_ >> 6 ? r.x1_ & 63 : 0;
+			uint32_t hi = k == r.x2_ >> 6 ? r.x2_ & 63 : 63;
+			// each new rectangle clears its cells, including the first
+			for(uint64_t w = row[k] & bits(lo, hi); w;
+			    w = row[k] & bits(lo, hi))
+			{
+				uint32_t x = k * 64 + uint32_t(std::countr_zero(w));
+				rsr_rect rect{x, y, x, y};
+				while(col_avail_(rect.x2_ + 1, y, rect.y2_)
+				      && row_avail_(rect.y2_ + 1, x, rect.x2_ + 1))
+				{
+					rect.x2_++;
+					rect.y2_++;
+				}
+				while(col_avail_(rect.x2_ + 1, y, rect.y2_))
+				{
+					rect.x2_++;
+				}
+				while(row_avail_(rect.y2_ + 1, x, rect.x2_))
+				{
+					rect.y2_++;
+				}
+				add_(rect);
+			}
+		}
+	}
+}
+
+void
+rect_decomposition::set_avail_(const rsr_rect& r, bool avail)
+{
+	for(uint32_t y = r.y1_; y <= r.y2_; y++)
+	{
+		uint64_t* row = &avail_[size_t(y) * words_per_row_];
+		for(uint32_t k = r.x1_ >> 6; k <= r.x2_ >> 6; k++)
+		{
+			uint32_t lo   = k == r.x1_ >> 6 ? r.x1_ & 63 : 0;
+			uint32_t hi   = k == r.x2_ >> 6 ? r.x2_ & 63 : 63;
+			uint64_t mask = bits(lo, hi);
+			row[k]        = avail ? row[k] | mask : row[k] & ~mask;
+		}
+	}
+}
+
+void
+rect_decomposition::add_(const rsr_rect& r)
+{
+	uint32_t rect_id;
+	if(unused_.empty())
+	{
+		rect_id = uint32_t(rects_.size());
+		rects_.push_back(r);
+	}
+	else
+	{
+		rect_id = unused_.back();
+		unused_.pop_back();
+		rects_[rect_id] = r;
+	}
+	num_rects_++;
+
+	set_avail_(r, false);
+	for(uint32_t y = r.y1_; y <= r.y2_; y++)
+	{
+		uint32_t first = map_->to_padded_id_from_padded(r.x1_, y).id;
+		std::fill_n(&rect_of_[first], r.x2_ - r.x1_ + 1, rect_id);
+	}
+}
+
+void
+rect_decomposition::release_(uint32_t rect_id)
+{
+	const rsr_rect& r = rects_[rect_id];
+	set_avail_(r, true);
+	for(uint32_t y = r.y1_; y <= r.y2_; y++)
+	{
+		uint32_t first = map_->to_padded_id_from_padded(r.x1_, y).id;
+		std::fill_n(&rect_of_[first], r.x2_ - r.x1_ + 1, NO_RECT);
+	}
+	unused_.push_back(rect_id);
+	num_rects_--;
+}
+
+void
+rect_decomposition::set_label(uint32_t x, uint32_t y, bool label)
+{
+	pad_id id = map_->to_padded_id_from_unpadded(x, y);
+	if(bool(map_->get_label(id)) == label) { return; }
+	map_->set_label(x, y, label);
+
+	uint32_t px, py;
+	map_->to_padded_xy(id, px, py);
+	uint64_t& word = avail_[id.id >> 6];
+	uint64_t bit   = uint64_t{1} << (id.id & 63);
+
+	if(!label)
+	{
+		// split the rectangle of the cell
+		rsr_rect bounds = rects_[rect_of_[id.id]];
+		release_(rect_of_[id.id]);
+		word &= ~bit;
+		decompose_(bounds);
+		return;
+	}
+
+	// merge the cell with the rectangles next to it
+	rsr_rect bounds{px, py, px, py};
+	const pad_id next[4]
+	    = {pad_id{id.id - map_->width()}, pad_id{id.id + 1},
+	       pad_id{id.id + map_->width()}, pad_id{id.id - 1}};
+	for(pad_id n : next)
+	{
+		uint32_t rect_id = rect_of_[n.id];
+		if(rect_id == NO_RECT) { continue; }
+		const rsr_rect& r = rects_[rect_id];
+		bounds.x1_        = std::min(bounds.x1_, r.x1_);
+		bounds.y1_        = std::min(bounds.y1_, r.y1_);
+		bounds.x2_        = std::max(bounds.x2_, r.x2_);
+		bounds.y2_        = std::max(bounds.y2_, r.y2_);
+		release_(rect_id);
+	}
+	word |= bit;
+	decompose_(bounds);
+}
+
+size_t
+rect_decomposition::save(const char* filename) const
+{
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if(!out) { return 0; }
+
+	rsr_header header{};
+	header.magic_     = RSR_MAGIC;
+	header.version_   = RSR_VERSION;
+	header.width_     = map_->width();
+	header.height_    = map_->height();
+	header.num_rects_ = num_rects_;
+	header.signature_ = map_->signature();
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	// live rectangles only
+	for(uint32_t i = 0; i < rects_.size(); i++)
+	{
+		const rsr_rect& r = rects_[i];
+		pad_id corner     = map_->to_padded_id_from_padded(r.x1_, r.y1_);
+		if(rect_of_[corner.id] != i) { continue; }
+		out.write(reinterpret_cast<const char*>(&r), sizeof(r));
+	}
+	if(!out) { return 0; }
+	return sizeof(header) + size_t{num_rects_} * sizeof(rsr_rect);
+}
+
+bool
+rect_decomposition::load(const char* filename)
+{
+	std::ifstream in(filename, std::ios::binary);
+	rsr_header header;
+	if(!in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+	{
+		return false;
+	}
+	if(header.magic_ != RSR_MAGIC || header.version_ != RSR_VERSION
+	   || header.width_ != map_->width() || header.height_ != map_->height()
+	   || header.signature_ != map_->signature())
+	{
+		return false;
+	}
+	std::vector<rsr_rect> rects(header.num_rects_);
+	if(!in.read(
+	       reinterpret_cast<char*>(rects.data()),
+	       rects.size() * sizeof(rsr_rect)))
+	{
+		return false;
+	}
+
+	// the rectangles must cover the traversable cells exactly
+	reset_();
+	for(const rsr_rect& r : rects)
+	{
+		bool valid = r.x1_ <= r.x2_ && r.y1_ <= r.y2_
+		    && r.x2_ < header.width_ && r.y2_ < header.height_;
+		for(uint32_t y = r.y1_; valid && y <= r.y2_; y++)
+		{
+			valid = row_avail_(y, r.x1_, r.x2_);
+		}
+		if(!valid) { break; }
+		add_(r);
+	}
+	if(num_rects_ != rects.size()
+	   || std::any_of(avail_.begin(), avail_.end(), [](uint64_t w) {
+		      return w != 0;
+	      }))
+	{
+		reset_();
+		return false;
+	}
+	return true;
+}
+
+size_t
+rect_decomposition::mem() const
+{
+	return sizeof(*this) + rects_.capacity() * sizeof(rsr_rect)
+	    + (rect_of_.capacity() + unused_.capacity()) * sizeof(uint32_t)
+	    + avail_.capacity() * sizeof(uint64_t);
+}
+
+} // namespace warthog::rsr
@@ -0,0 +1,170 @@
+#include <warthog/rsr/rsr_expansion_policy.h>
+
+#include <algorithm>
+
+namespace warthog::rsr
+{
+
+rsr_expansion_policy::rsr_expansion_policy(
+    domain::gridmap* map, rect_decomposition* rects)
+    : gridmap_expansion_policy_base(map), rects_(rects)
+{ }
+
+void
+rsr_expansion_policy::add_(uint32_t x, uint32_t y, uint32_t fx, uint32_t fy)
+{
+	uint32_t dx   = x > fx ? x - fx : fx - x;
+	uint32_t dy   = y > fy ? y - fy : fy - y;
+	uint32_t diag = std::min(dx, dy);
+	cost_t cost   = diag * warthog::DBL_ROOT_TWO + (std::max(dx, dy) - diag);
+	add_neighbour(generate(map_->to_padded_id_from_padded(x, y)), cost);
+}
+
+void
+rsr_expansion_policy::add_cone_(
+    const rsr_rect& r, uint32_t x, uint32_t y, bool vertical, uint32_t line)
+{
+	if(!vertical)
+	{
+		uint32_t d  = line > y ? line - y : y - line;
+		uint32_t lo = x >= r.x1_ + d ? x - d : r.x1_;
+		uint32_t hi = std::min(r.x2_, x + d);
+		for(uint32_t cx = lo; cx <= hi; cx++)
+		{
+			add_(cx, line, x, y);
+		}
+	}
+	else
+	{
+		uint32_t d  = line > x ? line - x : x - line;
+		uint32_t lo = y >= r.y1_ + d ? y - d : r.y1_;
+		uint32_t hi = std::min(r.y2_, y + d);
+		for(uint32_t cy = lo; cy <= hi; cy++)
+		{
+			add_(line, cy, x, y);
+		}
+	}
+}
+
+void
+rsr_expansion_policy::expand(
+    search::search_node* current, search::search_problem_instance* pi)
+{
+	reset();
+
+	pad_id nodeid     = current->get_id();
+	uint32_t rect_id  = rects_->get_rect_id(nodeid);
+	const rsr_rect& r = rects_->get_rect(rect_id);
+	uint32_t x, y;
+	map_->to_padded_xy(nodeid, x, y);
+
+	// a target inside the rectangle is reached directly
+	uint32_t tx = 0, ty = 0;
+	bool target = false;
+	if(pi->target_ != nodeid && uint32_t{pi->target_} < map_->padded_mapsize()
+	   && rects_->get_rect_id(pi->target_) == rect_id)
+	{
+		map_->to_padded_xy(pi->target_, tx, ty);
+		target = r.in_interior(tx, ty);
+	}
+
+	if(r.in_interior(x, y))
+	{
+		// only the start is ever in the interior
+		add_cone_(r, x, y, false, r.y1_);
+		add_cone_(r, x, y, false, r.y2_);
+		add_cone_(r, x, y, true, r.x1_);
+		add_cone_(r, x, y, true, r.x2_);
+		if(target) { add_(tx, ty, x, y); }
+		return;
+	}
+
+	// neighbours, as in gridmap_expansion_policy, outside the interior
+	uint32_t tiles = 0;
+	map_->get_neighbours(nodeid, (uint8_t*)&tiles);
+	auto neighbour = [&](int32_t dx, int32_t dy, cost_t cost) {
+		if(r.in_interior(x + dx, y + dy)) { return; }
+		pad_id id{nodeid.id + dy * int32_t(map_->width()) + dx};
+		add_neighbour(generate(id), cost);
+	};
+	if((tiles & 514) == 514) { neighbour(0, -1, 1); }      // N
+	if((tiles & 1536) == 1536) { neighbour(1, 0, 1); }     // E
+	if((tiles & 131584) == 131584) { neighbour(0, 1, 1); } // S
+	if((tiles & 768) == 768) { neighbour(-1, 0, 1); }      // W
+	if((tiles & 1542) == 1542) // NE
+	{
+		neighbour(1, -1, warthog::DBL_ROOT_TWO);
+	}
+	if((tiles & 394752) == 394752) // SE
+	{
+		neighbour(1, 1, warthog::DBL_ROOT_TWO);
+	}
+	if((tiles & 197376) == 197376) // SW
+	{
+		neighbour(-1, 1, warthog::DBL_ROOT_TWO);
+	}
+	if((tiles & 771) == 771) // NW
+	{
+		neighbour(-1, -1, warthog::DBL_ROOT_TWO);
+	}
+
+	// macro edges to the opposite sides; sides one row or column away are
+	// neighbours already
+	if(y == r.y1_ && r.y2_ - y >= 2) { add_cone_(r, x, y, false, r.y2_); }
+	if(y == r.y2_ && y - r.y1_ >= 2) { add_cone_(r, x, y, false, r.y1_); }
+	if(x == r.x1_ && r.x2_ - x >= 2) { add_cone_(r, x, y, true, r.x2_); }
+	if(x == r.x2_ && x - r.x1_ >= 2) { add_cone_(r, x, y, true, r.x1_); }
+
+	// diagonal macro edges which end on an adjacent side; those ending on
+	// the opposite side are in its cone
+	for(int32_t dy = -1; dy <= 1; dy += 2)
+	{
+		for(int32_t dx = -1; dx <= 1; dx += 2)
+		{
+			uint32_t kx = dx > 0 ? r.x2_ - x : x - r.x1_;
+			uint32_t ky = dy > 0 ? r.y2_ - y : y - r.y1_;
+			uint32_t k  = std::min(kx, ky);
+			if(k < 2) { continue; }
+			uint32_t qx = x + dx * int32_t(k);
+			uint32_t qy = y + dy * int32_t(k);
+			if((y == r.y1_ && qy == r.y2_) || (y == r.y2_ && qy == r.y1_)
+			   || (x == r.x1_ && qx == r.x2_) || (x == r.x2_ && qx == r.x1_))
+			{
+				continue;
+			}
+			add_(qx, qy, x, y);
+		}
+	}
+
+	if(target) { add_(tx, ty, x, y); }
+}
+
+search::search_node*
+rsr_expansion_policy::generate_start_node(search::search_problem_instance* pi)
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{pi->start_} >= max_id) { return 0; }
+	if(map_->get_label(pi->start_) == 0) { return 0; }
+	if(unreachable_(pi)) { return 0; }
+	return generate(pi->start_);
+}
+
+search::search_node*
+rsr_expansion_policy::generate_target_node(search::search_problem_instance* pi)
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{pi->target_} >= max_id) { return 0; }
+	if(map_->get_label(pi->target_) == 0) { return 0; }
+	return generate(pi->target_);
+}
+
+size_t
+rsr_expansion_policy::mem()
+{
+	return gridmap_expansion_policy_base::mem()
+	    + (sizeof(rsr_expansion_policy)
+	       - sizeof(gridmap_expansion_policy_base))
+	    + rects_->mem();
+}
+
+} // namespace warthog::rsr
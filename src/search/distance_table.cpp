@@ -0,0 +1,182 @@
+#include <warthog/search/distance_table.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace warthog::search
+{
+
+distance_table::distance_table(domain::gridmap* map, uint32_t num_threads)
+{
+	if(num_threads == 0)
+	{
+		num_threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	for(uint32_t i = 0; i < num_threads; i++)
+	{
+		workers_.emplace_back(new worker(map));
+		workers_.back()->instance_.mode_ = target_mode::all;
+	}
+	for(uint32_t i = 1; i < num_threads; i++)
+	{
+		threads_.emplace_back([this, i]() { serve_(i); });
+	}
+}
+
+distance_table::~distance_table()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock_);
+		stop_ = true;
+	}
+	wake_.notify_all();
+	for(std::thread& th : threads_) { th.join(); }
+}
+
+void
+distance_table::compute(
+    const std::vector<pack_id>& sources, const std::vector<pack_id>& targets)
+{
+	util::timer mytimer;
+	mytimer.start();
+	met_.reset();
+	num_sources_ = uint32_t(sources.size());
+	num_targets_ = uint32_t(targets.size());
+	table_.assign(size_t(num_sources_) * num_targets_, warthog::COST_MAX);
+
+	// one search per row or per column, whichever are fewer
+	transposed_ = num_targets_ < num_sources_;
+	roots_      = transposed_ ? targets : sources;
+	const std::vector<pack_id>& ends = transposed_ ? sources : targets;
+
+	std::unordered_map<uint32_t, uint32_t> seen;
+	first_.resize(roots_.size());
+	for(uint32_t i = 0; i < roots_.size(); i++)
+	{
+		first_[i] = seen.try_emplace(roots_[i].id, i).first->second;
+	}
+
+	for(auto& w : workers_) { w->met_.reset(); }
+	uint32_t num_workers
+	    = std::min<uint32_t>(uint32_t(workers_.size()), uint32_t(seen.size()));
+	if(num_workers > 0 && !ends.empty())
+	{
+		for(uint32_t i = 0; i < num_workers; i++)
+		{
+			workers_[i]->instance_.targets_ = ends;
+		}
+		next_ = 0;
+		if(num_workers > 1)
+		{
+			{
+				std::lock_guard<std::mutex> guard(lock_);
+				num_active_ = num_workers;
+				pending_    = num_workers - 1;
+				round_++;
+			}
+			wake_.notify_all();
+		}
+		run_(*workers_[0]);
+		if(num_workers > 1)
+		{
+			std::unique_lock<std::mutex> guard(lock_);
+			done_.wait(guard, [this]() { return pending_ == 0; });
+		}
+
+		for(uint32_t i = 0; i < num_workers; i++)
+		{
+			const search_metrics& m = workers_[i]->met_;
+			met_.nodes_expanded_   += m.nodes_expanded_;
+			met_.nodes_generated_  += m.nodes_generated_;
+			met_.heap_ops_         += m.heap_ops_;
+		}
+	}
+
+	// equal roots have equal costs
+	for(uint32_t i = 0; i < roots_.size(); i++)
+	{
+		if(first_[i] == i) { continue; }
+		for(uint32_t j = 0; j < ends.size(); j++)
+		{
+			if(transposed_)
+			{
+				table_[size_t(j) * num_targets_ + i]
+				    = table_[size_t(j) * num_targets_ + first_[i]];
+			}
+			else
+			{
+				table_[size_t(i) * num_targets_ + j]
+				    = table_[size_t(first_[i]) * num_targets_ + j];
+			}
+		}
+	}
+	met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+void
+distance_table::serve_(uint32_t i)
+{
+	uint64_t seen = 0;
+	while(true)
+	{
+		{
+			std::unique_lock<std::mutex> guard(lock_);
+			wake_.wait(
+			    guard, [this, seen]() { return stop_ || round_ != seen; });
+			if(stop_) { return; }
+			seen = round_;
+			if(i >= num_active_) { continue; }
+		}
+		run_(*workers_[i]);
+		std::lock_guard<std::mutex> guard(lock_);
+		if(--pending_ == 0) { done_.notify_one(); }
+	}
+}
+
+void
+distance_table::run_(worker& w)
+{
+	search_parameters par;
+	for(uint32_t r = next_++; r < roots_.size(); r = next_++)
+	{
+		if(first_[r] != r) { continue; }
+		w.instance_.start_ = roots_[r];
+		solution sol;
+		w.search_.get_pathcost(&w.instance_, &par, &sol);
+		w.met_.nodes_expanded_  += sol.met_.nodes_expanded_;
+		w.met_.nodes_generated_ += sol.met_.nodes_generated_;
+		w.met_.heap_ops_        += sol.met_.heap_ops_;
+		store_(r, w.search_);
+	}
+}
+
+void
+distance_table::store_(uint32_t r, const multi_target_search& search)
+{
+	uint32_t num_ends = transposed_ ? num_sources_ : num_targets_;
+	for(uint32_t j = 0; j < num_ends; j++)
+	{
+		if(transposed_)
+		{
+			table_[size_t(j) * num_targets_ + r] = search.get_cost(j);
+		}
+		else { table_[size_t(r) * num_targets_ + j] = search.get_cost(j); }
+	}
+}
+
+size_t
+distance_table::mem()
+{
+	size_t size = sizeof(*this) + table_.capacity() * sizeof(cost_t)
+	    + roots_.capacity() * sizeof(pack_id)
+	    + first_.capacity() * sizeof(uint32_t);
+	for(auto& w : workers_)
+	{
+		size += sizeof(worker) + w->search_.mem()
+		    + w->instance_.targets_.capacity() * sizeof(pack_id);
+	}
+	return size;
+}
+
+} // namespace warthog::search
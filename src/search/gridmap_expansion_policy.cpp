@@ -88,6 +88,19 @@ gridmap_expansion_policy_base::mem()
 	    + map_->mem();
 }
 
+bool
+gridmap_expansion_policy_base::unreachable_(
+    search_problem_instance* pi) const noexcept
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(!components_ || uint32_t{pi->target_} >= max_id) { return false; }
+	// blocked targets include the padding, whose unpadded ids are not
+	// cells of the map
+	if(!map_->get_label(pi->target_)) { return true; }
+	return !components_->connected(
+	    map_->to_unpadded_id(pi->start_), map_->to_unpadded_id(pi->target_));
+}
+
 gridmap_expansion_policy::gridmap_expansion_policy(
     domain::gridmap* map, bool manhattan)
     : gridmap_expansion_policy_base(map), manhattan_(manhattan)
@@ -98,10 +111,14 @@ gridmap_expansion_policy::expand(
     search_node* current, search_problem_instance* problem)
 {
 	reset();
+	generate_moves_(current->get_id(), manhattan_ ? 0x0f : 0xff);
+}
 
+void
+gridmap_expansion_policy::generate_moves_(pad_id nodeid, uint32_t moves)
+{
 	// get terrain type of each tile in the 3x3 square around (x, y)
 	uint32_t tiles = 0;
-	pad_id nodeid  = current->get_id();
 	map_->get_neighbours(nodeid, (uint8_t*)&tiles);
 
 	//	#ifndef NDEBUG
@@ -123,41 +140,41 @@ gridmap_expansion_policy::expand(
 	pad_id nid_p_w = pad_id{nodeid.id + map_->width()};
 
 	// generate cardinal moves
-	if((tiles & 514) == 514) // N
+	if((tiles & 514) == 514 && (moves & 1)) // N
 	{
 		add_neighbour(this->generate(nid_m_w), 1);
 	}
-	if((tiles & 1536) == 1536) // E
+	if((tiles & 1536) == 1536 && (moves & 2)) // E
 	{
 		add_neighbour(this->generate(pad_id{nodeid.id + 1}), 1);
 	}
-	if((tiles & 131584) == 131584) // S
+	if((tiles & 131584) == 131584 && (moves & 4)) // S
 	{
 		add_neighbour(this->generate(nid_p_w), 1);
 	}
-	if((tiles & 768) == 768) // W
+	if((tiles & 768) == 768 && (moves & 8)) // W
 	{
 		add_neighbour(this->generate(pad_id{nodeid.id - 1}), 1);
 	}
-	if(manhattan_) { return; }
+	if((moves & 0xf0) == 0) { return; }
 
 	// generate diagonal moves
-	if((tiles & 1542) == 1542) // NE
+	if((tiles & 1542) == 1542 && (moves & 16)) // NE
 	{
 		add_neighbour(
 		    this->generate(pad_id{nid_m_w.id + 1}), warthog::DBL_ROOT_TWO);
 	}
-	if((tiles & 394752) == 394752) // SE
+	if((tiles & 394752) == 394752 && (moves & 32)) // SE
 	{
 		add_neighbour(
 		    this->generate(pad_id{nid_p_w.id + 1}), warthog::DBL_ROOT_TWO);
 	}
-	if((tiles & 197376) == 197376) // SW
+	if((tiles & 197376) == 197376 && (moves & 64)) // SW
 	{
 		add_neighbour(
 		    this->generate(pad_id{nid_p_w.id - 1}), warthog::DBL_ROOT_TWO);
 	}
-	if((tiles & 771) == 771) // NW
+	if((tiles & 771) == 771 && (moves & 128)) // NW
 	{
 		add_neighbour(
 		    this->generate(pad_id{nid_m_w.id - 1}), warthog::DBL_ROOT_TWO);
@@ -170,6 +187,7 @@ gridmap_expansion_policy::generate_start_node(search_problem_instance* pi)
 	uint32_t max_id = map_->width() * map_->height();
 	if(uint32_t{pi->start_} >= max_id) { return 0; }
 	if(map_->get_label(pi->start_) == 0) { return 0; }
+	if(unreachable_(pi)) { return 0; }
 	return generate(pi->start_);
 }
 
@@ -0,0 +1,133 @@
+#include <warthog/search/isochrone_search.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+
+namespace warthog::search
+{
+
+namespace
+{
+
+// min-heap order on g
+struct open_after
+{
+	template<class Entry>
+	bool
+	operator()(const Entry& a, const Entry& b) const
+	{
+		return a.g_ > b.g_;
+	}
+};
+
+} // namespace
+
+isochrone_search::isochrone_search(domain::gridmap* map)
+    : map_(map), expander_(map)
+{
+	expander_.set_nodes_pool_size(0);
+	region_data_.assign(
+	    region_table::calc_array_size(map->width(), map->height()), 0);
+	region_.setup(region_data_.data(), map->width(), map->height());
+	size_t cells = size_t(map->width()) * map->height();
+	g_.resize(cells);
+	stamp_.resize(cells, 0);
+}
+
+void
+isochrone_search::get_region(
+    pack_id start, search_parameters* par, solution* sol)
+{
+	util::timer mytimer;
+	mytimer.start();
+	for(uint32_t w : dirty_)
+	{
+		region_data_[w] = 0;
+	}
+	dirty_.clear();
+	num_cells_ = 0;
+	open_.clear();
+	if(++search_stamp_ == 0)
+	{
+		std::fill(stamp_.begin(), stamp_.end(), 0);
+		search_stamp_ = 1;
+	}
+
+	uint32_t map_size = map_->header_width() * map_->header_height();
+	cost_t budget     = par->get_max_cost_cutoff();
+	if(uint32_t{start} >= map_size
+	   || !map_->get_label(map_->to_padded_id(start)) || budget < 0)
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	uint32_t root = uint32_t(map_->to_padded_id(start).id);
+	stamp_[root]  = search_stamp_;
+	g_[root]      = 0;
+	open_.push_back({0, root});
+	cost_t largest = 0;
+
+	search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search_node current;
+	while(!open_.empty())
+	{
+		std::pop_heap(open_.begin(), open_.end(), open_after{});
+		open_entry e = open_.back();
+		open_.pop_back();
+		sol->met_.heap_ops_++;
+		if(region_.get(pad_id{e.id_}) || e.g_ != g_[e.id_]) { continue; }
+		if(sol->met_.nodes_expanded_ >= par->get_max_expansions_cutoff())
+		{
+			break;
+		}
+
+		// into the region, which closes the cell
+		auto [word, bit] = region_.id_split(pad_id{e.id_});
+		if(region_data_[word] == 0) { dirty_.push_back(word); }
+		region_data_[word] |= uint64_t{1} << bit;
+		num_cells_++;
+		largest = e.g_;
+
+		sol->met_.nodes_expanded_++;
+		current.set_id(pad_id{e.id_});
+		expander_.expand(&current, &spi);
+		search_node* n = nullptr;
+		cost_t cost    = 0;
+		for(uint32_t i = 0; i < expander_.get_num_successors(); i++)
+		{
+			expander_.get_successor(i, n, cost);
+			sol->met_.nodes_generated_++;
+			uint32_t nid = uint32_t(n->get_id().id);
+			double g     = e.g_ + cost;
+			if(g > budget || region_.get(pad_id{nid})) { continue; }
+			if(stamp_[nid] != search_stamp_)
+			{
+				stamp_[nid] = search_stamp_;
+				g_[nid]     = warthog::COST_MAX;
+			}
+			if(g >= g_[nid]) { continue; }
+
+			g_[nid] = g;
+			open_.push_back({g, nid});
+			std::push_heap(open_.begin(), open_.end(), open_after{});
+			sol->met_.heap_ops_++;
+		}
+	}
+
+	sol->sum_of_edge_costs_      = largest;
+	sol->met_.nodes_surplus_     = uint32_t(open_.size());
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+size_t
+isochrone_search::mem()
+{
+	return sizeof(*this) + expander_.mem()
+	    + region_data_.capacity() * sizeof(uint64_t)
+	    + (dirty_.capacity() + stamp_.capacity()) * sizeof(uint32_t)
+	    + g_.capacity() * sizeof(double)
+	    + open_.capacity() * sizeof(open_entry);
+}
+
+} // namespace warthog::search
@@ -0,0 +1,320 @@
+#include <warthog/search/multi_target_search.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace warthog::search
+{
+
+namespace
+{
+
+constexpr double EPS = 1e-8;
+
+// min-heap order on f, breaking ties in favour of larger g as
+// cmp_less_search_node does
+struct open_after
+{
+	template<class Entry>
+	bool
+	operator()(const Entry& a, const Entry& b) const
+	{
+		return a.f_ > b.f_ || (a.f_ == b.f_ && a.g_ < b.g_);
+	}
+};
+
+double
+octile(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2)
+{
+	uint32_t dx = x1 < x2 ? x2 - x1 : x1 - x2;
+	uint32_t dy = y1 < y2 ? y2 - y1 : y1 - y2;
+	uint32_t lo = std::min(dx, dy);
+	return lo * warthog::DBL_ROOT_TWO + (std::max(dx, dy) - lo);
+}
+
+} // namespace
+
+multi_target_search::multi_target_search(
+    domain::gridmap* map, uint32_t index_threshold)
+    : map_(map), expander_(map), index_threshold_(index_threshold)
+{
+	expander_.set_nodes_pool_size(0);
+	size_t cells = size_t(map->width()) * map->height();
+	g_.resize(cells);
+	parent_.resize(cells);
+	stamp_.resize(cells, 0);
+	closed_.resize(cells);
+	slot_.resize(cells);
+}
+
+double
+multi_target_search::heuristic_(uint32_t id) const
+{
+	uint32_t x  = id % map_->width();
+	uint32_t y  = id / map_->width();
+	double best = warthog::COST_MAX;
+	if(blind_ && remaining_.size() > index_threshold_) { return 0; }
+	if(!indexed_)
+	{
+		for(uint32_t i : remaining_)
+		{
+			best = std::min(best, octile(x, y, target_x_[i], target_y_[i]));
+		}
+		return remaining_.empty() ? 0 : best;
+	}
+
+	// rings of buckets around that of the cell; a target in ring r is at
+	// least (r - 1) * bucket_size_ + 1 moves away
+	int32_t bx   = int32_t(x / bucket_size_);
+	int32_t by   = int32_t(y / bucket_size_);
+	int32_t last = int32_t(std::max(bucket_cols_, bucket_rows_));
+	for(int32_t r = 0; r <= last; r++)
+	{
+		if(r > 0 && double((r - 1) * bucket_size_ + 1) >= best) { break; }
+		for(int32_t j = by - r; j <= by + r; j++)
+		{
+			if(j < 0 || j >= int32_t(bucket_rows_)) { continue; }
+			// all of the top and bottom rows, the ends of the others
+			int32_t step = (j == by - r || j == by + r) ? 1 : 2 * r;
+			for(int32_t i = bx - r; i <= bx + r; i += std::max(step, 1))
+			{
+				if(i < 0 || i >= int32_t(bucket_cols_)) { continue; }
+				for(uint32_t t : buckets_[j * bucket_cols_ + i])
+				{
+					best = std::min(
+					    best, octile(x, y, target_x_[t], target_y_[t]));
+				}
+			}
+		}
+	}
+	return remaining_.empty() ? 0 : best;
+}
+
+void
+multi_target_search::index_()
+{
+	indexed_ = !blind_ && remaining_.size() > index_threshold_;
+	if(!indexed_) { return; }
+
+	// about one target per bucket
+	double area  = double(map_->header_width()) * map_->header_height();
+	bucket_size_ = std::max<uint32_t>(
+	    4, uint32_t(std::sqrt(area / double(remaining_.size()))));
+	bucket_cols_ = (map_->width() + bucket_size_ - 1) / bucket_size_;
+	bucket_rows_ = (map_->height() + bucket_size_ - 1) / bucket_size_;
+	buckets_.resize(size_t(bucket_cols_) * bucket_rows_);
+	for(auto& bucket : buckets_)
+	{
+		bucket.clear();
+	}
+	for(uint32_t i : remaining_)
+	{
+		buckets_[(target_y_[i] / bucket_size_) * bucket_cols_
+		         + target_x_[i] / bucket_size_]
+		    .push_back(i);
+	}
+}
+
+void
+multi_target_search::settle_(uint32_t i)
+{
+	uint32_t last            = remaining_.back();
+	remaining_[position_[i]] = last;
+	position_[last]          = position_[i];
+	remaining_.pop_back();
+
+	if(indexed_)
+	{
+		auto& bucket = buckets_
+		    [(target_y_[i] / bucket_size_) * bucket_cols_
+		     + target_x_[i] / bucket_size_];
+		*std::find(bucket.begin(), bucket.end(), i) = bucket.back();
+		bucket.pop_back();
+	}
+}
+
+void
+multi_target_search::search_(
+    multi_target_instance* pi, search_parameters* par, solution* sol,
+    bool path)
+{
+	util::timer mytimer;
+	mytimer.start();
+	open_.clear();
+	if(++search_stamp_ == 0)
+	{
+		std::fill(stamp_.begin(), stamp_.end(), 0);
+		search_stamp_ = 1;
+	}
+
+	uint32_t num_targets = uint32_t(pi->targets_.size());
+	uint32_t map_size    = map_->header_width() * map_->header_height();
+	costs_.assign(num_targets, warthog::COST_MAX);
+	nearest_ = UINT32_MAX;
+	target_x_.resize(num_targets);
+	target_y_.resize(num_targets);
+	same_.assign(num_targets, UINT32_MAX);
+	position_.resize(num_targets);
+	remaining_.clear();
+
+	// reset a cell on its first visit of this search
+	auto touch = [this](uint32_t id) {
+		if(stamp_[id] == search_stamp_) { return; }
+		stamp_[id]  = search_stamp_;
+		g_[id]      = warthog::COST_MAX;
+		closed_[id] = false;
+		slot_[id]   = 0;
+	};
+
+	for(uint32_t i = num_targets; i-- > 0;)
+	{
+		pack_id t = pi->targets_[i];
+		if(uint32_t{t} >= map_size) { continue; }
+		pad_id p = map_->to_padded_id(t);
+		if(!map_->get_label(p)) { continue; }
+
+		map_->to_padded_xy(p, target_x_[i], target_y_[i]);
+		touch(uint32_t(p.id));
+		same_[i]     = slot_[p.id] ? slot_[p.id] - 1 : UINT32_MAX;
+		slot_[p.id]  = i + 1;
+		position_[i] = uint32_t(remaining_.size());
+		remaining_.push_back(i);
+	}
+	blind_ = pi->mode_ == target_mode::all;
+	index_();
+
+	if(uint32_t{pi->start_} >= map_size || remaining_.empty())
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+	pad_id start = map_->to_padded_id(pi->start_);
+	if(!map_->get_label(start))
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	touch(uint32_t(start.id));
+	g_[start.id]      = 0;
+	parent_[start.id] = uint32_t(start.id);
+	open_.push_back({heuristic_(uint32_t(start.id)), 0, uint32_t(start.id)});
+
+	search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search_node current;
+	while(!open_.empty())
+	{
+		std::pop_heap(open_.begin(), open_.end(), open_after{});
+		open_entry e = open_.back();
+		open_.pop_back();
+		sol->met_.heap_ops_++;
+		if(closed_[e.id_] || e.g_ != g_[e.id_]) { continue; }
+
+		// the heuristic grew since the entry was pushed
+		double f = e.g_ + heuristic_(e.id_);
+		if(f > e.f_ + EPS)
+		{
+			open_.push_back({f, e.g_, e.id_});
+			std::push_heap(open_.begin(), open_.end(), open_after{});
+			sol->met_.heap_ops_++;
+			continue;
+		}
+		if(f > par->get_max_cost_cutoff()) { break; }
+		if(sol->met_.nodes_expanded_ >= par->get_max_expansions_cutoff())
+		{
+			break;
+		}
+
+		closed_[e.id_] = true;
+		if(slot_[e.id_])
+		{
+			if(nearest_ == UINT32_MAX) { nearest_ = slot_[e.id_] - 1; }
+			for(uint32_t i = slot_[e.id_] - 1; i != UINT32_MAX; i = same_[i])
+			{
+				costs_[i] = e.g_;
+				settle_(i);
+			}
+			if(pi->mode_ == target_mode::nearest || remaining_.empty())
+			{
+				break;
+			}
+		}
+
+		sol->met_.nodes_expanded_++;
+		sol->met_.lb_ = f;
+		current.set_id(pad_id{e.id_});
+		expander_.expand(&current, &spi);
+		search_node* n = nullptr;
+		cost_t cost    = 0;
+		for(uint32_t i = 0; i < expander_.get_num_successors(); i++)
+		{
+			expander_.get_successor(i, n, cost);
+			sol->met_.nodes_generated_++;
+			uint32_t nid = uint32_t(n->get_id().id);
+			touch(nid);
+			double g = e.g_ + cost;
+			if(closed_[nid] || g >= g_[nid]) { continue; }
+
+			g_[nid]      = g;
+			parent_[nid] = e.id_;
+			open_.push_back({g + heuristic_(nid), g, nid});
+			std::push_heap(open_.begin(), open_.end(), open_after{});
+			sol->met_.heap_ops_++;
+		}
+	}
+
+	if(nearest_ != UINT32_MAX)
+	{
+		sol->sum_of_edge_costs_ = costs_[nearest_];
+		if(path)
+		{
+			pad_id target = map_->to_padded_id(pi->targets_[nearest_]);
+			for(uint32_t id = uint32_t(target.id); id != start.id;
+			    id = parent_[id])
+			{
+				sol->path_.push_back(map_->to_unpadded_id(pad_id{id}));
+			}
+			sol->path_.push_back(pi->start_);
+			std::reverse(sol->path_.begin(), sol->path_.end());
+		}
+	}
+
+	sol->met_.nodes_surplus_     = uint32_t(open_.size());
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+void
+multi_target_search::get_path(
+    multi_target_instance* pi, search_parameters* par, solution* sol)
+{
+	search_(pi, par, sol, true);
+}
+
+void
+multi_target_search::get_pathcost(
+    multi_target_instance* pi, search_parameters* par, solution* sol)
+{
+	search_(pi, par, sol, false);
+}
+
+size_t
+multi_target_search::mem()
+{
+	size_t size = sizeof(*this) + expander_.mem()
+	    + g_.capacity() * sizeof(double)
+	    + (parent_.capacity() + stamp_.capacity() + slot_.capacity())
+	        * sizeof(uint32_t)
+	    + closed_.capacity() / 8 + open_.capacity() * sizeof(open_entry)
+	    + (target_x_.capacity() + target_y_.capacity() + same_.capacity()
+	       + remaining_.capacity() + position_.capacity())
+	        * sizeof(uint32_t)
+	    + costs_.capacity() * sizeof(cost_t);
+	for(const auto& bucket : buckets_)
+	{
+		size += sizeof(bucket) + bucket.capacity() * sizeof(uint32_t);
+	}
+	return size;
+}
+
+} // namespace warthog::search
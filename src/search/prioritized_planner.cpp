@@ -0,0 +1,98 @@
+#include <warthog/search/prioritized_planner.h>
+#include <warthog/search/solution.h>
+
+namespace warthog::search
+{
+
+namespace
+{
+
+void
+add_metrics(search_metrics* met, const search_metrics& other)
+{
+	if(!met) { return; }
+	met->time_elapsed_nano_ += other.time_elapsed_nano_;
+	met->nodes_expanded_    += other.nodes_expanded_;
+	met->nodes_generated_   += other.nodes_generated_;
+	met->nodes_surplus_     += other.nodes_surplus_;
+	met->nodes_reopen_      += other.nodes_reopen_;
+	met->heap_ops_          += other.heap_ops_;
+}
+
+} // namespace
+
+prioritized_planner::prioritized_planner(
+    domain::gridmap* map, bool manhattan)
+    : map_(map), reservations_(map->width(), map->height()),
+      expander_(map, &reservations_, manhattan),
+      heuristic_(map->width(), map->height()),
+      search_(&heuristic_, &expander_, &open_), grid_(map, manhattan),
+      grid_search_(&heuristic_, &grid_, &grid_open_)
+{ }
+
+uint32_t
+prioritized_planner::horizon_(problem_instance& agent, search_metrics* met)
+{
+	uint32_t max_id = map_->header_width() * map_->header_height();
+	if(agent.start_.id >= max_id || agent.target_.id >= max_id) { return 0; }
+	uint32_t reserved = reservations_.get_horizon();
+	// parked on by an agent before this one
+	if(!reservations_.free_from(map_->to_padded_id(agent.target_), reserved))
+	{
+		return 0;
+	}
+
+	search_parameters par;
+	solution sol;
+	grid_search_.get_path(&agent, &par, &sol);
+	add_metrics(met, sol.met_);
+	if(sol.path_.empty()) { return 0; }
+	// one timestep per move on the path
+	return reserved + uint32_t(sol.path_.size()) + slack_;
+}
+
+uint32_t
+prioritized_planner::plan(
+    std::vector<problem_instance>& agents, search_parameters* par,
+    std::vector<std::vector<pack_id>>& paths, search_metrics* met)
+{
+	uint32_t planned = 0;
+	// a horizon set by the caller applies to every agent
+	uint32_t fixed = expander_.get_horizon();
+	paths.assign(agents.size(), {});
+	for(size_t i = 0; i < agents.size(); i++)
+	{
+		if(fixed == 0)
+		{
+			uint32_t horizon = horizon_(agents[i], met);
+			if(horizon == 0) { continue; }
+			expander_.set_horizon(horizon);
+		}
+		solution sol;
+		search_.get_path(&agents[i], par, &sol);
+		add_metrics(met, sol.met_);
+		if(sol.path_.empty()) { continue; }
+
+		// the path lists one cell per timestep
+		cells_.clear();
+		for(pack_id id : sol.path_)
+		{
+			cells_.push_back(map_->to_padded_id(id));
+		}
+		reservations_.reserve_path(cells_);
+		paths[i] = std::move(sol.path_);
+		planned++;
+	}
+	expander_.set_horizon(fixed);
+	return planned;
+}
+
+size_t
+prioritized_planner::mem()
+{
+	return sizeof(*this) + reservations_.mem() + expander_.mem()
+	    + heuristic_.mem() + open_.mem() + cells_.capacity() * sizeof(pad_id)
+	    + grid_.mem() + grid_open_.mem();
+}
+
+} // namespace warthog::search
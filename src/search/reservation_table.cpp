@@ -0,0 +1,110 @@
+#include <warthog/search/reservation_table.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace warthog::search
+{
+
+reservation_table::reservation_table(uint32_t width, uint32_t height)
+    : width_(width), parked_(size_t{width} * height, NEVER),
+      last_(size_t{width} * height, 0)
+{
+	slots_.assign(1024, slot{EMPTY, 0, 0});
+	mask_    = slots_.size() - 1;
+	shift_   = 64 - 10;
+	size_    = 0;
+	horizon_ = 0;
+}
+
+void
+reservation_table::clear()
+{
+	std::fill(slots_.begin(), slots_.end(), slot{EMPTY, 0, 0});
+	std::fill(parked_.begin(), parked_.end(), NEVER);
+	std::fill(last_.begin(), last_.end(), 0);
+	size_    = 0;
+	horizon_ = 0;
+}
+
+reservation_table::slot&
+reservation_table::insert(pad_id cell, uint32_t t)
+{
+	if(2 * (size_ + 1) > slots_.size()) { grow(); }
+
+	uint64_t k = key(cell, t);
+	uint64_t i = hash(k);
+	while(slots_[i].key_ != k && slots_[i].key_ != EMPTY)
+	{
+		i = (i + 1) & mask_;
+	}
+	if(slots_[i].key_ == EMPTY)
+	{
+		slots_[i] = slot{k, 0, 0};
+		size_++;
+	}
+	last_[cell.id] = std::max(last_[cell.id], t + 1);
+	horizon_       = std::max(horizon_, t + 1);
+	return slots_[i];
+}
+
+void
+reservation_table::grow()
+{
+	std::vector<slot> old(slots_.size() * 2, slot{EMPTY, 0, 0});
+	old.swap(slots_);
+	mask_ = slots_.size() - 1;
+	shift_--;
+	for(const slot& s : old)
+	{
+		if(s.key_ == EMPTY) { continue; }
+		uint64_t i = hash(s.key_);
+		while(slots_[i].key_ != EMPTY)
+		{
+			i = (i + 1) & mask_;
+		}
+		slots_[i] = s;
+	}
+}
+
+void
+reservation_table::reserve_vertex(pad_id cell, uint32_t t)
+{
+	insert(cell, t).vertex_ = 1;
+}
+
+void
+reservation_table::reserve_edge(pad_id from, pad_id to, uint32_t t)
+{
+	insert(from, t).edges_ |= direction(from, to);
+}
+
+void
+reservation_table::reserve_forever(pad_id cell, uint32_t t)
+{
+	parked_[cell.id] = std::min(parked_[cell.id], t);
+}
+
+void
+reservation_table::reserve_path(const std::vector<pad_id>& path)
+{
+	if(path.empty()) { return; }
+	for(uint32_t t = 0; t < path.size(); t++)
+	{
+		reserve_vertex(path[t], t);
+		if(t + 1 < path.size() && path[t] != path[t + 1])
+		{
+			reserve_edge(path[t], path[t + 1], t);
+		}
+	}
+	reserve_forever(path.back(), uint32_t(path.size() - 1));
+}
+
+size_t
+reservation_table::mem() const
+{
+	return sizeof(*this) + slots_.capacity() * sizeof(slot)
+	    + (parked_.capacity() + last_.capacity()) * sizeof(uint32_t);
+}
+
+} // namespace warthog::search
@@ -9,5 +9,10 @@ operator<<(std::ostream& str, const warthog::search::search_metrics& met)
 	    << " reopened=" << met.nodes_reopen_
 	    << " surplus=" << met.nodes_surplus_ << " heap-ops=" << met.heap_ops_
 	    << " lb=" << met.lb_ << " ub=" << met.ub_;
+	if(met.messages_sent_ != 0 || met.comm_time_nano_.count() != 0)
+	{
+		str << " messages=" << met.messages_sent_
+		    << " comm_time_nano=" << met.comm_time_nano_.count();
+	}
 	return str;
 }
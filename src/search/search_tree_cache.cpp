@@ -0,0 +1,279 @@
+#include <warthog/search/search_tree_cache.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+
+namespace warthog::search
+{
+
+namespace
+{
+
+// min-heap order on f, breaking ties in favour of larger g as
+// cmp_less_search_node does
+struct open_after
+{
+	template<class Entry>
+	bool
+	operator()(const Entry& a, const Entry& b) const
+	{
+		return a.f_ > b.f_ || (a.f_ == b.f_ && a.g_ < b.g_);
+	}
+};
+
+} // namespace
+
+search_tree_cache::search_tree_cache(
+    domain::gridmap* map, uint32_t capacity, bool astar)
+    : map_(map), expander_(map), heuristic_(map->width(), map->height()),
+      capacity_(std::max<uint32_t>(capacity, 1)), astar_(astar),
+      version_(map->get_version())
+{
+	expander_.set_nodes_pool_size(0);
+	if(!astar_) { heuristic_.set_hscale(0); }
+	trees_.reserve(capacity_);
+}
+
+search_tree_cache::tree*
+search_tree_cache::find_(uint32_t root, tree_direction dir)
+{
+	for(uint32_t i = 0; i < num_trees_; i++)
+	{
+		tree& t = trees_[i];
+		if(t.root_ == root && t.dir_ == dir) { return &t; }
+	}
+	return nullptr;
+}
+
+search_tree_cache::tree*
+search_tree_cache::build_(uint32_t root, tree_direction dir)
+{
+	uint32_t index;
+	if(num_trees_ < capacity_)
+	{
+		// the trees dropped by clear are reused before new ones are made
+		index = num_trees_++;
+		if(index == trees_.size()) { trees_.emplace_back(); }
+	}
+	else
+	{
+		// evict the least recently used tree, and reuse its memory
+		index = oldest_;
+		unlink_(index);
+	}
+	link_(index);
+
+	tree* t      = &trees_[index];
+	size_t cells = size_t(map_->width()) * map_->height();
+	if(t->cells_.size() != cells || t->stamp_ > UINT32_MAX - 3)
+	{
+		t->cells_.assign(cells, {warthog::COST_MAX, 0, 0});
+		t->stamp_ = 0;
+	}
+	// the cells of an evicted tree are left behind, with older stamps
+	t->stamp_ += 2;
+	t->root_       = root;
+	t->dir_        = dir;
+	t->goal_       = root;
+	t->num_closed_ = 0;
+	t->open_.clear();
+	t->cells_[root] = {0, root, t->stamp_};
+	t->open_.push_back({0, 0, root});
+	return t;
+}
+
+void
+search_tree_cache::grow_(
+    tree& t, uint32_t goal, search_parameters* par, solution* sol)
+{
+	// the keys of open cells are towards the old goal; they are left so
+	// when the tree has closed the new one already
+	if(astar_ && t.goal_ != goal && !t.closed(goal))
+	{
+		for(open_entry& e : t.open_)
+		{
+			e.f_ = e.g_ + heuristic_.h(e.id_, goal);
+		}
+		std::make_heap(t.open_.begin(), t.open_.end(), open_after{});
+		t.goal_ = goal;
+	}
+
+	search_problem_instance spi{pad_id::max(), pad_id::max()};
+	search_node current;
+	while(!t.open_.empty() && !t.closed(goal))
+	{
+		// the open list must stay whole when a cutoff stops the search
+		const open_entry& top = t.open_.front();
+		bool stale            = t.closed(top.id_) || top.g_ != t.g(top.id_);
+		if(!stale
+		   && (top.f_ > par->get_max_cost_cutoff()
+		       || sol->met_.nodes_expanded_
+		           >= par->get_max_expansions_cutoff()))
+		{
+			break;
+		}
+		std::pop_heap(t.open_.begin(), t.open_.end(), open_after{});
+		open_entry e = t.open_.back();
+		t.open_.pop_back();
+		sol->met_.heap_ops_++;
+		if(stale) { continue; }
+
+		t.cells_[e.id_].stamp_ = t.stamp_ + 1;
+		t.num_closed_++;
+		sol->met_.nodes_expanded_++;
+		sol->met_.lb_ = e.f_;
+		current.set_id(pad_id{e.id_});
+		expander_.expand(&current, &spi);
+		search_node* n = nullptr;
+		cost_t cost    = 0;
+		for(uint32_t i = 0; i < expander_.get_num_successors(); i++)
+		{
+			expander_.get_successor(i, n, cost);
+			sol->met_.nodes_generated_++;
+			uint32_t nid = uint32_t(n->get_id().id);
+			double g     = e.g_ + cost;
+			if(t.closed(nid) || g >= t.g(nid)) { continue; }
+
+			t.cells_[nid] = {g, e.id_, t.stamp_};
+			t.open_.push_back({g + heuristic_.h(nid, goal), g, nid});
+			std::push_heap(t.open_.begin(), t.open_.end(), open_after{});
+			sol->met_.heap_ops_++;
+		}
+	}
+	sol->met_.nodes_surplus_ = uint32_t(t.open_.size());
+}
+
+void
+search_tree_cache::search_(
+    problem_instance* pi, search_parameters* par, solution* sol, bool path)
+{
+	util::timer mytimer;
+	mytimer.start();
+	sol->met_.time_elapsed_nano_ = {};
+	sol->sum_of_edge_costs_      = warthog::COST_MAX;
+
+	uint64_t version = map_->get_version();
+	if(version != version_)
+	{
+		clear();
+		version_ = version;
+	}
+
+	uint32_t map_size = map_->header_width() * map_->header_height();
+	if(pi->start_.id >= map_size || pi->target_.id >= map_size)
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+	pad_id start  = map_->to_padded_id(pi->start_);
+	pad_id target = map_->to_padded_id(pi->target_);
+	if(!map_->get_label(start) || !map_->get_label(target))
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+	uint32_t from = uint32_t(start.id);
+	uint32_t to   = uint32_t(target.id);
+
+	// a cached tree which has closed the other endpoint, or else the one
+	// which has closed more cells, or else a new tree
+	tree* fw = find_(from, tree_direction::forward);
+	tree* bw = find_(to, tree_direction::backward);
+	tree* t  = nullptr;
+	if(fw && fw->closed(to)) { t = fw; }
+	else if(bw && bw->closed(from)) { t = bw; }
+	if(t) { hits_++; }
+	else if(fw || bw)
+	{
+		resumes_++;
+		t = !bw || (fw && fw->num_closed_ >= bw->num_closed_) ? fw : bw;
+	}
+	else
+	{
+		misses_++;
+		t = build_(
+		    direction_ == tree_direction::forward ? from : to, direction_);
+	}
+	uint32_t index = uint32_t(t - trees_.data());
+	unlink_(index);
+	link_(index);
+
+	uint32_t goal = t->dir_ == tree_direction::forward ? to : from;
+	grow_(*t, goal, par, sol);
+	if(t->closed(goal) && t->g(goal) <= par->get_max_cost_cutoff())
+	{
+		sol->sum_of_edge_costs_ = t->g(goal);
+		sol->met_.ub_           = t->g(goal);
+		if(path)
+		{
+			for(uint32_t id = goal; id != t->root_; id = t->cells_[id].parent_)
+			{
+				sol->path_.push_back(map_->to_unpadded_id(pad_id{id}));
+			}
+			sol->path_.push_back(map_->to_unpadded_id(pad_id{t->root_}));
+			// a backward tree leads from the start to its root
+			if(t->dir_ == tree_direction::forward)
+			{
+				std::reverse(sol->path_.begin(), sol->path_.end());
+			}
+		}
+	}
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+void
+search_tree_cache::get_path(
+    problem_instance* pi, search_parameters* par, solution* sol)
+{
+	search_(pi, par, sol, true);
+}
+
+void
+search_tree_cache::get_pathcost(
+    problem_instance* pi, search_parameters* par, solution* sol)
+{
+	search_(pi, par, sol, false);
+}
+
+void
+search_tree_cache::clear()
+{
+	num_trees_ = 0;
+	newest_    = UINT32_MAX;
+	oldest_    = UINT32_MAX;
+}
+
+void
+search_tree_cache::link_(uint32_t t)
+{
+	trees_[t].newer_ = UINT32_MAX;
+	trees_[t].older_ = newest_;
+	if(newest_ != UINT32_MAX) { trees_[newest_].newer_ = t; }
+	else { oldest_ = t; }
+	newest_ = t;
+}
+
+void
+search_tree_cache::unlink_(uint32_t t)
+{
+	tree& old = trees_[t];
+	if(old.newer_ != UINT32_MAX) { trees_[old.newer_].older_ = old.older_; }
+	else { newest_ = old.older_; }
+	if(old.older_ != UINT32_MAX) { trees_[old.older_].newer_ = old.newer_; }
+	else { oldest_ = old.newer_; }
+}
+
+size_t
+search_tree_cache::mem()
+{
+	size_t size = sizeof(*this) + expander_.mem();
+	size += (trees_.capacity() - trees_.size()) * sizeof(tree);
+	for(const tree& t : trees_)
+	{
+		size += sizeof(tree) + t.cells_.capacity() * sizeof(cell)
+		    + t.open_.capacity() * sizeof(open_entry);
+	}
+	return size;
+}
+
+} // namespace warthog::search
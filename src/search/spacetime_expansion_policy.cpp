@@ -0,0 +1,179 @@
+#include <warthog/search/spacetime_expansion_policy.h>
+
+namespace warthog::search
+{
+
+spacetime_expansion_policy::spacetime_expansion_policy(
+    domain::gridmap* map, reservation_table* reservations, bool manhattan)
+    : expansion_policy(0), map_(map), reservations_(reservations),
+      grid_(map, manhattan)
+{
+	// only the ids and costs of the spatial moves are needed
+	grid_.set_nodes_pool_size(0);
+}
+
+search_node*
+spacetime_expansion_policy::generate(pad_id node_id)
+{
+	auto [it, inserted] = nodes_.try_emplace(node_id.id, nullptr);
+	if(inserted) { it->second = &storage_.emplace_back(node_id); }
+	return it->second;
+}
+
+search_node*
+spacetime_expansion_policy::get_ptr(pad_id node_id, uint32_t search_number)
+{
+	auto it = nodes_.find(node_id.id);
+	if(it == nodes_.end()) { return 0; }
+	if(it->second->get_search_number() != search_number) { return 0; }
+	return it->second;
+}
+
+void
+spacetime_expansion_policy::add_successor_(
+    pad_id cell, uint32_t t, pad_id goal, cost_t cost)
+{
+	// at the goal, and it is never needed by another agent again
+	if(cell == goal && reservations_->free_from(cell, t))
+	{
+		add_neighbour(generate(make_id(cell, TIME_INF)), cost);
+		return;
+	}
+	add_neighbour(generate(make_id(cell, t)), cost);
+}
+
+void
+spacetime_expansion_policy::expand(
+    search_node* current, search_problem_instance* problem)
+{
+	reset();
+
+	pad_id cell = get_cell(current->get_id());
+	uint32_t t  = get_time(current->get_id());
+	if(t + 1 >= search_horizon_) { return; }
+	pad_id goal = get_cell(problem->target_);
+
+	// spatial moves
+	cell_node_.set_id(cell);
+	grid_.expand(&cell_node_, problem);
+	search_node* n = nullptr;
+	cost_t cost    = 0;
+	for(uint32_t i = 0; i < grid_.get_num_successors(); i++)
+	{
+		grid_.get_successor(i, n, cost);
+		pad_id next = n->get_id();
+		if(reservations_->edge_free(cell, next, t))
+		{
+			add_successor_(next, t + 1, goal, cost);
+		}
+	}
+
+	// wait
+	if(reservations_->vertex_free(cell, t + 1))
+	{
+		add_successor_(cell, t + 1, goal, WAIT_COST);
+	}
+}
+
+search_node*
+spacetime_expansion_policy::generate_start_node(search_problem_instance* pi)
+{
+	// a new search; forget the nodes of the last one
+	nodes_.clear();
+	storage_.clear();
+	search_horizon_ = horizon_;
+	if(search_horizon_ == 0)
+	{
+		search_horizon_
+		    = reservations_->get_horizon() + map_->width() * map_->height();
+	}
+
+	pad_id cell     = get_cell(pi->start_);
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{cell} >= max_id) { return 0; }
+	if(map_->get_label(cell) == 0) { return 0; }
+	if(!reservations_->vertex_free(cell, get_time(pi->start_))) { return 0; }
+	return generate(pi->start_);
+}
+
+search_node*
+spacetime_expansion_policy::generate_target_node(search_problem_instance* pi)
+{
+	pad_id cell     = get_cell(pi->target_);
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{cell} >= max_id) { return 0; }
+	if(map_->get_label(cell) == 0) { return 0; }
+	return generate(pi->target_);
+}
+
+search_problem_instance
+spacetime_expansion_policy::get_problem_instance(problem_instance* pi)
+{
+	assert(pi != nullptr);
+	search_problem_instance spi
+	    = convert_problem_instance_to_search(*pi, *map_);
+	if(spi.start_ == pad_id::max() || spi.target_ == pad_id::max())
+	{
+		return spi;
+	}
+
+	pad_id goal = spi.target_;
+	spi.start_  = make_id(spi.start_, 0);
+	spi.target_ = make_id(goal, TIME_INF);
+	// already at the goal, and never in the way
+	if(get_cell(spi.start_) == goal && reservations_->free_from(goal, 0))
+	{
+		spi.target_ = spi.start_;
+	}
+	return spi;
+}
+
+pack_id
+spacetime_expansion_policy::get_state(pad_id node_id)
+{
+	return map_->to_unpadded_id(get_cell(node_id));
+}
+
+pad_id
+spacetime_expansion_policy::unget_state(pack_id node_id)
+{
+	return make_id(map_->to_padded_id(node_id), 0);
+}
+
+void
+spacetime_expansion_policy::get_xy(pack_id node_id, int32_t& x, int32_t& y)
+{
+	uint32_t lx, ly;
+	map_->to_unpadded_xy(node_id, lx, ly);
+	x = lx;
+	y = ly;
+}
+
+pack_id
+spacetime_expansion_policy::get_pack(int32_t x, int32_t y)
+{
+	return map_->to_unpadded_id_from_unpadded(
+	    static_cast<uint32_t>(x), static_cast<uint32_t>(y));
+}
+
+void
+spacetime_expansion_policy::print_node(search_node* n, std::ostream& out)
+{
+	uint32_t x, y;
+	map_->to_unpadded_xy(get_cell(n->get_id()), x, y);
+	out << "(" << x << ", " << y << ", " << get_time(n->get_id()) << ")...";
+	n->print(out);
+}
+
+size_t
+spacetime_expansion_policy::mem()
+{
+	return expansion_policy::mem()
+	    + (sizeof(spacetime_expansion_policy) - sizeof(expansion_policy))
+	    + storage_.size() * sizeof(search_node)
+	    + nodes_.size()
+	    * (sizeof(sn_id_t) + sizeof(search_node*) + 2 * sizeof(void*))
+	    + nodes_.bucket_count() * sizeof(void*) + grid_.mem();
+}
+
+} // namespace warthog::search
@@ -20,6 +20,19 @@ vl_gridmap_expansion_policy_base::mem()
 	    + map_->mem();
 }
 
+bool
+vl_gridmap_expansion_policy_base::unreachable_(
+    search_problem_instance* pi) const noexcept
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(!components_ || uint32_t{pi->target_} >= max_id) { return false; }
+	// blocked targets include the padding, whose unpadded ids are not
+	// cells of the map
+	if(!costs_[map_->get_label(uint32_t{pi->target_})]) { return true; }
+	return !components_->connected(
+	    map_->to_unpadded_id(pi->start_), map_->to_unpadded_id(pi->target_));
+}
+
 search_problem_instance
 vl_gridmap_expansion_policy_base::get_problem_instance(problem_instance* pi)
 {
@@ -179,6 +192,7 @@ vl_gridmap_expansion_policy::generate_start_node(search_problem_instance* pi)
 {
 	uint32_t max_id = map_->width() * map_->height();
 	if(uint32_t{pi->start_} >= max_id) { return 0; }
+	if(unreachable_(pi)) { return 0; }
 	return generate(pi->start_);
 }
 
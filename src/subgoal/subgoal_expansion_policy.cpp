@@ -0,0 +1,121 @@
+#include <warthog/subgoal/subgoal_expansion_policy.h>
+
+namespace warthog::subgoal
+{
+
+subgoal_expansion_policy::subgoal_expansion_policy(
+    domain::gridmap* map, subgoal_graph* graph)
+    : gridmap_expansion_policy_base(map), graph_(graph)
+{ }
+
+void
+subgoal_expansion_policy::expand(
+    search::search_node* current, search::search_problem_instance*)
+{
+	reset();
+	pad_id id = current->get_id();
+
+	if(id == start_)
+	{
+		for(auto& [next, cost] : start_edges_)
+		{
+			add_neighbour(generate(next), cost);
+		}
+	}
+
+	uint32_t node = graph_->get_node(id);
+	if(node != NO_NODE)
+	{
+		for(const ssg_edge* e = graph_->edges_begin(node);
+		    e != graph_->edges_end(node); e++)
+		{
+			pad_id next = graph_->get_cell(e->head_);
+			add_neighbour(generate(next), octile_distance(*map_, id, next));
+		}
+	}
+
+	for(auto& [prev, next, cost] : local_edges_)
+	{
+		if(prev == id) { add_neighbour(generate(next), cost); }
+	}
+
+	// edges are symmetric; an edge out of the target is an edge into it
+	for(auto& [prev, cost] : target_edges_)
+	{
+		if(prev == id) { add_neighbour(generate(target_), cost); }
+	}
+}
+
+search::search_node*
+subgoal_expansion_policy::generate_start_node(
+    search::search_problem_instance* pi)
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{pi->start_} >= max_id) { return 0; }
+	if(uint32_t{pi->target_} >= max_id) { return 0; }
+	if(map_->get_label(pi->start_) == 0) { return 0; }
+	if(map_->get_label(pi->target_) == 0) { return 0; }
+
+	// insert the start and target into the graph
+	start_  = pi->start_;
+	target_ = pi->target_;
+	start_edges_.clear();
+	target_edges_.clear();
+	local_edges_.clear();
+
+	reached_.clear();
+	get_direct_h_reachable(
+	    *map_, start_,
+	    [this](pad_id id) {
+		    return id == target_ || graph_->get_node(id) != NO_NODE;
+	    },
+	    reached_);
+	for(pad_id id : reached_)
+	{
+		start_edges_.push_back({id, octile_distance(*map_, start_, id)});
+	}
+
+	reached_.clear();
+	get_direct_h_reachable(
+	    *map_, target_,
+	    [this](pad_id id) { return graph_->get_node(id) != NO_NODE; },
+	    reached_);
+	for(pad_id id : reached_)
+	{
+		target_edges_.push_back({id, octile_distance(*map_, target_, id)});
+		uint32_t node = graph_->get_node(id);
+		if(graph_->is_global(node)) { continue; }
+		for(const ssg_edge* e = graph_->edges_begin(node);
+		    e != graph_->edges_end(node); e++)
+		{
+			pad_id prev = graph_->get_cell(e->head_);
+			local_edges_.push_back(
+			    {prev, id, octile_distance(*map_, prev, id)});
+		}
+	}
+	return generate(start_);
+}
+
+search::search_node*
+subgoal_expansion_policy::generate_target_node(
+    search::search_problem_instance* pi)
+{
+	uint32_t max_id = map_->width() * map_->height();
+	if(uint32_t{pi->target_} >= max_id) { return 0; }
+	if(map_->get_label(pi->target_) == 0) { return 0; }
+	return generate(pi->target_);
+}
+
+size_t
+subgoal_expansion_policy::mem()
+{
+	return gridmap_expansion_policy_base::mem()
+	    + (sizeof(subgoal_expansion_policy)
+	       - sizeof(gridmap_expansion_policy_base))
+	    + (start_edges_.capacity() + target_edges_.capacity())
+	    * sizeof(std::pair<pad_id, cost_t>)
+	    + local_edges_.capacity() * sizeof(std::tuple<pad_id, pad_id, cost_t>)
+	    + reached_.capacity() * sizeof(pad_id);
+}
+
+} // namespace warthog::subgoal
@@ -0,0 +1,92 @@
+#include <warthog/subgoal/subgoal_graph.h>
+
+#include <algorithm>
+
+namespace warthog::subgoal
+{
+
+bool
+is_subgoal(const domain::gridmap& map, pad_id id)
+{
+	if(!map.get_label(id)) { return false; }
+	uint32_t w = map.width();
+	uint32_t x, y;
+	map.to_padded_xy(id, x, y);
+	for(int32_t dy = -1; dy <= 1; dy += 2)
+	{
+		for(int32_t dx = -1; dx <= 1; dx += 2)
+		{
+			if(!map.get_label(pad_id{(y + dy) * w + (x + dx)})
+			   && map.get_label(pad_id{y * w + (x + dx)})
+			   && map.get_label(pad_id{(y + dy) * w + x}))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+cost_t
+octile_distance(const domain::gridmap& map, pad_id a, pad_id b)
+{
+	uint32_t ax, ay, bx, by;
+	map.to_padded_xy(a, ax, ay);
+	map.to_padded_xy(b, bx, by);
+	uint32_t dx = ax > bx ? ax - bx : bx - ax;
+	uint32_t dy = ay > by ? ay - by : by - ay;
+	uint32_t diag = std::min(dx, dy);
+	return diag * warthog::DBL_ROOT_TWO + (std::max(dx, dy) - diag);
+}
+
+bool
+subgoal_graph::load(const char* filename, const domain::gridmap& map)
+{
+	header_ = nullptr;
+	if(!file_.open(filename)) { return false; }
+	if(file_.size() < sizeof(ssg_header)) { return false; }
+
+	const ssg_header* header
+	    = reinterpret_cast<const ssg_header*>(file_.data());
+	if(header->magic_ != SSG_MAGIC || header->version_ != SSG_VERSION
+	   || header->width_ != map.width() || header->height_ != map.height()
+	   || header->num_global_ > header->num_nodes_)
+	{
+		return false;
+	}
+	ssg_layout layout(header->num_nodes_, header->num_edges_);
+	if(file_.size() != layout.size_) { return false; }
+	if(header->signature_ != map.signature()) { return false; }
+
+	const uint8_t* base = file_.data();
+	cell_   = reinterpret_cast<const uint32_t*>(base + layout.cell_);
+	offset_ = reinterpret_cast<const uint32_t*>(base + layout.offset_);
+	edge_   = reinterpret_cast<const ssg_edge*>(base + layout.edge_);
+
+	uint32_t size = map.width() * map.height();
+	node_.assign(size, NO_NODE);
+	for(uint32_t i = 0; i < header->num_nodes_; i++)
+	{
+		if(cell_[i] >= size) { return false; }
+		node_[cell_[i]] = i;
+	}
+	if(offset_[header->num_nodes_] != header->num_edges_) { return false; }
+	header_ = header;
+	return true;
+}
+
+uint32_t
+subgoal_graph::get_via(uint32_t a, uint32_t b) const
+{
+	for(const ssg_edge* e = edges_begin(a); e != edges_end(a); e++)
+	{
+		if(e->head_ == b) { return e->via_; }
+	}
+	for(const ssg_edge* e = edges_begin(b); e != edges_end(b); e++)
+	{
+		if(e->head_ == a) { return e->via_; }
+	}
+	return NO_NODE;
+}
+
+} // namespace warthog::subgoal
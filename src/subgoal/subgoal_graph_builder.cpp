@@ -0,0 +1,280 @@
+#include <warthog/subgoal/subgoal_graph_builder.h>
+#include <warthog/util/helpers.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+namespace warthog::subgoal
+{
+
+namespace
+{
+
+// two path costs are equal if they differ by less than this
+constexpr double COST_EPS = 1e-6;
+
+bool
+by_head(const ssg_edge& a, const ssg_edge& b)
+{
+	return a.head_ < b.head_;
+}
+
+std::vector<ssg_edge>::iterator
+find_edge(std::vector<ssg_edge>& edges, uint32_t head)
+{
+	auto it = std::lower_bound(
+	    edges.begin(), edges.end(), ssg_edge{head, NO_NODE}, by_head);
+	return it != edges.end() && it->head_ == head ? it : edges.end();
+}
+
+void
+insert_edge(std::vector<ssg_edge>& edges, ssg_edge e)
+{
+	edges.insert(
+	    std::lower_bound(edges.begin(), edges.end(), e, by_head), e);
+}
+
+} // namespace
+
+subgoal_graph_builder::subgoal_graph_builder(domain::gridmap* map)
+    : map_(map)
+{ }
+
+void
+subgoal_graph_builder::build(bool two_level)
+{
+	util::timer mytimer;
+	mytimer.start();
+
+	uint32_t size = map_->width() * map_->height();
+	cells_.clear();
+	node_.assign(size, NO_NODE);
+	for(uint32_t id = 0; id < size; id++)
+	{
+		if(is_subgoal(*map_, pad_id{id}))
+		{
+			node_[id] = uint32_t(cells_.size());
+			cells_.push_back(pad_id{id});
+		}
+	}
+
+	edges_.assign(cells_.size(), {});
+	util::parallel_compute(build_worker_, this, get_num_nodes());
+
+	// a scan can miss an edge that the scan from the other end finds
+	std::vector<std::vector<ssg_edge>> reverse(cells_.size());
+	for(uint32_t i = 0; i < get_num_nodes(); i++)
+	{
+		for(const ssg_edge& e : edges_[i])
+		{
+			reverse[e.head_].push_back({i, NO_NODE});
+		}
+	}
+	for(uint32_t i = 0; i < get_num_nodes(); i++)
+	{
+		std::vector<ssg_edge>& edges = edges_[i];
+		edges.insert(edges.end(), reverse[i].begin(), reverse[i].end());
+		std::sort(edges.begin(), edges.end(), by_head);
+		edges.erase(
+		    std::unique(
+		        edges.begin(), edges.end(),
+		        [](const ssg_edge& a, const ssg_edge& b) {
+			        return a.head_ == b.head_;
+		        }),
+		    edges.end());
+	}
+
+	num_global_ = get_num_nodes();
+	if(two_level) { make_local_(); }
+	build_time_ = mytimer.elapsed_time_nano();
+}
+
+void*
+subgoal_graph_builder::build_worker_(void* params)
+{
+	util::thread_params* par = static_cast<util::thread_params*>(params);
+	subgoal_graph_builder* builder
+	    = static_cast<subgoal_graph_builder*>(par->shared_);
+	const domain::gridmap& map        = *builder->map_;
+	const std::vector<uint32_t>& node = builder->node_;
+
+	std::vector<pad_id> reached;
+	for(uint32_t i = par->thread_id_; i < builder->get_num_nodes();
+	    i += par->max_threads_)
+	{
+		reached.clear();
+		get_direct_h_reachable(
+		    map, builder->cells_[i],
+		    [&node](pad_id id) { return node[uint32_t(id.id)] != NO_NODE; },
+		    reached);
+		std::vector<ssg_edge>& edges = builder->edges_[i];
+		for(pad_id id : reached)
+		{
+			edges.push_back({node[uint32_t(id.id)], NO_NODE});
+		}
+		par->nprocessed_++;
+	}
+	return 0;
+}
+
+void
+subgoal_graph_builder::make_local_()
+{
+	uint32_t n = get_num_nodes();
+	std::vector<uint32_t> order(n);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(
+	    order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+		    return edges_[a].size() < edges_[b].size();
+	    });
+
+	std::vector<uint8_t> local(n, 0);
+	// nodes next to a local node must stay global
+	std::vector<uint8_t> fixed(n, 0);
+	std::vector<std::pair<uint32_t, uint32_t>> added;
+	for(uint32_t s : order)
+	{
+		std::vector<ssg_edge>& edges = edges_[s];
+		if(fixed[s] || edges.size() > MAX_LOCAL_DEGREE) { continue; }
+
+		// every pair of neighbours must stay joined at the same cost
+		bool removable = true;
+		added.clear();
+		for(size_t i = 0; i < edges.size() && removable; i++)
+		{
+			uint32_t u = edges[i].head_;
+			for(size_t j = i + 1; j < edges.size(); j++)
+			{
+				uint32_t v = edges[j].head_;
+				if(find_edge(edges_[u], v) != edges_[u].end()) { continue; }
+				cost_t through = octile_distance(*map_, cells_[u], cells_[s])
+				    + octile_distance(*map_, cells_[s], cells_[v]);
+				if(through
+				   > octile_distance(*map_, cells_[u], cells_[v]) + COST_EPS)
+				{
+					removable = false;
+					break;
+				}
+				added.push_back({u, v});
+			}
+		}
+		if(!removable) { continue; }
+
+		// s keeps its edges; its neighbours forget it
+		local[s] = 1;
+		for(const ssg_edge& e : edges)
+		{
+			fixed[e.head_] = 1;
+			edges_[e.head_].erase(find_edge(edges_[e.head_], s));
+		}
+		for(auto [u, v] : added)
+		{
+			insert_edge(edges_[u], {v, s});
+			insert_edge(edges_[v], {u, s});
+		}
+	}
+	sort_nodes_(local);
+}
+
+void
+subgoal_graph_builder::sort_nodes_(const std::vector<uint8_t>& local)
+{
+	uint32_t n = get_num_nodes();
+	std::vector<uint32_t> order(n);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_partition(
+	    order.begin(), order.end(), [&local](uint32_t i) { return !local[i]; });
+	std::vector<uint32_t> index(n);
+	for(uint32_t i = 0; i < n; i++)
+	{
+		index[order[i]] = i;
+	}
+
+	std::vector<pad_id> cells(n);
+	std::vector<std::vector<ssg_edge>> edges(n);
+	num_global_ = 0;
+	for(uint32_t i = 0; i < n; i++)
+	{
+		uint32_t old = order[i];
+		cells[i]     = cells_[old];
+		edges[i]     = std::move(edges_[old]);
+		for(ssg_edge& e : edges[i])
+		{
+			e.head_ = index[e.head_];
+			if(e.via_ != NO_NODE) { e.via_ = index[e.via_]; }
+		}
+		std::sort(edges[i].begin(), edges[i].end(), by_head);
+		node_[uint32_t(cells[i].id)] = i;
+		if(!local[old]) { num_global_++; }
+	}
+	cells_.swap(cells);
+	edges_.swap(edges);
+}
+
+uint32_t
+subgoal_graph_builder::get_num_edges() const
+{
+	uint32_t num_edges = 0;
+	for(const auto& edges : edges_)
+	{
+		num_edges += uint32_t(edges.size());
+	}
+	return num_edges;
+}
+
+size_t
+subgoal_graph_builder::save(const char* filename) const
+{
+	std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+	if(!out) { return 0; }
+
+	ssg_header header{};
+	header.magic_      = SSG_MAGIC;
+	header.version_    = SSG_VERSION;
+	header.width_      = map_->width();
+	header.height_     = map_->height();
+	header.num_nodes_  = get_num_nodes();
+	header.num_global_ = num_global_;
+	header.num_edges_  = get_num_edges();
+	header.signature_  = map_->signature();
+	ssg_layout layout(header.num_nodes_, header.num_edges_);
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	for(pad_id id : cells_)
+	{
+		uint32_t cell = uint32_t(id.id);
+		out.write(reinterpret_cast<const char*>(&cell), sizeof(cell));
+	}
+	uint32_t offset = 0;
+	for(const auto& edges : edges_)
+	{
+		out.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+		offset += uint32_t(edges.size());
+	}
+	out.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+	for(const auto& edges : edges_)
+	{
+		out.write(
+		    reinterpret_cast<const char*>(edges.data()),
+		    edges.size() * sizeof(ssg_edge));
+	}
+	if(!out) { return 0; }
+	return layout.size_;
+}
+
+size_t
+subgoal_graph_builder::mem() const
+{
+	size_t size = sizeof(*this) + cells_.capacity() * sizeof(pad_id)
+	    + node_.capacity() * sizeof(uint32_t)
+	    + edges_.capacity() * sizeof(std::vector<ssg_edge>);
+	for(const auto& edges : edges_)
+	{
+		size += edges.capacity() * sizeof(ssg_edge);
+	}
+	return size;
+}
+
+} // namespace warthog::subgoal
@@ -0,0 +1,172 @@
+#include <warthog/subgoal/subgoal_search.h>
+#include <warthog/util/timer.h>
+
+#include <algorithm>
+
+namespace warthog::subgoal
+{
+
+subgoal_search::subgoal_search(domain::gridmap* map, subgoal_graph* graph)
+    : map_(map), graph_(graph), heuristic_(map->width(), map->height()),
+      abstract_expander_(map, graph), refine_expander_(map),
+      abstract_(&heuristic_, &abstract_expander_, &abstract_open_),
+      refine_(&heuristic_, &refine_expander_, &refine_open_)
+{ }
+
+void
+subgoal_search::add_metrics_(
+    search::search_metrics& to, const search::search_metrics& from)
+{
+	to.nodes_expanded_  += from.nodes_expanded_;
+	to.nodes_generated_ += from.nodes_generated_;
+	to.nodes_surplus_   += from.nodes_surplus_;
+	to.nodes_reopen_    += from.nodes_reopen_;
+	to.heap_ops_        += from.heap_ops_;
+}
+
+void
+subgoal_search::get_pathcost(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	abstract_.get_pathcost(pi, par, sol);
+}
+
+void
+subgoal_search::get_path(
+    search::problem_instance* pi, search::search_parameters* par,
+    search::solution* sol)
+{
+	util::timer mytimer;
+	mytimer.start();
+	sol->reset();
+
+	abstract_sol_.reset();
+	abstract_.get_path(pi, par, &abstract_sol_);
+	add_metrics_(sol->met_, abstract_sol_.met_);
+	if(abstract_sol_.path_.empty())
+	{
+		sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+		return;
+	}
+
+	// refine each edge into a grid path
+	std::vector<pack_id>& abstract_path = abstract_sol_.path_;
+	path_.clear();
+	path_.push_back(map_->to_padded_id(abstract_path.front()));
+	for(size_t i = 1; i < abstract_path.size(); i++)
+	{
+		if(!refine_edge_(
+		       map_->to_padded_id(abstract_path[i - 1]),
+		       map_->to_padded_id(abstract_path[i]), sol->met_))
+		{
+			// cannot happen unless the map changed behind the graph
+			sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+			return;
+		}
+	}
+
+	cost_t cost = 0;
+	for(size_t i = 0; i < path_.size(); i++)
+	{
+		sol->path_.push_back(map_->to_unpadded_id(path_[i]));
+		if(i) { cost += octile_distance(*map_, path_[i - 1], path_[i]); }
+	}
+	sol->sum_of_edge_costs_      = cost;
+	sol->met_.time_elapsed_nano_ = mytimer.elapsed_time_nano();
+}
+
+bool
+subgoal_search::refine_edge_(
+    pad_id from, pad_id to, search::search_metrics& met)
+{
+	uint32_t a = graph_->get_node(from);
+	uint32_t b = graph_->get_node(to);
+	if(a != NO_NODE && b != NO_NODE)
+	{
+		uint32_t via = graph_->get_via(a, b);
+		if(via != NO_NODE)
+		{
+			pad_id mid = graph_->get_cell(via);
+			return refine_edge_(from, mid, met)
+			    && refine_edge_(mid, to, met);
+		}
+	}
+
+	if(walk_(from, to)) { return true; }
+	size_t size = path_.size();
+	if(walk_(to, from))
+	{
+		// the walk ends at from; turn it around
+		path_.pop_back();
+		std::reverse(path_.begin() + size, path_.end());
+		path_.push_back(to);
+		return true;
+	}
+
+	search::problem_instance edge(
+	    map_->to_unpadded_id(from), map_->to_unpadded_id(to));
+	search::search_parameters par;
+	segment_.reset();
+	refine_.get_path(&edge, &par, &segment_);
+	add_metrics_(met, segment_.met_);
+	if(segment_.path_.empty()) { return false; }
+	for(size_t i = 1; i < segment_.path_.size(); i++)
+	{
+		path_.push_back(map_->to_padded_id(segment_.path_[i]));
+	}
+	return true;
+}
+
+bool
+subgoal_search::walk_(pad_id from, pad_id to)
+{
+	uint32_t fx, fy, tx, ty;
+	map_->to_padded_xy(from, fx, fy);
+	map_->to_padded_xy(to, tx, ty);
+	int64_t sx  = tx > fx ? 1 : (tx < fx ? -1 : 0);
+	int64_t sy  = ty > fy ? 1 : (ty < fy ? -1 : 0);
+	uint32_t dx = tx > fx ? tx - fx : fx - tx;
+	uint32_t dy = ty > fy ? ty - fy : fy - ty;
+	int64_t w   = map_->width();
+	auto open = [this](int64_t id) {
+		return map_->get_label(pad_id{uint64_t(id)}) != 0;
+	};
+
+	size_t size = path_.size();
+	int64_t p   = int64_t(from.id);
+	for(uint32_t k = std::min(dx, dy); k > 0; k--)
+	{
+		if(!open(p + sx) || !open(p + sy * w) || !open(p + sx + sy * w))
+		{
+			path_.resize(size);
+			return false;
+		}
+		p += sx + sy * w;
+		path_.push_back(pad_id{uint64_t(p)});
+	}
+	int64_t step = dx > dy ? sx : sy * w;
+	for(uint32_t k = std::max(dx, dy) - std::min(dx, dy); k > 0; k--)
+	{
+		if(!open(p + step))
+		{
+			path_.resize(size);
+			return false;
+		}
+		p += step;
+		path_.push_back(pad_id{uint64_t(p)});
+	}
+	return true;
+}
+
+size_t
+subgoal_search::mem()
+{
+	return sizeof(*this) + graph_->mem() + abstract_expander_.mem()
+	    + refine_expander_.mem() + abstract_open_.mem() + refine_open_.mem()
+	    + (abstract_sol_.path_.capacity() + segment_.path_.capacity())
+	    * sizeof(pack_id)
+	    + path_.capacity() * sizeof(pad_id);
+}
+
+} // namespace warthog::subgoal
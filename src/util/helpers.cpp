@@ -123,7 +123,7 @@ parallel_compute(
 		}
 
 		if(nfinished == NUM_THREADS) { break; }
-		else { sleep(0.5); }
+		else { usleep(100000); }
 	}
 	std::cerr << "\nparallel compute; end\n";
 	return 0;
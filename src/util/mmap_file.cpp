@@ -0,0 +1,48 @@
+#include <warthog/util/mmap_file.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace warthog::util
+{
+
+mmap_file::~mmap_file()
+{
+	close();
+}
+
+bool
+mmap_file::open(const char* filename)
+{
+	close();
+	int fd = ::open(filename, O_RDONLY);
+	if(fd < 0) { return false; }
+
+	struct stat st;
+	if(fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		::close(fd);
+		return false;
+	}
+
+	void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	// the mapping stays valid after the descriptor is closed
+	::close(fd);
+	if(addr == MAP_FAILED) { return false; }
+
+	data_ = static_cast<const uint8_t*>(addr);
+	size_ = static_cast<size_t>(st.st_size);
+	return true;
+}
+
+void
+mmap_file::close()
+{
+	if(data_) { munmap(const_cast<uint8_t*>(data_), size_); }
+	data_ = nullptr;
+	size_ = 0;
+}
+
+} // namespace warthog::util
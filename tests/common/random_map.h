@@ -0,0 +1,132 @@
+#ifndef WARTHOG_TESTS_COMMON_RANDOM_MAP_H
+#define WARTHOG_TESTS_COMMON_RANDOM_MAP_H
+
+// tests/common/random_map.h
+//
+// Random maps and queries for the tests, and the checks they share: octile
+// A* as the reference for the cost of a query, and the cost of a path
+// walked cell by cell.
+//
+
+#include <warthog/constants.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/problem_instance.h>
+#include <warthog/search/search_parameters.h>
+#include <warthog/search/solution.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace warthog::test
+{
+
+// block each cell of @param map with probability 1 / @param one_in; the
+// same @param seed gives the same cells on maps of the same size
+inline void
+random_map(domain::gridmap& map, uint32_t one_in, uint32_t seed = 0)
+{
+	std::mt19937 rng(seed);
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, rng() % one_in != 0);
+		}
+}
+
+// every cell of @param map traversable
+inline void
+open_map(domain::gridmap& map)
+{
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, true);
+		}
+}
+
+// the unpadded id of a cell of @param map, traversable or not
+inline pack_id
+random_cell(const domain::gridmap& map, std::mt19937& rng)
+{
+	uint32_t x = rng() % map.header_width();
+	uint32_t y = rng() % map.header_height();
+	return map.to_unpadded_id_from_unpadded(x, y);
+}
+
+inline search::problem_instance
+random_query(const domain::gridmap& map, std::mt19937& rng)
+{
+	pack_id start = random_cell(map, rng);
+	return search::problem_instance(start, random_cell(map, rng));
+}
+
+// the cost of @param path if it is made of octile moves between adjacent
+// traversable cells which do not cut corners, or -1
+inline double
+path_cost(const domain::gridmap& map, const std::vector<pack_id>& path)
+{
+	int32_t w = map.header_width();
+	auto free = [&map](int32_t x, int32_t y) {
+		return map.get_label(map.to_padded_id_from_unpadded(x, y));
+	};
+	double cost = 0;
+	for(size_t i = 0; i < path.size(); i++)
+	{
+		int32_t x = path[i].id % w, y = path[i].id / w;
+		if(!free(x, y)) { return -1; }
+		if(i == 0) { continue; }
+		int32_t px = path[i - 1].id % w, py = path[i - 1].id / w;
+		if(std::abs(x - px) > 1 || std::abs(y - py) > 1) { return -1; }
+		if(x != px && y != py)
+		{
+			if(!free(px, y) || !free(x, py)) { return -1; }
+			cost += DBL_ROOT_TWO;
+		}
+		else if(x != px || y != py) { cost += 1; }
+	}
+	return cost;
+}
+
+// octile A* over gridmap_expansion_policy, for the costs of queries on a
+// map as it is now
+class reference_astar
+{
+public:
+	reference_astar(domain::gridmap* map)
+	    : expander_(map), heuristic_(map->width(), map->height()),
+	      astar_(&heuristic_, &expander_, &open_)
+	{ }
+
+	void
+	get_pathcost(search::problem_instance* pi, search::solution* sol)
+	{
+		search::search_parameters par;
+		astar_.get_pathcost(pi, &par, sol);
+	}
+
+	cost_t
+	cost(search::problem_instance pi)
+	{
+		search::solution sol;
+		get_pathcost(&pi, &sol);
+		return sol.sum_of_edge_costs_;
+	}
+
+private:
+	search::gridmap_expansion_policy expander_;
+	heuristic::octile_heuristic heuristic_;
+	util::pqueue_min open_;
+	search::unidirectional_search<
+	    heuristic::octile_heuristic, search::gridmap_expansion_policy>
+	    astar_;
+};
+
+} // namespace warthog::test
+
+#endif // WARTHOG_TESTS_COMMON_RANDOM_MAP_H
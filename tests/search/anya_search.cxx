@@ -0,0 +1,211 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/anya/anya_search.h>
+#include <warthog/domain/gridmap.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// any-angle paths between the corners of cells, found by brute force:
+// Dijkstra over the visibility graph of all grid points
+class oracle
+{
+public:
+	oracle(const warthog::domain::gridmap& map)
+	    : map_(map), w_(int32_t(map.header_width())),
+	      h_(int32_t(map.header_height()))
+	{ }
+
+	// cells outside the map are blocked
+	bool
+	free(int32_t x, int32_t y) const
+	{
+		if(x < 0 || y < 0 || x >= w_ || y >= h_) { return false; }
+		return map_.get_label(map_.to_padded_id_from_unpadded(x, y));
+	}
+
+	bool
+	on_grid(int32_t x, int32_t y) const
+	{
+		return free(x - 1, y - 1) || free(x, y - 1) || free(x - 1, y)
+		    || free(x, y);
+	}
+
+	// two blocked cells touch at the point, and so do two free ones
+	bool
+	double_corner(int32_t x, int32_t y) const
+	{
+		bool nw = free(x - 1, y - 1), ne = free(x, y - 1);
+		bool sw = free(x - 1, y), se = free(x, y);
+		return (nw && se && !ne && !sw) || (!nw && !se && ne && sw);
+	}
+
+	// does the segment stay in free cells, without squeezing between two
+	// blocked cells at a corner?
+	bool
+	visible(int32_t x0, int32_t y0, int32_t x1, int32_t y1) const
+	{
+		// the points where the segment crosses grid lines
+		std::vector<double> ts = {0, 1};
+		for(int32_t k = std::min(x0, x1) + 1; k < std::max(x0, x1); k++)
+		{
+			ts.push_back(double(k - x0) / (x1 - x0));
+		}
+		for(int32_t k = std::min(y0, y1) + 1; k < std::max(y0, y1); k++)
+		{
+			ts.push_back(double(k - y0) / (y1 - y0));
+		}
+		std::sort(ts.begin(), ts.end());
+
+		for(size_t i = 0; i + 1 < ts.size(); i++)
+		{
+			if(ts[i + 1] - ts[i] < 1e-9) { continue; }
+			double t   = (ts[i] + ts[i + 1]) / 2;
+			double mx  = x0 + t * (x1 - x0);
+			double my  = y0 + t * (y1 - y0);
+			int32_t cx = int32_t(std::floor(mx));
+			int32_t cy = int32_t(std::floor(my));
+			if(x0 == x1)
+			{
+				if(!free(x0 - 1, cy) && !free(x0, cy)) { return false; }
+			}
+			else if(y0 == y1)
+			{
+				if(!free(cx, y0 - 1) && !free(cx, y0)) { return false; }
+			}
+			else if(!free(cx, cy)) { return false; }
+
+			// a grid point inside the segment
+			if(i == 0) { continue; }
+			double px = x0 + ts[i] * (x1 - x0);
+			double py = y0 + ts[i] * (y1 - y0);
+			if(std::abs(px - std::round(px)) < 1e-9
+			   && std::abs(py - std::round(py)) < 1e-9
+			   && double_corner(int32_t(std::round(px)),
+			                    int32_t(std::round(py))))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// the length of the shortest path, or infinity
+	double
+	cost(int32_t sx, int32_t sy, int32_t tx, int32_t ty) const
+	{
+		double inf = std::numeric_limits<double>::infinity();
+		if(!on_grid(sx, sy) || !on_grid(tx, ty)) { return inf; }
+
+		// paths turn only at grid points next to a free cell, and never at
+		// a double corner
+		std::vector<std::pair<int32_t, int32_t>> points
+		    = {{sx, sy}, {tx, ty}};
+		for(int32_t y = 0; y <= h_; y++)
+			for(int32_t x = 0; x <= w_; x++)
+			{
+				if(on_grid(x, y) && !double_corner(x, y))
+				{
+					points.push_back({x, y});
+				}
+			}
+
+		std::vector<double> dist(points.size(), inf);
+		std::vector<bool> done(points.size(), false);
+		dist[0] = 0;
+		while(true)
+		{
+			size_t u = points.size();
+			for(size_t i = 0; i < points.size(); i++)
+			{
+				if(!done[i] && dist[i] < inf
+				   && (u == points.size() || dist[i] < dist[u]))
+				{
+					u = i;
+				}
+			}
+			if(u == points.size() || u == 1) { break; }
+			done[u]       = true;
+			auto [ux, uy] = points[u];
+			for(size_t v = 0; v < points.size(); v++)
+			{
+				if(done[v]) { continue; }
+				auto [vx, vy] = points[v];
+				double d      = std::hypot(vx - ux, vy - uy);
+				if(dist[u] + d < dist[v] && visible(ux, uy, vx, vy))
+				{
+					dist[v] = dist[u] + d;
+				}
+			}
+		}
+		return dist[1];
+	}
+
+private:
+	const warthog::domain::gridmap& map_;
+	int32_t w_;
+	int32_t h_;
+};
+
+} // namespace
+
+TEST_CASE("anya matches a visibility graph", "[search][anya]")
+{
+	using namespace warthog;
+	for(uint32_t seed : {0, 1, 2})
+	{
+		domain::gridmap map(12, 14);
+		test::random_map(map, 4, seed);
+		anya::anya_search anya(&map);
+		search::gridmap_expansion_policy* expander = anya.get_expander();
+		oracle ref(map);
+
+		std::mt19937 rng(seed);
+		for(uint32_t i = 0; i < 40; i++)
+		{
+			int32_t sx = rng() % 14, sy = rng() % 12;
+			int32_t tx = rng() % 14, ty = rng() % 12;
+			search::problem_instance pi(
+			    expander->get_pack(sx, sy), expander->get_pack(tx, ty));
+			search::search_parameters par;
+			search::solution sol;
+			anya.get_path(&pi, &par, &sol);
+			double expected = ref.cost(sx, sy, tx, ty);
+			if(expected == std::numeric_limits<double>::infinity())
+			{
+				CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+				CHECK(sol.path_.empty());
+				continue;
+			}
+			CHECK(std::abs(sol.sum_of_edge_costs_ - expected) < 1e-6);
+
+			// the turning points are linked by visible segments
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+			double length = 0;
+			for(size_t j = 1; j < sol.path_.size(); j++)
+			{
+				int32_t ax = sol.path_[j - 1].id % 14;
+				int32_t ay = sol.path_[j - 1].id / 14;
+				int32_t bx = sol.path_[j].id % 14;
+				int32_t by = sol.path_[j].id / 14;
+				CHECK(ref.visible(ax, ay, bx, by));
+				length += std::hypot(bx - ax, by - ay);
+			}
+			CHECK(std::abs(length - sol.sum_of_edge_costs_) < 1e-6);
+
+			search::solution cost_only;
+			anya.get_pathcost(&pi, &par, &cost_only);
+			CHECK(
+			    std::abs(cost_only.sum_of_edge_costs_ - sol.sum_of_edge_costs_)
+			    < 1e-6);
+		}
+	}
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/beam_search.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <cmath>
+#include <random>
+
+TEST_CASE("beam search is never cheaper than a*", "[search][beam]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 4);
+	test::reference_astar astar(&map);
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::beam_search beam(&heuristic, &expander);
+
+	std::mt19937 rng;
+	uint32_t failed = 0;
+	for(uint32_t i = 0; i < 100; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		cost_t expected = astar.cost(pi);
+		for(uint32_t width : {1u, 4u, 32u})
+		{
+			beam.set_beam_width(width);
+			search::search_parameters par;
+			search::solution sol;
+			beam.get_path(&pi, &par, &sol);
+			if(sol.sum_of_edge_costs_ == warthog::COST_MAX)
+			{
+				// narrow beams may lose every path to the target
+				CHECK(sol.path_.empty());
+				if(expected != warthog::COST_MAX && width == 1) { failed++; }
+				continue;
+			}
+			REQUIRE(expected != warthog::COST_MAX);
+			CHECK(sol.sum_of_edge_costs_ > expected - 1e-6);
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+			CHECK(
+			    std::abs(
+			        test::path_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+			    < 1e-6);
+		}
+	}
+	CHECK(failed > 0);
+}
+
+TEST_CASE("a very wide beam matches a*", "[search][beam]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 4);
+	test::reference_astar astar(&map);
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	// wider than any layer; nothing is ever dropped
+	search::beam_search beam(&heuristic, &expander, 48 * 48);
+
+	std::mt19937 rng;
+	for(uint32_t i = 0; i < 100; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution sol;
+		beam.get_path(&pi, &par, &sol);
+		CHECK(std::abs(sol.sum_of_edge_costs_ - astar.cost(pi)) < 1e-6);
+	}
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/block_astar/block_astar.h>
+#include <warthog/domain/gridmap.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+TEST_CASE(
+    "block a* matches a* before and after set_label",
+    "[search][block_astar]")
+{
+	using namespace warthog;
+	domain::gridmap map(46, 70);
+	test::random_map(map, 5);
+	block_astar::block_astar block(&map);
+
+	test::reference_astar astar(&map);
+
+	std::mt19937 rng;
+	for(uint32_t round = 0; round < 5; round++)
+	{
+		for(uint32_t i = 0; i < 60; i++)
+		{
+			search::problem_instance pi = test::random_query(map, rng);
+			search::search_parameters par;
+			search::solution expected, sol, cost_only;
+			astar.get_pathcost(&pi, &expected);
+			block.get_path(&pi, &par, &sol);
+			block.get_pathcost(&pi, &par, &cost_only);
+			CHECK(
+			    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+			    < 1e-6);
+			CHECK(
+			    std::abs(
+			        cost_only.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+			    < 1e-6);
+			if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+			{
+				continue;
+			}
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+			CHECK(
+			    std::abs(
+			        test::path_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+			    < 1e-6);
+		}
+
+		// block and free cells, updating the patterns of their blocks
+		for(uint32_t i = 0; i < 40; i++)
+		{
+			uint32_t x = rng() % 70, y = rng() % 46;
+			block.set_label(
+			    x, y, !map.get_label(map.to_padded_id_from_unpadded(x, y)));
+		}
+	}
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/dead_end/dead_end_expansion_policy.h>
+#include <warthog/dead_end/dead_end_map.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <random>
+
+TEST_CASE(
+    "dead-end pruning matches a* before and after set_label",
+    "[search][dead_end]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 80);
+	test::random_map(map, 3);
+	dead_end::dead_end_map regions(&map);
+	regions.build();
+	CHECK(regions.get_num_cells() > 0);
+
+	test::reference_astar astar(&map);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	dead_end::dead_end_expansion_policy<> de_expander(&regions, &map);
+	util::pqueue_min de_open;
+	search::unidirectional_search de_astar(
+	    &heuristic, &de_expander, &de_open);
+
+	std::mt19937 rng;
+	for(uint32_t round = 0; round < 5; round++)
+	{
+		uint64_t expanded = 0, de_expanded = 0;
+		for(uint32_t i = 0; i < 60; i++)
+		{
+			search::problem_instance pi = test::random_query(map, rng);
+			search::search_parameters par;
+			search::solution expected, sol;
+			astar.get_pathcost(&pi, &expected);
+			de_astar.get_path(&pi, &par, &sol);
+			CHECK(
+			    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+			    < 1e-6);
+			if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+			{
+				continue;
+			}
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+			expanded += expected.met_.nodes_expanded_;
+			de_expanded += sol.met_.nodes_expanded_;
+		}
+		CHECK(de_expanded < expanded);
+
+		// the regions are stale after the map changes, until rebuilt
+		for(uint32_t i = 0; i < 30; i++)
+		{
+			uint32_t x = rng() % 80, y = rng() % 48;
+			map.set_label(
+			    x, y, !map.get_label(map.to_padded_id_from_unpadded(x, y)));
+		}
+		regions.build();
+	}
+}
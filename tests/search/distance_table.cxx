@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/zero_heuristic.h>
+#include <warthog/search/distance_table.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST_CASE("distance table matches dijkstra", "[search][distance_table]")
+{
+	using namespace warthog;
+	domain::gridmap map(36, 44);
+	test::random_map(map, 4);
+	search::gridmap_expansion_policy expander(&map);
+	heuristic::zero_heuristic heuristic;
+	util::pqueue_min open;
+	search::unidirectional_search dijkstra(&heuristic, &expander, &open);
+
+	std::mt19937 rng;
+	auto cells = [&](uint32_t n) {
+		std::vector<pack_id> ids;
+		for(uint32_t i = 0; i < n; i++)
+		{
+			ids.push_back(test::random_cell(map, rng));
+		}
+		// a repeated cell, which shares a search
+		if(n > 1) { ids.back() = ids.front(); }
+		return ids;
+	};
+
+	// more sources than targets, fewer, and one worker or several
+	uint32_t shapes[][3] = {{7, 3, 1}, {3, 9, 3}, {12, 12, 4}, {1, 1, 2}};
+	for(auto [num_sources, num_targets, num_threads] : shapes)
+	{
+		search::distance_table table(&map, num_threads);
+		CHECK(table.get_num_threads() == num_threads);
+		std::vector<pack_id> sources = cells(num_sources);
+		std::vector<pack_id> targets = cells(num_targets);
+		table.compute(sources, targets);
+		REQUIRE(table.get_num_sources() == num_sources);
+		REQUIRE(table.get_num_targets() == num_targets);
+		REQUIRE(table.get_table().size() == num_sources * num_targets);
+
+		bool reached = false;
+
+		for(uint32_t s = 0; s < num_sources; s++)
+			for(uint32_t t = 0; t < num_targets; t++)
+			{
+				search::problem_instance pi(sources[s], targets[t]);
+				search::search_parameters par;
+				search::solution expected;
+				dijkstra.get_pathcost(&pi, &par, &expected);
+				CHECK(
+				    std::abs(
+				        table.get_cost(s, t) - expected.sum_of_edge_costs_)
+				    < 1e-6);
+				reached |= expected.sum_of_edge_costs_ != warthog::COST_MAX;
+			}
+		if(reached) { CHECK(table.get_metrics().nodes_expanded_ > 0); }
+		uint32_t expanded = 0;
+		for(uint32_t i = 0; i < num_threads; i++)
+		{
+			expanded += table.get_thread_expanded(i);
+		}
+		CHECK(expanded == table.get_metrics().nodes_expanded_);
+	}
+}
+
+TEST_CASE("distance table reuses its workers", "[search][distance_table]")
+{
+	using namespace warthog;
+	domain::gridmap map(24, 24);
+	test::random_map(map, 4);
+	// the same workers answer one query per tick
+	search::distance_table table(&map, 3);
+	search::distance_table single(&map, 1);
+
+	std::mt19937 rng;
+	for(uint32_t tick = 0; tick < 20; tick++)
+	{
+		std::vector<pack_id> sources, targets;
+		for(uint32_t i = 0; i < 1 + tick % 5; i++)
+		{
+			sources.push_back(test::random_cell(map, rng));
+		}
+		for(uint32_t i = 0; i < 1 + tick % 3; i++)
+		{
+			targets.push_back(test::random_cell(map, rng));
+		}
+		table.compute(sources, targets);
+		single.compute(sources, targets);
+		CHECK(table.get_table() == single.get_table());
+		CHECK(
+		    table.get_metrics().nodes_expanded_
+		    == single.get_metrics().nodes_expanded_);
+	}
+}
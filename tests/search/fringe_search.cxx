@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/fringe_search.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <cmath>
+#include <random>
+
+TEST_CASE("fringe search matches a* without a node pool", "[search][fringe]")
+{
+	using namespace warthog;
+	domain::gridmap map(32, 32);
+	test::random_map(map, 4);
+	test::reference_astar astar(&map);
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::fringe_search fringe(&heuristic, &expander);
+
+	std::mt19937 rng;
+	uint32_t unreachable = 0;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution expected, sol;
+		astar.get_pathcost(&pi, &expected);
+		fringe.get_path(&pi, &par, &sol);
+		if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+		{
+			unreachable++;
+			CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+			CHECK(sol.path_.empty());
+			continue;
+		}
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		REQUIRE(!sol.path_.empty());
+		CHECK(sol.path_.front() == pi.start_);
+		CHECK(sol.path_.back() == pi.target_);
+		CHECK(
+		    std::abs(
+		        test::path_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+		    < 1e-6);
+	}
+	CHECK(unreachable > 0);
+}
+
+TEST_CASE("fringe search stops at the expansions cutoff", "[search][fringe]")
+{
+	using namespace warthog;
+	domain::gridmap map(32, 32);
+	test::random_map(map, 4);
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::fringe_search fringe(&heuristic, &expander);
+
+	std::mt19937 rng;
+	uint32_t cut_off = 0;
+	for(uint32_t i = 0; i < 50; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution full;
+		fringe.get_path(&pi, &par, &full);
+		uint32_t needed = static_cast<uint32_t>(full.met_.nodes_expanded_);
+		if(full.sum_of_edge_costs_ == warthog::COST_MAX || needed < 2)
+		{
+			continue;
+		}
+
+		search::search_parameters cut;
+		cut.set_max_expansions_cutoff(needed / 2);
+		search::solution partial;
+		fringe.get_path(&pi, &cut, &partial);
+		CHECK(partial.sum_of_edge_costs_ == warthog::COST_MAX);
+		CHECK(partial.path_.empty());
+		CHECK(partial.met_.nodes_expanded_ == needed / 2);
+		cut_off++;
+
+		// the search needs no more than its own expansions
+		cut.set_max_expansions_cutoff(needed);
+		search::solution enough;
+		fringe.get_path(&pi, &cut, &enough);
+		CHECK(enough.sum_of_edge_costs_ == full.sum_of_edge_costs_);
+		CHECK(enough.path_ == full.path_);
+	}
+	CHECK(cut_off > 10);
+}
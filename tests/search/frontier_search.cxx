@@ -0,0 +1,52 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/frontier_search.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <cmath>
+#include <random>
+
+TEST_CASE("frontier search matches a*", "[search][frontier]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 4);
+	test::reference_astar astar(&map);
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::frontier_search frontier(&heuristic, &expander);
+
+	std::mt19937 rng;
+	uint32_t split = 0;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution expected, sol;
+		astar.get_pathcost(&pi, &expected);
+		frontier.get_path(&pi, &par, &sol);
+		if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+		{
+			CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+			CHECK(sol.path_.empty());
+			continue;
+		}
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		REQUIRE(!sol.path_.empty());
+		CHECK(sol.path_.front() == pi.start_);
+		CHECK(sol.path_.back() == pi.target_);
+		// the path rebuilt from the relays is made of adjacent octile
+		// moves, whose costs add up to the cost of the search
+		CHECK(
+		    std::abs(
+		        test::path_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+		    < 1e-6);
+		if(frontier.get_searches() > 1) { split++; }
+	}
+	CHECK(split > 50);
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/hda_star.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+TEST_CASE("hda* finds the costs of a*", "[search][hda]")
+{
+	using namespace warthog;
+	domain::gridmap map(64, 64);
+	test::random_map(map, 4);
+	test::reference_astar astar(&map);
+
+	std::mt19937 rng;
+	std::vector<search::problem_instance> queries;
+	std::vector<double> expected;
+	for(uint32_t i = 0; i < 24; i++)
+	{
+		queries.push_back(test::random_query(map, rng));
+		expected.push_back(astar.cost(queries.back()));
+	}
+
+	for(uint32_t workers = 2; workers <= 4; workers++)
+	{
+		std::vector<std::unique_ptr<search::gridmap_expansion_policy>> es;
+		std::vector<std::unique_ptr<heuristic::octile_heuristic>> hs;
+		std::vector<search::gridmap_expansion_policy*> eptr;
+		std::vector<heuristic::octile_heuristic*> hptr;
+		for(uint32_t i = 0; i < workers; i++)
+		{
+			es.emplace_back(new search::gridmap_expansion_policy(&map));
+			es.back()->set_nodes_pool_size(0);
+			hs.emplace_back(
+			    new heuristic::octile_heuristic(map.width(), map.height()));
+			eptr.push_back(es.back().get());
+			hptr.push_back(hs.back().get());
+		}
+		search::hda_star hda(hptr, eptr);
+
+		for(uint32_t batch : {1u, 7u, 64u})
+			for(uint32_t block : {0u, 4u})
+			{
+				hda.set_batch_size(batch);
+				hda.set_block_partition(map.width(), map.height(), block);
+				for(size_t i = 0; i < queries.size(); i++)
+				{
+					search::search_parameters par;
+					search::solution sol;
+					hda.get_path(&queries[i], &par, &sol);
+					uint32_t expanded = 0;
+					for(uint32_t t = 0; t < workers; t++)
+					{
+						expanded += hda.get_thread_expanded(t);
+					}
+					CHECK(expanded == sol.met_.nodes_expanded_);
+					if(expected[i] == warthog::COST_MAX)
+					{
+						CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+						continue;
+					}
+					CHECK(
+					    std::abs(sol.sum_of_edge_costs_ - expected[i])
+					    < 1e-6);
+					REQUIRE(!sol.path_.empty());
+					CHECK(sol.path_.front() == queries[i].start_);
+					CHECK(sol.path_.back() == queries[i].target_);
+				}
+			}
+	}
+}
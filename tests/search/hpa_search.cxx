@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/hpa/hpa_graph.h>
+#include <warthog/hpa/hpa_search.h>
+
+#include <cmath>
+#include <random>
+
+TEST_CASE("hpa* paths before and after set_label", "[search][hpa]")
+{
+	using namespace warthog;
+	domain::gridmap map(64, 64);
+	test::random_map(map, 5);
+	hpa::hpa_graph graph(&map, 8);
+	hpa::hpa_search hpa(&graph);
+	test::reference_astar astar(&map);
+
+	std::mt19937 rng;
+	for(uint32_t round = 0; round < 4; round++)
+	{
+		// a graph built from scratch for the map as it is now
+		domain::gridmap copy(64, 64);
+		for(uint32_t y = 0; y < 64; ++y)
+			for(uint32_t x = 0; x < 64; ++x)
+			{
+				copy.set_label(
+				    x, y, map.get_label(map.to_padded_id_from_unpadded(x, y)));
+			}
+		hpa::hpa_graph fresh_graph(&copy, 8);
+		hpa::hpa_search fresh(&fresh_graph);
+		CHECK(graph.get_num_nodes() == fresh_graph.get_num_nodes());
+
+		for(uint32_t i = 0; i < 50; i++)
+		{
+			search::problem_instance pi = test::random_query(map, rng);
+			search::search_parameters par;
+			search::solution expected, sol, fresh_sol;
+			astar.get_pathcost(&pi, &expected);
+			hpa.get_path(&pi, &par, &sol);
+			fresh.get_path(&pi, &par, &fresh_sol);
+			CHECK(
+			    std::abs(sol.sum_of_edge_costs_ - fresh_sol.sum_of_edge_costs_)
+			    < 1e-6);
+			if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+			{
+				CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+				continue;
+			}
+			// not always optimal, but always a path
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+			CHECK(
+			    std::abs(
+			        test::path_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+			    < 1e-6);
+			CHECK(
+			    sol.sum_of_edge_costs_
+			    >= expected.sum_of_edge_costs_ - 1e-6);
+		}
+
+		// toggle cells through the graph, which rebuilds their clusters
+		for(uint32_t i = 0; i < 20; i++)
+		{
+			uint32_t x = rng() % 64, y = rng() % 64;
+			graph.set_label(
+			    x, y, !map.get_label(map.to_padded_id_from_unpadded(x, y)));
+		}
+	}
+}
@@ -0,0 +1,167 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/ida_star.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace
+{
+
+// a query from a random cell to one at most 3 cells away in x and y;
+// IDA* revisits grid cells exponentially often on longer paths
+warthog::search::problem_instance
+short_query(const warthog::domain::gridmap& map, std::mt19937& rng)
+{
+	int32_t w  = map.header_width();
+	int32_t h  = map.header_height();
+	int32_t x  = rng() % w;
+	int32_t y  = rng() % h;
+	int32_t tx = std::clamp<int32_t>(x + int32_t(rng() % 7) - 3, 0, w - 1);
+	int32_t ty = std::clamp<int32_t>(y + int32_t(rng() % 7) - 3, 0, h - 1);
+	return warthog::search::problem_instance(
+	    map.to_unpadded_id_from_unpadded(x, y),
+	    map.to_unpadded_id_from_unpadded(tx, ty));
+}
+
+} // namespace
+
+TEST_CASE("ida* matches a* without a node pool", "[search][ida]")
+{
+	using namespace warthog;
+	domain::gridmap map(16, 16);
+	test::random_map(map, 4);
+	test::reference_astar astar(&map);
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::ida_star ida(&heuristic, &expander);
+
+	std::mt19937 rng;
+	uint32_t solved = 0;
+	for(uint32_t i = 0; i < 100; i++)
+	{
+		search::problem_instance pi = short_query(map, rng);
+		search::search_parameters par;
+		search::solution expected, sol;
+		astar.get_pathcost(&pi, &expected);
+		// a short hop may still need a long detour; unreachable targets
+		// are covered by the next test
+		if(expected.sum_of_edge_costs_ > 6) { continue; }
+		ida.get_path(&pi, &par, &sol);
+		solved++;
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		REQUIRE(!sol.path_.empty());
+		CHECK(sol.path_.front() == pi.start_);
+		CHECK(sol.path_.back() == pi.target_);
+		CHECK(
+		    std::abs(
+		        test::path_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+		    < 1e-6);
+		CHECK(ida.get_iterations() > 0);
+	}
+	CHECK(solved > 20);
+}
+
+TEST_CASE("ida* fails on unreachable targets and cutoffs", "[search][ida]")
+{
+	using namespace warthog;
+	// the start is at the end of a sealed corridor, (0, 0) to (2, 0)
+	domain::gridmap map(8, 8);
+	test::open_map(map);
+	for(uint32_t x = 0; x < 4; x++)
+	{
+		map.set_label(x, 1, false);
+	}
+	map.set_label(3, 0, false);
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::ida_star ida(&heuristic, &expander);
+
+	search::problem_instance sealed(
+	    expander.get_pack(0, 0), expander.get_pack(6, 6));
+	search::search_parameters par;
+	search::solution sol;
+	ida.get_path(&sealed, &par, &sol);
+	CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+	CHECK(sol.path_.empty());
+	CHECK(sol.met_.nodes_expanded_ > 0);
+
+	// the start is in a sealed 2x2 pocket, (0, 7) to (1, 6), whose cells
+	// form a cycle
+	domain::gridmap pocket_map(8, 8);
+	test::open_map(pocket_map);
+	for(uint32_t i = 0; i < 3; i++)
+	{
+		pocket_map.set_label(2, 7 - i, false);
+		pocket_map.set_label(i, 5, false);
+	}
+	search::gridmap_expansion_policy pocket_expander(&pocket_map);
+	pocket_expander.set_nodes_pool_size(0);
+	search::ida_star pocket_ida(&heuristic, &pocket_expander);
+	search::problem_instance pocket(
+	    pocket_expander.get_pack(0, 7), pocket_expander.get_pack(7, 0));
+	search::solution pocket_sol;
+	pocket_ida.get_path(&pocket, &par, &pocket_sol);
+	CHECK(pocket_sol.sum_of_edge_costs_ == warthog::COST_MAX);
+	CHECK(pocket_sol.path_.empty());
+	CHECK(pocket_sol.met_.nodes_expanded_ > 0);
+
+	// a query which succeeds fails with fewer expansions than it needs
+	search::problem_instance pi(
+	    expander.get_pack(4, 0), expander.get_pack(7, 5));
+	search::solution full;
+	ida.get_path(&pi, &par, &full);
+	REQUIRE(full.sum_of_edge_costs_ != warthog::COST_MAX);
+	uint32_t needed = static_cast<uint32_t>(full.met_.nodes_expanded_);
+	REQUIRE(needed > 2);
+
+	search::search_parameters cut;
+	cut.set_max_expansions_cutoff(needed / 2);
+	search::solution partial;
+	ida.get_path(&pi, &cut, &partial);
+	CHECK(partial.sum_of_edge_costs_ == warthog::COST_MAX);
+	CHECK(partial.path_.empty());
+	CHECK(partial.met_.nodes_expanded_ <= needed / 2 + 1);
+
+	cut.set_max_expansions_cutoff(needed + 1);
+	search::solution enough;
+	ida.get_path(&pi, &cut, &enough);
+	CHECK(enough.sum_of_edge_costs_ == full.sum_of_edge_costs_);
+	CHECK(enough.path_ == full.path_);
+}
+
+TEST_CASE("ida* stops at the time cutoff within an iteration", "[search][ida]")
+{
+	using namespace warthog;
+	// an open map with the target walled in; one iteration walks the simple
+	// paths of the whole map, which takes far longer than the cutoff
+	domain::gridmap map(32, 32);
+	test::open_map(map);
+	for(uint32_t y = 27; y <= 29; y++)
+		for(uint32_t x = 27; x <= 29; x++)
+		{
+			if(x != 28 || y != 28) { map.set_label(x, y, false); }
+		}
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_nodes_pool_size(0);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::ida_star ida(&heuristic, &expander);
+
+	search::problem_instance pi(
+	    expander.get_pack(0, 0), expander.get_pack(28, 28));
+	search::search_parameters par;
+	par.set_max_time_cutoff_s(0.2);
+	search::solution sol;
+	ida.get_path(&pi, &par, &sol);
+	CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+	CHECK(sol.path_.empty());
+	CHECK(sol.met_.time_elapsed_nano_ < std::chrono::seconds(2));
+}
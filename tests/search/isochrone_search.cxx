@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/isochrone_search.h>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+
+// the cost of a shortest path from @param start to every unpadded id, by
+// Dijkstra's algorithm over octile moves which do not cut corners
+std::vector<double>
+reference_dijkstra(const warthog::domain::gridmap& map, warthog::pack_id start)
+{
+	int32_t w = map.header_width();
+	int32_t h = map.header_height();
+	auto free = [&](int32_t x, int32_t y) {
+		return x >= 0 && x < w && y >= 0 && y < h
+		    && map.get_label(map.to_padded_id_from_unpadded(x, y));
+	};
+
+	double inf = std::numeric_limits<double>::infinity();
+	std::vector<double> dist(w * h, inf);
+	using entry = std::pair<double, uint32_t>;
+	std::priority_queue<entry, std::vector<entry>, std::greater<entry>> open;
+	if(!free(start.id % w, start.id / w)) { return dist; }
+	dist[start.id] = 0;
+	open.push({0, uint32_t(start.id)});
+	while(!open.empty())
+	{
+		auto [d, id] = open.top();
+		open.pop();
+		if(d > dist[id]) { continue; }
+		int32_t x = id % w, y = id / w;
+		for(int32_t dy = -1; dy <= 1; dy++)
+			for(int32_t dx = -1; dx <= 1; dx++)
+			{
+				if((dx == 0 && dy == 0) || !free(x + dx, y + dy)) { continue; }
+				if(dx != 0 && dy != 0
+				   && (!free(x + dx, y) || !free(x, y + dy)))
+				{
+					continue;
+				}
+				uint32_t next = (y + dy) * w + (x + dx);
+				double cost
+				    = d + (dx != 0 && dy != 0 ? warthog::DBL_ROOT_TWO : 1);
+				if(cost < dist[next])
+				{
+					dist[next] = cost;
+					open.push({cost, next});
+				}
+			}
+	}
+	return dist;
+}
+
+} // namespace
+
+TEST_CASE("isochrones match dijkstra", "[search][isochrone]")
+{
+	using namespace warthog;
+	domain::gridmap map(40, 60);
+	test::random_map(map, 5);
+	search::isochrone_search isochrone(&map);
+
+	std::mt19937 rng;
+	for(uint32_t q = 0; q < 12; q++)
+	{
+		pack_id start = test::random_cell(map, rng);
+
+		std::vector<double> dist = reference_dijkstra(map, start);
+
+		// the cutoff is inclusive; integral costs are exact, others may
+		// be summed in another order, so cells at the cutoff are skipped
+		// unless it is integral
+		for(double cutoff : {0.0, 6.0, 10.0, 15.5, 1000.0})
+		{
+			search::search_parameters par;
+			par.set_max_cost_cutoff(cutoff);
+			search::solution sol;
+			isochrone.get_region(start, &par, &sol);
+
+			uint32_t num_cells = 0;
+			double largest     = 0;
+			for(uint32_t i = 0; i < dist.size(); i++)
+			{
+				bool exact = dist[i] == std::floor(dist[i]);
+				if(!exact && std::abs(dist[i] - cutoff) < 1e-6) { continue; }
+				bool expected = dist[i] <= cutoff;
+				CHECK(isochrone.reached(pack_id{i}) == expected);
+				if(expected)
+				{
+					num_cells++;
+					largest = std::max(largest, dist[i]);
+				}
+			}
+			CHECK(isochrone.get_num_cells() == num_cells);
+			if(num_cells > 0)
+			{
+				CHECK(std::abs(sol.sum_of_edge_costs_ - largest) < 1e-6);
+			}
+		}
+	}
+}
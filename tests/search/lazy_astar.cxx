@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/differential_heuristic.h>
+#include <warthog/heuristic/differential_heuristic_builder.h>
+#include <warthog/heuristic/lazy_heuristic.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <filesystem>
+#include <random>
+
+TEST_CASE("lazy a* matches eager a*", "[search][lazy]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 5);
+	std::string file
+	    = (std::filesystem::temp_directory_path() / "warthog_test_lazy.dh")
+	          .string();
+	heuristic::differential_heuristic_builder builder(&map);
+	builder.build(6);
+	REQUIRE(builder.save(file.c_str()) > 0);
+	heuristic::differential_heuristic dh(map.width(), map.height());
+	REQUIRE(dh.load(file.c_str(), map));
+	std::filesystem::remove(file);
+
+	// eager: the full bound for every node generated
+	search::gridmap_expansion_policy expander(&map);
+	util::pqueue_min open;
+	search::unidirectional_search eager(&dh, &expander, &open);
+
+	heuristic::octile_heuristic octile(map.width(), map.height());
+	heuristic::lazy_heuristic lazy_h(&octile, &dh);
+	search::gridmap_expansion_policy lazy_expander(&map);
+	util::pqueue_min lazy_open;
+	search::unidirectional_search lazy(&lazy_h, &lazy_expander, &lazy_open);
+
+	std::mt19937 rng;
+	uint64_t generated = 0;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution expected, sol;
+		eager.get_path(&pi, &par, &expected);
+		lazy.get_path(&pi, &par, &sol);
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		CHECK(sol.met_.nodes_expanded_ == expected.met_.nodes_expanded_);
+		CHECK(sol.path_.size() == expected.path_.size());
+		generated += expected.met_.nodes_generated_;
+	}
+	// the expensive bound is computed only for nodes at the top of OPEN
+	CHECK(lazy_h.get_num_evaluations() < generated);
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/multi_target_search.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST_CASE("multi-target search matches a* per target", "[search][multi]")
+{
+	using namespace warthog;
+	domain::gridmap map(40, 50);
+	test::random_map(map, 4);
+	search::multi_target_search multi(&map, 16);
+	test::reference_astar astar(&map);
+
+	std::mt19937 rng;
+	// below and above the threshold of the bucket grid
+	for(uint32_t k : {1, 5, 40})
+		for(uint32_t q = 0; q < 15; q++)
+		{
+			search::multi_target_instance mi;
+			mi.start_ = test::random_cell(map, rng);
+			std::vector<cost_t> expected;
+			for(uint32_t i = 0; i < k; i++)
+			{
+				// some repeated targets, and the start among them
+				pack_id t = test::random_cell(map, rng);
+				if(i > 0 && rng() % 8 == 0) { t = mi.targets_[i - 1]; }
+				if(k > 1 && q == 0 && i == k - 1) { t = mi.start_; }
+				mi.targets_.push_back(t);
+
+				expected.push_back(
+				    astar.cost(search::problem_instance(mi.start_, t)));
+			}
+			cost_t nearest
+			    = *std::min_element(expected.begin(), expected.end());
+
+			// all targets
+			mi.mode_ = search::target_mode::all;
+			search::search_parameters par;
+			search::solution all;
+			multi.get_pathcost(&mi, &par, &all);
+			for(uint32_t i = 0; i < k; i++)
+			{
+				CHECK(std::abs(multi.get_cost(i) - expected[i]) < 1e-6);
+			}
+			CHECK(std::abs(all.sum_of_edge_costs_ - nearest) < 1e-6);
+
+			// the nearest target, with a path to it
+			mi.mode_ = search::target_mode::nearest;
+			search::solution sol;
+			multi.get_path(&mi, &par, &sol);
+			CHECK(std::abs(sol.sum_of_edge_costs_ - nearest) < 1e-6);
+			if(nearest == warthog::COST_MAX)
+			{
+				CHECK(multi.get_nearest() == UINT32_MAX);
+				continue;
+			}
+			REQUIRE(multi.get_nearest() < k);
+			CHECK(std::abs(expected[multi.get_nearest()] - nearest) < 1e-6);
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == mi.start_);
+			CHECK(sol.path_.back() == mi.targets_[multi.get_nearest()]);
+		}
+}
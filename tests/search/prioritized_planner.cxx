@@ -0,0 +1,154 @@
+#include <catch2/catch_test_macros.hpp>
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/prioritized_planner.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+
+// true if no two agents occupy the same cell at the same timestep, or swap
+// cells between two timesteps. agents stay at their goal once arrived.
+bool
+collision_free(const std::vector<std::vector<warthog::pack_id>>& paths)
+{
+	size_t horizon = 0;
+	for(auto& p : paths)
+	{
+		horizon = std::max(horizon, p.size());
+	}
+	auto at = [](const std::vector<warthog::pack_id>& p, size_t t) {
+		return t < p.size() ? p[t] : p.back();
+	};
+	for(size_t t = 0; t < horizon; t++)
+		for(size_t i = 0; i < paths.size(); i++)
+			for(size_t j = i + 1; j < paths.size(); j++)
+			{
+				if(at(paths[i], t) == at(paths[j], t)) { return false; }
+				if(t + 1 < horizon && at(paths[i], t) == at(paths[j], t + 1)
+				   && at(paths[i], t + 1) == at(paths[j], t))
+				{
+					return false;
+				}
+			}
+	return true;
+}
+
+} // namespace
+
+TEST_CASE("reservation table detects conflicts", "[search][mapf]")
+{
+	using namespace warthog;
+	domain::gridmap map(16, 16);
+	search::reservation_table rt(map.width(), map.height());
+	pad_id a = map.to_padded_id_from_unpadded(3, 3);
+	pad_id b = map.to_padded_id_from_unpadded(4, 3);
+	pad_id c = map.to_padded_id_from_unpadded(4, 4);
+
+	// an agent moving a -> b between timesteps 5 and 6
+	rt.reserve_vertex(a, 5);
+	rt.reserve_edge(a, b, 5);
+	rt.reserve_vertex(b, 6);
+
+	CHECK_FALSE(rt.vertex_free(a, 5));
+	CHECK(rt.vertex_free(a, 6));
+	CHECK(rt.vertex_free(b, 5));
+	CHECK_FALSE(rt.edge_free(b, a, 5)); // swap
+	CHECK_FALSE(rt.edge_free(c, b, 5)); // ends in a reserved cell
+	CHECK(rt.edge_free(b, c, 5));
+	CHECK(rt.edge_free(b, a, 6));
+	CHECK(rt.free_from(a, 6));
+	CHECK_FALSE(rt.free_from(b, 6));
+
+	rt.reserve_forever(c, 10);
+	CHECK(rt.vertex_free(c, 9));
+	CHECK_FALSE(rt.vertex_free(c, 100));
+	CHECK_FALSE(rt.free_from(c, 0));
+
+	// many reservations force the table to grow
+	for(uint32_t t = 0; t < 5000; t++)
+	{
+		rt.reserve_vertex(map.to_padded_id_from_unpadded(t % 16, 8), t);
+	}
+	CHECK_FALSE(rt.vertex_free(map.to_padded_id_from_unpadded(7, 8), 4999));
+	CHECK(rt.vertex_free(map.to_padded_id_from_unpadded(7, 8), 4998));
+	CHECK_FALSE(rt.vertex_free(a, 5));
+}
+
+TEST_CASE("prioritized planning avoids collisions", "[search][mapf]")
+{
+	using namespace warthog;
+	// a corridor two cells wide; agents cross it in both directions
+	domain::gridmap map(5, 12);
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, y == 1 || y == 2);
+		}
+
+	search::prioritized_planner planner(&map, true);
+	search::spacetime_expansion_policy& expander = planner.get_expander();
+	std::vector<search::problem_instance> agents;
+	agents.emplace_back(expander.get_pack(0, 1), expander.get_pack(11, 1));
+	agents.emplace_back(expander.get_pack(11, 1), expander.get_pack(0, 1));
+	agents.emplace_back(expander.get_pack(1, 2), expander.get_pack(10, 2));
+	agents.emplace_back(expander.get_pack(10, 2), expander.get_pack(2, 1));
+
+	search::search_parameters par;
+	std::vector<std::vector<pack_id>> paths;
+	REQUIRE(planner.plan(agents, &par, paths) == agents.size());
+	CHECK(collision_free(paths));
+
+	for(size_t i = 0; i < agents.size(); i++)
+	{
+		REQUIRE(!paths[i].empty());
+		CHECK(paths[i].front() == agents[i].start_);
+		CHECK(paths[i].back() == agents[i].target_);
+		// one move or wait per timestep
+		for(size_t t = 1; t < paths[i].size(); t++)
+		{
+			int32_t x0, y0, x1, y1;
+			expander.get_xy(paths[i][t - 1], x0, y0);
+			expander.get_xy(paths[i][t], x1, y1);
+			CHECK(std::abs(x0 - x1) + std::abs(y0 - y1) <= 1);
+		}
+	}
+}
+
+TEST_CASE("prioritized planning fails fast on blocked goals", "[search][mapf]")
+{
+	using namespace warthog;
+	// a wall down the middle, with one gap at the top
+	domain::gridmap map(32, 32);
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, x != 16 || y == 0);
+		}
+
+	search::prioritized_planner planner(&map, true);
+	search::spacetime_expansion_policy& expander = planner.get_expander();
+	std::vector<search::problem_instance> agents;
+	// parks in the gap
+	agents.emplace_back(expander.get_pack(2, 2), expander.get_pack(16, 0));
+	// its goal is the cell of the first agent
+	agents.emplace_back(expander.get_pack(3, 3), expander.get_pack(16, 0));
+	// its goal is on the far side of the first agent
+	agents.emplace_back(expander.get_pack(4, 4), expander.get_pack(30, 30));
+
+	search::search_parameters par;
+	std::vector<std::vector<pack_id>> paths;
+	search::search_metrics met;
+	REQUIRE(planner.plan(agents, &par, paths, &met) == 1);
+	CHECK(paths[1].empty());
+	CHECK(paths[2].empty());
+
+	// the searches stop at the last reserved timestep plus the length of
+	// the path without other agents plus the slack, not after a number of
+	// timesteps on the order of the size of the map
+	uint32_t horizon
+	    = uint32_t(paths[0].size()) + 2 * 32 + planner.get_slack();
+	CHECK(met.nodes_expanded_ < 16 * 32 * horizon);
+	CHECK(expander.get_horizon() == 0);
+}
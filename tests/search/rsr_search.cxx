@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/rsr/rect_decomposition.h>
+#include <warthog/rsr/rsr_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+
+
+// is every traversable cell in the rectangle it names, and does every
+// rectangle hold only cells which name it?
+bool
+valid(
+    const warthog::rsr::rect_decomposition& rects,
+    const warthog::domain::gridmap& map)
+{
+	std::unordered_map<uint32_t, uint32_t> cells;
+	for(uint32_t i = 0; i < map.width() * map.height(); i++)
+	{
+		uint32_t id = rects.get_rect_id(warthog::pad_id{i});
+		if(!map.get_label(warthog::pad_id{i}))
+		{
+			if(id != warthog::rsr::NO_RECT) { return false; }
+			continue;
+		}
+		if(id == warthog::rsr::NO_RECT) { return false; }
+		const warthog::rsr::rsr_rect& r = rects.get_rect(id);
+
+		uint32_t x = i % map.width(), y = i / map.width();
+		if(x < r.x1_ || x > r.x2_ || y < r.y1_ || y > r.y2_) { return false; }
+		cells[id]++;
+	}
+	for(auto [id, n] : cells)
+	{
+		const warthog::rsr::rsr_rect& r = rects.get_rect(id);
+		if(n != (r.x2_ - r.x1_ + 1) * (r.y2_ - r.y1_ + 1)) { return false; }
+	}
+	return cells.size() == rects.get_num_rects();
+}
+
+} // namespace
+
+TEST_CASE("rsr matches a* before and after set_label", "[search][rsr]")
+{
+	using namespace warthog;
+	domain::gridmap map(40, 40);
+	test::random_map(map, 12);
+	rsr::rect_decomposition rects(&map);
+	rects.build();
+	REQUIRE(valid(rects, map));
+	CHECK(rects.get_num_rects() < 40 * 40 / 4);
+
+	test::reference_astar astar(&map);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	rsr::rsr_expansion_policy rsr_expander(&map, &rects);
+	util::pqueue_min rsr_open;
+	search::unidirectional_search rsr_astar(
+	    &heuristic, &rsr_expander, &rsr_open);
+
+	std::mt19937 rng;
+	for(uint32_t round = 0; round < 5; round++)
+	{
+		for(uint32_t i = 0; i < 60; i++)
+		{
+			search::problem_instance pi = test::random_query(map, rng);
+			search::search_parameters par;
+			search::solution expected, sol;
+			astar.get_pathcost(&pi, &expected);
+			rsr_astar.get_path(&pi, &par, &sol);
+			CHECK(
+			    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+			    < 1e-6);
+			if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+			{
+				continue;
+			}
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+		}
+
+		// block and free cells through the decomposition
+		for(uint32_t i = 0; i < 15; i++)
+		{
+			uint32_t x = rng() % 40, y = rng() % 40;
+			rects.set_label(
+			    x, y, !map.get_label(map.to_padded_id_from_unpadded(x, y)));
+		}
+		REQUIRE(valid(rects, map));
+	}
+}
+
+TEST_CASE("rsr decompositions are saved and loaded", "[search][rsr]")
+{
+	using namespace warthog;
+	domain::gridmap map(40, 40);
+	test::random_map(map, 12);
+	std::string file
+	    = (std::filesystem::temp_directory_path() / "warthog_test.rsr")
+	          .string();
+	rsr::rect_decomposition rects(&map);
+	rects.build();
+	REQUIRE(rects.save(file.c_str()) > 0);
+
+	rsr::rect_decomposition loaded(&map);
+	REQUIRE(loaded.load(file.c_str()));
+	CHECK(loaded.get_num_rects() == rects.get_num_rects());
+	CHECK(valid(loaded, map));
+
+	SECTION("a decomposition of another map is rejected")
+	{
+		// one cell changed
+		rects.set_label(
+		    3, 3, !map.get_label(map.to_padded_id_from_unpadded(3, 3)));
+		rsr::rect_decomposition rejected(&map);
+		CHECK_FALSE(rejected.load(file.c_str()));
+
+		domain::gridmap larger(40, 48);
+		test::random_map(larger, 12);
+		rsr::rect_decomposition other(&larger);
+		CHECK_FALSE(other.load(file.c_str()));
+	}
+
+	SECTION("a truncated decomposition is rejected")
+	{
+		std::string truncated = file + ".part";
+		std::filesystem::copy_file(
+		    file, truncated,
+		    std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::resize_file(
+		    truncated, std::filesystem::file_size(file) - 4);
+		rsr::rect_decomposition rejected(&map);
+		CHECK_FALSE(rejected.load(truncated.c_str()));
+		CHECK_FALSE(rejected.load("no such file"));
+		std::filesystem::remove(truncated);
+	}
+
+	std::filesystem::remove(file);
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/search_tree_cache.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST_CASE("search tree cache matches a*", "[search][cache]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 5);
+	test::reference_astar astar(&map);
+
+	for(bool use_astar : {true, false})
+	{
+		search::search_tree_cache cache(&map, 4, use_astar);
+		std::mt19937 rng;
+		// few targets and many starts, so that trees are reused
+		std::vector<pack_id> targets;
+		for(uint32_t i = 0; i < 3; i++)
+		{
+			targets.push_back(test::random_cell(map, rng));
+		}
+		for(uint32_t round = 0; round < 3; round++)
+		{
+			for(uint32_t i = 0; i < 40; i++)
+			{
+				search::problem_instance pi(
+				    test::random_cell(map, rng),
+				    targets[rng() % targets.size()]);
+				if(i % 2) { std::swap(pi.start_, pi.target_); }
+				search::search_parameters par;
+				search::solution expected, sol;
+				astar.get_pathcost(&pi, &expected);
+				cache.get_path(&pi, &par, &sol);
+				CHECK(
+				    std::abs(sol.sum_of_edge_costs_
+				             - expected.sum_of_edge_costs_)
+				    < 1e-6);
+				if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+				{
+					continue;
+				}
+				REQUIRE(!sol.path_.empty());
+				CHECK(sol.path_.front() == pi.start_);
+				CHECK(sol.path_.back() == pi.target_);
+			}
+			// the trees are stale once the map changes
+			pad_id cell = map.to_padded_id_from_unpadded(
+			    rng() % 48, rng() % 48);
+			map.set_label(cell, !map.get_label(cell));
+		}
+		CHECK(cache.get_num_hits() + cache.get_num_resumes() > 0);
+		CHECK(cache.get_num_trees() <= cache.get_capacity());
+		test::random_map(map, 5);
+	}
+}
+
+TEST_CASE(
+    "search tree cache drops trees when the map changes", "[search][cache]")
+{
+	using namespace warthog;
+	// an open map; walls are added later
+	domain::gridmap map(16, 16);
+	test::open_map(map);
+	search::search_tree_cache cache(&map);
+	search::gridmap_expansion_policy* expander = cache.get_expander();
+
+	search::problem_instance pi(
+	    expander->get_pack(0, 8), expander->get_pack(15, 8));
+	search::search_parameters par;
+	search::solution sol;
+	cache.get_pathcost(&pi, &par, &sol);
+	CHECK(sol.sum_of_edge_costs_ == 15);
+	cache.get_pathcost(&pi, &par, &sol);
+	CHECK(cache.get_num_hits() == 1);
+
+	// a wall across the map, with a gap at the bottom
+	for(uint32_t y = 0; y < 15; y++)
+	{
+		map.set_label(8, y, false);
+	}
+	sol.reset();
+	cache.get_pathcost(&pi, &par, &sol);
+	CHECK(cache.get_num_misses() == 2);
+	CHECK(cache.get_num_trees() == 1);
+	CHECK(sol.sum_of_edge_costs_ > 15);
+
+	// no stale cost is left in a reused solution
+	map.set_label(8, 15, false);
+	cache.get_pathcost(&pi, &par, &sol);
+	CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+	map.set_label(15, 8, false);
+	cache.get_pathcost(&pi, &par, &sol);
+	CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+}
+
+TEST_CASE(
+    "search tree cache evicts the least recently used tree",
+    "[search][cache]")
+{
+	using namespace warthog;
+	domain::gridmap map(32, 32);
+	test::random_map(map, 5);
+	test::reference_astar astar(&map);
+	search::search_tree_cache cache(&map, 2);
+	cache.set_direction(search::tree_direction::forward);
+
+	// open cells, as the roots of forward trees
+	std::mt19937 rng;
+	std::vector<pack_id> roots;
+	while(roots.size() < 5)
+	{
+		pack_id id = test::random_cell(map, rng);
+		if(map.get_label(map.to_padded_id(id))) { roots.push_back(id); }
+	}
+	auto query = [&](pack_id root) {
+		search::problem_instance pi(root, roots[4]);
+		search::search_parameters par;
+		search::solution sol;
+		cache.get_path(&pi, &par, &sol);
+		CHECK(std::abs(sol.sum_of_edge_costs_ - astar.cost(pi)) < 1e-6);
+	};
+
+	query(roots[0]);
+	query(roots[1]);
+	query(roots[0]);
+	CHECK(cache.get_num_misses() == 2);
+	// roots[1] is the least recently used, and makes room for roots[2]
+	query(roots[2]);
+	query(roots[0]);
+	CHECK(cache.get_num_misses() == 3);
+	query(roots[1]);
+	CHECK(cache.get_num_misses() == 4);
+	CHECK(cache.get_num_trees() == 2);
+
+	// the trees of roots[0] and roots[1] are cached; after them, every
+	// query evicts the tree the next one needs, and builds a new tree in
+	// its memory
+	for(uint32_t i = 0; i < 40; i++)
+	{
+		query(roots[i % 4]);
+	}
+	CHECK(cache.get_num_misses() == 4 + 38);
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/subgoal/subgoal_graph.h>
+#include <warthog/subgoal/subgoal_graph_builder.h>
+#include <warthog/subgoal/subgoal_search.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+
+TEST_CASE("subgoal graphs match a*", "[search][subgoal]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 5);
+	test::reference_astar astar(&map);
+	std::string file
+	    = (std::filesystem::temp_directory_path() / "warthog_test.ssg")
+	          .string();
+
+	for(bool two_level : {false, true})
+	{
+		subgoal::subgoal_graph_builder builder(&map);
+		builder.build(two_level);
+		REQUIRE(builder.save(file.c_str()) > 0);
+		subgoal::subgoal_graph graph;
+		REQUIRE(graph.load(file.c_str(), map));
+		CHECK(graph.get_num_nodes() == builder.get_num_nodes());
+		subgoal::subgoal_search engine(&map, &graph);
+
+		std::mt19937 rng;
+		for(uint32_t i = 0; i < 200; i++)
+		{
+			search::problem_instance pi = test::random_query(map, rng);
+			search::search_parameters par;
+			search::solution expected, sol;
+			astar.get_pathcost(&pi, &expected);
+			engine.get_path(&pi, &par, &sol);
+			CHECK(
+			    std::abs(sol.sum_of_edge_costs_
+			             - expected.sum_of_edge_costs_)
+			    < 1e-6);
+			if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+			{
+				continue;
+			}
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+			CHECK(
+			    std::abs(
+			        test::path_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+			    < 1e-6);
+		}
+
+		// a graph for another map is rejected
+		domain::gridmap other(48, 48);
+		test::random_map(other, 5, 1);
+		subgoal::subgoal_graph rejected;
+		CHECK_FALSE(rejected.load(file.c_str(), other));
+		CHECK_FALSE(rejected.is_loaded());
+
+		// one cell changed
+		domain::gridmap changed(48, 48);
+		test::random_map(changed, 5);
+		pad_id cell = changed.to_padded_id_from_unpadded(3, 3);
+		changed.set_label(cell, !changed.get_label(cell));
+		CHECK_FALSE(rejected.load(file.c_str(), changed));
+
+		domain::gridmap larger(48, 56);
+		test::random_map(larger, 5);
+		CHECK_FALSE(rejected.load(file.c_str(), larger));
+
+		// a truncated graph
+		std::string truncated = file + ".part";
+		std::filesystem::copy_file(
+		    file, truncated,
+		    std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::resize_file(
+		    truncated, std::filesystem::file_size(file) - 4);
+		CHECK_FALSE(rejected.load(truncated.c_str(), map));
+		CHECK_FALSE(rejected.load("no such file", map));
+		std::filesystem::remove(truncated);
+	}
+	std::filesystem::remove(file);
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/subpath_cache.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using astar_t = warthog::search::unidirectional_search<
+    warthog::heuristic::octile_heuristic,
+    warthog::search::gridmap_expansion_policy>;
+
+} // namespace
+
+TEST_CASE("sub-path cache matches a*", "[search][cache]")
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 5);
+	search::gridmap_expansion_policy expander(&map);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	util::pqueue_min open;
+	astar_t astar(&heuristic, &expander, &open);
+	test::reference_astar ref(&map);
+	search::subpath_cache<astar_t> cache(&astar);
+
+	std::mt19937 rng;
+	std::vector<pack_id> last;
+	search::solution sol;
+	uint64_t along_queries = 0;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		bool along = i % 2 && last.size() > 2;
+		// alternately a random query, and one along the last path
+		search::problem_instance pi = test::random_query(map, rng);
+		if(along)
+		{
+			along_queries++;
+			size_t a   = rng() % last.size(), b = rng() % last.size();
+			pi.start_  = last[std::min(a, b)];
+			pi.target_ = last[std::max(a, b)];
+		}
+
+		search::search_parameters par;
+		search::solution expected;
+		ref.get_pathcost(&pi, &expected);
+		uint64_t hits = cache.get_num_hits();
+		// a query along the last path reuses the solution of that path,
+		// without reset; the hit must not leave its metrics behind
+		if(!along) { sol.reset(); }
+		cache.get_path(&pi, &par, &sol);
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		if(along)
+		{
+			REQUIRE(cache.get_num_hits() == hits + 1);
+			CHECK(sol.met_.nodes_expanded_ == 0);
+			CHECK(sol.met_.nodes_generated_ == 0);
+			CHECK(sol.met_.lb_ == sol.sum_of_edge_costs_);
+			CHECK(sol.met_.ub_ == sol.sum_of_edge_costs_);
+		}
+		if(expected.sum_of_edge_costs_ == warthog::COST_MAX) { continue; }
+		REQUIRE(!sol.path_.empty());
+		CHECK(sol.path_.front() == pi.start_);
+		CHECK(sol.path_.back() == pi.target_);
+		// the path of a miss is cached, and indexed by all its cells
+		if(cache.get_num_hits() == hits) { last = sol.path_; }
+	}
+	CHECK(along_queries >= 50);
+	CHECK(cache.get_num_hits() >= along_queries);
+}
+
+TEST_CASE("sub-path cache evicts and drops stale paths", "[search][cache]")
+{
+	using namespace warthog;
+	// an open map
+	domain::gridmap map(32, 32);
+	test::open_map(map);
+	search::gridmap_expansion_policy expander(&map);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	util::pqueue_min open;
+	astar_t astar(&heuristic, &expander, &open);
+	// room for two paths of 20 cells
+	search::subpath_cache<astar_t> cache(&astar, 40);
+
+	// three straight paths of 20 cells across the map
+	search::search_parameters par;
+	search::solution sol;
+	auto row = [&](uint32_t y, uint32_t from, uint32_t to) {
+		search::problem_instance pi(
+		    expander.get_pack(from, y), expander.get_pack(to, y));
+		sol.reset();
+		cache.get_pathcost(&pi, &par, &sol);
+	};
+	row(0, 0, 19);
+	row(10, 0, 19);
+	CHECK(cache.get_num_paths() == 2);
+	CHECK(cache.get_num_cells() == 40);
+
+	// use the first path, so that the second is the least recently used
+	row(0, 5, 15);
+	CHECK(cache.get_num_hits() == 1);
+	CHECK(sol.sum_of_edge_costs_ == 10);
+	row(20, 0, 19);
+	CHECK(cache.get_num_paths() == 2);
+	CHECK(cache.get_num_cells() == 40);
+
+	row(0, 1, 2);
+	CHECK(cache.get_num_hits() == 2);
+	row(10, 1, 2);
+	CHECK(cache.get_num_hits() == 2);
+
+	// a wall through the cached paths makes them stale
+	for(uint32_t y = 0; y < 31; y++)
+	{
+		map.set_label(10, y, false);
+	}
+	row(20, 0, 19);
+	CHECK(cache.get_num_hits() == 2);
+	CHECK(cache.get_num_paths() == 1);
+	CHECK(sol.sum_of_edge_costs_ > 19);
+}
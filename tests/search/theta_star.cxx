@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/euclidean_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/theta_star.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// the Euclidean length of the segments between consecutive waypoints of
+// @param path, or -1 if a waypoint cannot see the next one
+double
+any_angle_cost(
+    const warthog::domain::gridmap& map,
+    const std::vector<warthog::pack_id>& path)
+{
+	int32_t w   = map.header_width();
+	double cost = 0;
+	for(size_t i = 1; i < path.size(); i++)
+	{
+		if(!map.line_of_sight(path[i - 1], path[i])) { return -1; }
+		double dx = int32_t(path[i].id % w) - int32_t(path[i - 1].id % w);
+		double dy = int32_t(path[i].id / w) - int32_t(path[i - 1].id / w);
+		cost += std::sqrt(dx * dx + dy * dy);
+	}
+	return cost;
+}
+
+// queries on a random map, for the engine T of theta_star or
+// lazy_theta_star
+template<class T>
+void
+check_any_angle_paths()
+{
+	using namespace warthog;
+	domain::gridmap map(48, 48);
+	test::random_map(map, 5);
+	test::reference_astar astar(&map);
+	search::gridmap_expansion_policy expander(&map);
+	heuristic::euclidean_heuristic heuristic(map.width(), map.height());
+	util::pqueue_min open;
+	T theta(&heuristic, &expander, &open);
+
+	std::mt19937 rng;
+	uint32_t shorter = 0;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution sol;
+		cost_t octile = astar.cost(pi);
+		theta.get_path(&pi, &par, &sol);
+		if(octile == warthog::COST_MAX)
+		{
+			CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+			CHECK(sol.path_.empty());
+			continue;
+		}
+		REQUIRE(!sol.path_.empty());
+		CHECK(sol.path_.front() == pi.start_);
+		CHECK(sol.path_.back() == pi.target_);
+		CHECK(
+		    std::abs(any_angle_cost(map, sol.path_) - sol.sum_of_edge_costs_)
+		    < 1e-6);
+		CHECK(sol.sum_of_edge_costs_ < octile + 1e-6);
+		if(sol.sum_of_edge_costs_ < octile - 1e-6) { shorter++; }
+	}
+	CHECK(shorter > 50);
+	CHECK(theta.get_los_checks() > 0);
+}
+
+} // namespace
+
+TEST_CASE(
+    "theta* paths are any-angle and no longer than a*", "[search][theta]")
+{
+	check_any_angle_paths<
+	    warthog::search::theta_star<
+	        warthog::heuristic::euclidean_heuristic,
+	        warthog::search::gridmap_expansion_policy>>();
+}
+
+TEST_CASE(
+    "lazy theta* paths are any-angle and no longer than a*",
+    "[search][theta]")
+{
+	check_any_angle_paths<
+	    warthog::search::lazy_theta_star<
+	        warthog::heuristic::euclidean_heuristic,
+	        warthog::search::gridmap_expansion_policy>>();
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+namespace
+{
+
+// a 32x32 map with a wall across the middle, open at one end
+void
+setup_map(warthog::domain::gridmap& map)
+{
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, !(y == 16 && x < 28));
+		}
+}
+
+} // namespace
+
+TEST_CASE("time-sliced search matches uninterrupted search", "[search][uds]")
+{
+	using namespace warthog;
+	domain::gridmap map(32, 32);
+	setup_map(map);
+	search::gridmap_expansion_policy expander(&map);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	util::pqueue_min open;
+	search::unidirectional_search astar(&heuristic, &expander, &open);
+
+	search::problem_instance pi(
+	    expander.get_pack(2, 2), expander.get_pack(3, 30));
+
+	search::search_parameters par;
+	search::solution expected;
+	astar.get_path(&pi, &par, &expected);
+	REQUIRE(expected.sum_of_edge_costs_ != warthog::COST_MAX);
+
+	search::search_problem_instance spi = expander.get_problem_instance(&pi);
+	search::solution sol;
+	astar.begin(&spi, &par, &sol);
+	REQUIRE(astar.get_status() == search::search_status::suspended);
+
+	uint32_t slices = 0;
+	while(astar.resume(10) == search::search_status::suspended)
+	{
+		slices++;
+		// each slice expands at most 10 nodes
+		CHECK(sol.met_.nodes_expanded_ == slices * 10);
+	}
+	CHECK(slices > 1);
+	CHECK(astar.get_status() == search::search_status::finished);
+	CHECK(sol.sum_of_edge_costs_ == expected.sum_of_edge_costs_);
+	CHECK(sol.met_.nodes_expanded_ == expected.met_.nodes_expanded_);
+	CHECK(sol.path_ == expected.path_);
+
+	astar.cancel();
+	CHECK(astar.get_status() == search::search_status::idle);
+}
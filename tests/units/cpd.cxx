@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/cpd/cpd.h>
+#include <warthog/cpd/cpd_builder.h>
+#include <warthog/cpd/cpd_search.h>
+#include <warthog/domain/gridmap.h>
+
+#include <cmath>
+#include <filesystem>
+#include <random>
+
+TEST_CASE("compressed path database matches a*", "[cpd]")
+{
+	using namespace warthog;
+	domain::gridmap map(24, 24);
+	test::random_map(map, 5);
+	std::string file
+	    = (std::filesystem::temp_directory_path() / "warthog_test.cpd")
+	          .string();
+
+	cpd::cpd_builder builder(&map);
+	builder.build();
+	REQUIRE(builder.save(file.c_str()) > 0);
+
+	cpd::cpd db;
+	REQUIRE(db.load(file.c_str(), map));
+	CHECK(db.get_header().num_nodes_ == builder.get_num_nodes());
+	cpd::cpd_search engine(&map, &db);
+
+	test::reference_astar astar(&map);
+
+	std::mt19937 rng;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution expected, sol;
+		astar.get_pathcost(&pi, &expected);
+		engine.get_path(&pi, &par, &sol);
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		if(expected.sum_of_edge_costs_ == warthog::COST_MAX) { continue; }
+		REQUIRE(!sol.path_.empty());
+		CHECK(sol.path_.front() == pi.start_);
+		CHECK(sol.path_.back() == pi.target_);
+	}
+
+	SECTION("a database for another map is rejected")
+	{
+		domain::gridmap other(24, 24);
+		test::random_map(other, 5, 1);
+		cpd::cpd rejected;
+		CHECK_FALSE(rejected.load(file.c_str(), other));
+		CHECK_FALSE(rejected.is_loaded());
+
+		// one cell changed
+		domain::gridmap changed(24, 24);
+		test::random_map(changed, 5);
+		pad_id cell = changed.to_padded_id_from_unpadded(3, 3);
+		changed.set_label(cell, !changed.get_label(cell));
+		CHECK_FALSE(rejected.load(file.c_str(), changed));
+
+		domain::gridmap larger(24, 30);
+		test::random_map(larger, 5);
+		CHECK_FALSE(rejected.load(file.c_str(), larger));
+	}
+
+	SECTION("a truncated database is rejected")
+	{
+		std::string truncated = file + ".part";
+		std::filesystem::copy_file(
+		    file, truncated,
+		    std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::resize_file(
+		    truncated, std::filesystem::file_size(file) - 4);
+		cpd::cpd rejected;
+		CHECK_FALSE(rejected.load(truncated.c_str(), map));
+		CHECK_FALSE(rejected.load("no such file", map));
+		std::filesystem::remove(truncated);
+	}
+
+	std::filesystem::remove(file);
+}
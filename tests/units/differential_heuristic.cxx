@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/differential_heuristic.h>
+#include <warthog/heuristic/differential_heuristic_builder.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <filesystem>
+#include <random>
+
+TEST_CASE("differential heuristic is admissible", "[heuristic][dh]")
+{
+	using namespace warthog;
+	domain::gridmap map(40, 40);
+	test::random_map(map, 5);
+	std::string file
+	    = (std::filesystem::temp_directory_path() / "warthog_test.dh")
+	          .string();
+
+	heuristic::differential_heuristic_builder builder(&map);
+	builder.build(6);
+	size_t bytes = builder.save(file.c_str());
+	REQUIRE(bytes > 0);
+	// the builder holds little besides the table it writes
+	CHECK(builder.mem() < 2 * bytes);
+
+	heuristic::differential_heuristic dh(map.width(), map.height());
+	REQUIRE(dh.load(file.c_str(), map));
+	CHECK(dh.get_num_pivots() == 6);
+
+	search::gridmap_expansion_policy expander(&map);
+	heuristic::octile_heuristic octile(map.width(), map.height());
+	util::pqueue_min open;
+	search::unidirectional_search astar(&octile, &expander, &open);
+	search::gridmap_expansion_policy dh_expander(&map);
+	util::pqueue_min dh_open;
+	// reopening, as the bounds of the pivots need not be consistent
+	search::unidirectional_search<
+	    heuristic::differential_heuristic, search::gridmap_expansion_policy,
+	    util::pqueue_min, search::dummy_listener,
+	    search::admissibility_criteria::any,
+	    search::feasibility_criteria::until_exhaustion,
+	    search::reopen_policy::yes>
+	    dh_astar(&dh, &dh_expander, &dh_open);
+
+	std::mt19937 rng;
+	uint32_t better = 0;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution expected, sol;
+		astar.get_pathcost(&pi, &par, &expected);
+		dh_astar.get_pathcost(&pi, &par, &sol);
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		if(expected.sum_of_edge_costs_ == warthog::COST_MAX) { continue; }
+
+		sn_id_t from = map.to_padded_id(pi.start_).id;
+		sn_id_t to   = map.to_padded_id(pi.target_).id;
+		CHECK(dh.h(from, to) <= expected.sum_of_edge_costs_ + 1e-6);
+		CHECK(dh.h(from, to) >= octile.h(from, to));
+		if(dh.h(from, to) > octile.h(from, to)) { better++; }
+	}
+	CHECK(better > 0);
+
+	SECTION("a table for another map is rejected")
+	{
+		heuristic::differential_heuristic rejected(map.width(), map.height());
+		domain::gridmap other(40, 40);
+		test::random_map(other, 5, 1);
+		CHECK_FALSE(rejected.load(file.c_str(), other));
+		CHECK_FALSE(rejected.is_loaded());
+		CHECK(rejected.h(100, 200) == octile.h(100, 200));
+
+		// one cell changed
+		domain::gridmap changed(40, 40);
+		test::random_map(changed, 5);
+		pad_id cell = changed.to_padded_id_from_unpadded(3, 3);
+		changed.set_label(cell, !changed.get_label(cell));
+		CHECK_FALSE(rejected.load(file.c_str(), changed));
+
+		domain::gridmap larger(40, 48);
+		test::random_map(larger, 5);
+		CHECK_FALSE(rejected.load(file.c_str(), larger));
+	}
+
+	SECTION("a truncated table is rejected")
+	{
+		std::string truncated = file + ".part";
+		std::filesystem::copy_file(
+		    file, truncated,
+		    std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::resize_file(
+		    truncated, std::filesystem::file_size(file) - 2);
+		heuristic::differential_heuristic rejected(map.width(), map.height());
+		CHECK_FALSE(rejected.load(truncated.c_str(), map));
+		CHECK_FALSE(rejected.load("no such file", map));
+		std::filesystem::remove(truncated);
+	}
+
+	std::filesystem::remove(file);
+}
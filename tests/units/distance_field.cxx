@@ -0,0 +1,123 @@
+#include <catch2/catch_test_macros.hpp>
+#include <warthog/domain/gridmap.h>
+#include <warthog/flow/distance_field.h>
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// breadth first distances over unpadded ids, one step per move
+std::vector<uint32_t>
+reference_bfs(
+    const warthog::domain::gridmap& map,
+    const std::vector<warthog::pack_id>& sources, bool diagonal)
+{
+	int32_t w = map.header_width();
+	int32_t h = map.header_height();
+	auto free = [&](int32_t x, int32_t y) {
+		return x >= 0 && x < w && y >= 0 && y < h
+		    && map.get_label(map.to_padded_id_from_unpadded(x, y));
+	};
+
+	std::vector<uint32_t> dist(w * h, UINT32_MAX);
+	std::deque<uint32_t> queue;
+	for(warthog::pack_id s : sources)
+	{
+		if(free(s.id % w, s.id / w) && dist[s.id] != 0)
+		{
+			dist[s.id] = 0;
+			queue.push_back(s.id);
+		}
+	}
+	while(!queue.empty())
+	{
+		uint32_t id = queue.front();
+		queue.pop_front();
+		int32_t x = id % w, y = id / w;
+		for(int32_t dy = -1; dy <= 1; dy++)
+			for(int32_t dx = -1; dx <= 1; dx++)
+			{
+				if((dx == 0 && dy == 0) || (dx != 0 && dy != 0 && !diagonal))
+				{
+					continue;
+				}
+				if(!free(x + dx, y + dy)) { continue; }
+				if(dx != 0 && dy != 0
+				   && (!free(x + dx, y) || !free(x, y + dy)))
+				{
+					continue;
+				}
+				uint32_t next = (y + dy) * w + (x + dx);
+				if(dist[next] == UINT32_MAX)
+				{
+					dist[next] = dist[id] + 1;
+					queue.push_back(next);
+				}
+			}
+	}
+	return dist;
+}
+
+} // namespace
+
+TEST_CASE("distance field matches breadth first search", "[unit][flow]")
+{
+	using namespace warthog;
+	// wider than one word, so moves cross words
+	domain::gridmap map(60, 150);
+	std::mt19937 rng(11);
+	std::bernoulli_distribution blocked(0.3);
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, !blocked(rng));
+		}
+
+	uint32_t w = map.header_width();
+	std::uniform_int_distribution<uint32_t> cell(
+	    0, w * map.header_height() - 1);
+	for(bool diagonal : {false, true})
+	{
+		flow::distance_field<uint32_t> field(&map, diagonal);
+		for(int i = 0; i < 10; i++)
+		{
+			std::vector<pack_id> sources;
+			for(int j = 0; j <= i % 3; j++)
+			{
+				sources.push_back(pack_id{cell(rng)});
+			}
+			field.compute(sources);
+			std::vector<uint32_t> dist = reference_bfs(map, sources, diagonal);
+
+			for(uint32_t id = 0; id < dist.size(); id++)
+			{
+				uint32_t d = field.get_distance(pack_id{id});
+				REQUIRE(d == dist[id]);
+				uint8_t dir = field.get_flow(pack_id{id});
+				if(d == field.UNREACHED) { CHECK(dir == flow::FLOW_NONE); }
+				else if(d == 0) { CHECK(dir == flow::FLOW_SOURCE); }
+				else
+				{
+					// the flow leads one step nearer
+					REQUIRE(dir < 8);
+					uint32_t x    = id % w + flow::FLOW_DX[dir];
+					uint32_t y    = id / w + flow::FLOW_DY[dir];
+					uint32_t next = y * w + x;
+					CHECK(dist[next] == d - 1);
+				}
+			}
+
+			// the cutoff leaves further cells unreached
+			field.compute(sources, 5);
+			for(uint32_t id = 0; id < dist.size(); id++)
+			{
+				uint32_t d = dist[id] <= 5 ? dist[id] : field.UNREACHED;
+				REQUIRE(field.get_distance(pack_id{id}) == d);
+			}
+		}
+	}
+}
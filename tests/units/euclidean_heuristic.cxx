@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/euclidean_heuristic.h>
+#include <warthog/heuristic/heuristic_value.h>
+
+#include <cmath>
+#include <random>
+
+TEST_CASE("euclidean heuristic is the straight-line distance", "[heuristic]")
+{
+	using namespace warthog;
+	heuristic::euclidean_heuristic h(40, 30);
+	CHECK(h.h(3, 4, 3, 4) == 0);
+	CHECK(std::abs(h.h(0, 0, 3, 4) - 5) < 1e-9);
+	CHECK(std::abs(h.h(3, 4, 0, 0) - 5) < 1e-9);
+	CHECK(std::abs(h.h(2, 7, 3, 8) - std::sqrt(2.0)) < 1e-9);
+
+	// ids are row-major over the width given to the constructor
+	CHECK(std::abs(h.h(0 * 40 + 0, 4 * 40 + 3) - 5) < 1e-9);
+	heuristic::heuristic_value hv(pad_id(7 * 40 + 2), pad_id(1 * 40 + 10));
+	h.h(&hv);
+	CHECK(std::abs(hv.lb_ - 10) < 1e-9);
+
+	h.set_hscale(2.5);
+	CHECK(h.get_hscale() == 2.5);
+	CHECK(std::abs(h.h(0, 0, 3, 4) - 12.5) < 1e-9);
+	CHECK(h.mem() == sizeof(h));
+}
+
+TEST_CASE(
+    "euclidean heuristic is admissible and consistent on grids",
+    "[heuristic]")
+{
+	using namespace warthog;
+	domain::gridmap map(40, 40);
+	test::random_map(map, 5);
+	test::reference_astar astar(&map);
+	heuristic::euclidean_heuristic h(map.width(), map.height());
+
+	std::mt19937 rng;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		CHECK(h.h(pi.start_.id, pi.start_.id) == 0);
+
+		pad_id s  = map.to_padded_id(pi.start_);
+		pad_id t  = map.to_padded_id(pi.target_);
+		cost_t lb = h.h(s.id, t.id);
+		CHECK(lb < astar.cost(pi) + 1e-9);
+
+		// h changes by no more than the length of a move
+		for(uint32_t step : {1u, map.width(), map.width() + 1})
+		{
+			pad_id n(s.id + step);
+			double move = step == map.width() + 1 ? std::sqrt(2.0) : 1;
+			CHECK(std::abs(h.h(n.id, t.id) - lb) < move + 1e-9);
+		}
+	}
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/flow/flow_field_service.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+TEST_CASE("flow fields lead along shortest paths", "[flow]")
+{
+	using namespace warthog;
+	domain::gridmap map(40, 56);
+	test::random_map(map, 5);
+	test::reference_astar astar(&map);
+	search::gridmap_expansion_policy flow_expander(&map);
+	flow::flow_field_service service(&flow_expander, 4);
+
+	// few targets and many agents, as the service is meant for
+	std::mt19937 rng;
+	pack_id targets[3];
+	for(pack_id& t : targets)
+	{
+		t = test::random_cell(map, rng);
+	}
+	for(uint32_t round = 0; round < 3; round++)
+	{
+		for(uint32_t i = 0; i < 60; i++)
+		{
+			search::problem_instance pi(
+			    test::random_cell(map, rng), targets[i % 3]);
+			search::search_parameters par;
+			search::solution expected, sol;
+			astar.get_pathcost(&pi, &expected);
+			uint64_t misses = service.get_num_misses();
+			service.get_path(&pi, &par, &sol);
+			CHECK(
+			    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+			    < 1e-6);
+			if(service.get_num_misses() == misses)
+			{
+				CHECK(sol.met_.nodes_expanded_ == 0);
+			}
+			if(expected.sum_of_edge_costs_ == warthog::COST_MAX)
+			{
+				CHECK(service.next(pi.target_, pi.start_) == pack_id::max());
+				continue;
+			}
+
+			// step by step, one move at a time
+			REQUIRE(!sol.path_.empty());
+			CHECK(sol.path_.front() == pi.start_);
+			CHECK(sol.path_.back() == pi.target_);
+			pack_id at  = pi.start_;
+			double cost = 0;
+			for(size_t j = 1; j < sol.path_.size(); j++)
+			{
+				pack_id next = service.next(pi.target_, at);
+				REQUIRE(next == sol.path_[j]);
+				int32_t w  = map.header_width();
+				int32_t dx = int32_t(next.id % w) - int32_t(at.id % w);
+				int32_t dy = int32_t(next.id / w) - int32_t(at.id / w);
+				REQUIRE((std::abs(dx) <= 1 && std::abs(dy) <= 1));
+				cost += dx != 0 && dy != 0 ? warthog::DBL_ROOT_TWO : 1;
+				at = next;
+			}
+			CHECK(service.next(pi.target_, at) == at);
+			CHECK(std::abs(cost - expected.sum_of_edge_costs_) < 1e-6);
+		}
+		// one field per target, each computed once per version of the map
+		CHECK(service.get_num_fields() == 3);
+		CHECK(service.get_num_misses() == 3 * (round + 1));
+
+		// any change to the map drops the fields
+		uint32_t x = rng() % 56, y = rng() % 40;
+		map.set_label(
+		    x, y, !map.get_label(map.to_padded_id_from_unpadded(x, y)));
+	}
+}
+
+TEST_CASE("flow fields are evicted by last use", "[flow]")
+{
+	using namespace warthog;
+	domain::gridmap map(16, 16);
+	test::random_map(map, 5);
+	search::gridmap_expansion_policy expander(&map);
+	flow::flow_field_service service(&expander, 2);
+
+	pack_id a = expander.get_pack(1, 1), b = expander.get_pack(8, 8),
+	        c = expander.get_pack(14, 3);
+	service.get_field(a);
+	service.get_field(b);
+	service.get_field(a);
+	CHECK(service.get_num_hits() == 1);
+	// b is the least recently used
+	service.get_field(c);
+	CHECK(service.get_num_fields() == 2);
+	service.get_field(a);
+	CHECK(service.get_num_hits() == 2);
+	service.get_field(b);
+	CHECK(service.get_num_misses() == 4);
+
+	service.clear();
+	CHECK(service.get_num_fields() == 0);
+
+	// the order of use starts again after a clear
+	service.get_field(c);
+	service.get_field(a);
+	service.get_field(b);
+	CHECK(service.get_num_misses() == 7);
+	service.get_field(a);
+	CHECK(service.get_num_hits() == 3);
+	service.get_field(c);
+	CHECK(service.get_num_misses() == 8);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/gridmap.h>
+#include <warthog/goal_bounding/gb_builder.h>
+#include <warthog/goal_bounding/gb_expansion_policy.h>
+#include <warthog/goal_bounding/gb_table.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <filesystem>
+#include <random>
+
+TEST_CASE("goal bounding matches a*", "[goal_bounding]")
+{
+	using namespace warthog;
+	domain::gridmap map(32, 32);
+	test::random_map(map, 5);
+	std::string file
+	    = (std::filesystem::temp_directory_path() / "warthog_test.gb")
+	          .string();
+
+	goal_bounding::gb_builder builder(&map);
+	builder.build();
+	REQUIRE(builder.save(file.c_str()) > 0);
+
+	goal_bounding::gb_table table;
+	REQUIRE(table.load(file.c_str(), map));
+	CHECK(table.get_num_nodes() == builder.get_num_nodes());
+
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	search::gridmap_expansion_policy expander(&map);
+	util::pqueue_min open;
+	search::unidirectional_search astar(&heuristic, &expander, &open);
+	goal_bounding::gb_expansion_policy gb_expander(&map, &table);
+	util::pqueue_min gb_open;
+	search::unidirectional_search gb_astar(&heuristic, &gb_expander, &gb_open);
+
+	std::mt19937 rng;
+	uint64_t expanded = 0, gb_expanded = 0;
+	for(uint32_t i = 0; i < 200; i++)
+	{
+		search::problem_instance pi = test::random_query(map, rng);
+		search::search_parameters par;
+		search::solution expected, sol;
+		astar.get_pathcost(&pi, &par, &expected);
+		gb_astar.get_path(&pi, &par, &sol);
+		CHECK(
+		    std::abs(sol.sum_of_edge_costs_ - expected.sum_of_edge_costs_)
+		    < 1e-6);
+		if(expected.sum_of_edge_costs_ == warthog::COST_MAX) { continue; }
+		REQUIRE(!sol.path_.empty());
+		CHECK(sol.path_.front() == pi.start_);
+		CHECK(sol.path_.back() == pi.target_);
+		CHECK(sol.met_.nodes_expanded_ <= expected.met_.nodes_expanded_);
+		expanded += expected.met_.nodes_expanded_;
+		gb_expanded += sol.met_.nodes_expanded_;
+	}
+	CHECK(gb_expanded < expanded);
+
+	SECTION("a table for another map is rejected")
+	{
+		domain::gridmap other(32, 32);
+		test::random_map(other, 5, 1);
+		goal_bounding::gb_table rejected;
+		CHECK_FALSE(rejected.load(file.c_str(), other));
+		CHECK_FALSE(rejected.is_loaded());
+
+		// one cell changed
+		domain::gridmap changed(32, 32);
+		test::random_map(changed, 5);
+		pad_id cell = changed.to_padded_id_from_unpadded(3, 3);
+		changed.set_label(cell, !changed.get_label(cell));
+		CHECK_FALSE(rejected.load(file.c_str(), changed));
+
+		domain::gridmap larger(32, 40);
+		test::random_map(larger, 5);
+		CHECK_FALSE(rejected.load(file.c_str(), larger));
+	}
+
+	SECTION("a truncated table is rejected")
+	{
+		std::string truncated = file + ".part";
+		std::filesystem::copy_file(
+		    file, truncated,
+		    std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::resize_file(
+		    truncated, std::filesystem::file_size(file) - 8);
+		goal_bounding::gb_table rejected;
+		CHECK_FALSE(rejected.load(truncated.c_str(), map));
+		CHECK_FALSE(rejected.load("no such file", map));
+		std::filesystem::remove(truncated);
+	}
+
+	std::filesystem::remove(file);
+}
@@ -0,0 +1,176 @@
+#include <catch2/catch_test_macros.hpp>
+#include "random_map.h"
+#include <warthog/domain/grid_components.h>
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+// do @param a and @param b put every cell in the same component, up to
+// the names of the components?
+bool
+same_partition(
+    const warthog::domain::grid_components& a,
+    const warthog::domain::grid_components& b, uint32_t num_cells)
+{
+	std::unordered_map<uint32_t, uint32_t> a_to_b, b_to_a;
+	for(uint32_t i = 0; i < num_cells; i++)
+	{
+		uint32_t ca = a.get_component(warthog::pack_id{i});
+		uint32_t cb = b.get_component(warthog::pack_id{i});
+		if((ca == warthog::domain::grid_components::NONE)
+		   != (cb == warthog::domain::grid_components::NONE))
+		{
+			return false;
+		}
+		if(ca == warthog::domain::grid_components::NONE) { continue; }
+		auto ia = a_to_b.try_emplace(ca, cb).first;
+		auto ib = b_to_a.try_emplace(cb, ca).first;
+		if(ia->second != cb || ib->second != ca) { return false; }
+	}
+	return a_to_b.size() == a.get_num_components()
+	    && b_to_a.size() == b.get_num_components();
+}
+
+} // namespace
+
+TEST_CASE("grid components match a flood fill", "[grid_components]")
+{
+	using namespace warthog;
+	// two words per row
+	domain::gridmap map(30, 100);
+	test::random_map(map, 3);
+	domain::grid_components components(map);
+
+	// label the cells by flood fill over cardinal moves
+	uint32_t w = map.header_width(), h = map.header_height();
+	std::vector<uint32_t> fill(w * h, domain::grid_components::NONE);
+	uint32_t num_filled = 0;
+	for(uint32_t i = 0; i < w * h; i++)
+	{
+		if(fill[i] != domain::grid_components::NONE
+		   || !map.get_label(map.to_padded_id(pack_id{i})))
+		{
+			continue;
+		}
+		std::vector<uint32_t> stack = {i};
+		fill[i]                     = num_filled;
+		while(!stack.empty())
+		{
+			uint32_t c = stack.back();
+			stack.pop_back();
+			uint32_t x = c % w, y = c / w;
+			uint32_t next[4][2]
+			    = {{x - 1, y}, {x + 1, y}, {x, y - 1}, {x, y + 1}};
+			for(auto [nx, ny] : next)
+			{
+				uint32_t n = ny * w + nx;
+				if(nx < w && ny < h && fill[n] == domain::grid_components::NONE
+				   && map.get_label(map.to_padded_id_from_unpadded(nx, ny)))
+				{
+					fill[n] = num_filled;
+					stack.push_back(n);
+				}
+			}
+		}
+		num_filled++;
+	}
+	CHECK(components.get_num_components() == num_filled);
+
+	std::mt19937 rng;
+	for(uint32_t i = 0; i < 2000; i++)
+	{
+		pack_id a{rng() % (w * h)}, b{rng() % (w * h)};
+		bool expected = fill[a.id] != domain::grid_components::NONE
+		    && fill[a.id] == fill[b.id];
+		CHECK(components.connected(a, b) == expected);
+	}
+}
+
+TEST_CASE("grid components after set_label", "[grid_components]")
+{
+	using namespace warthog;
+	domain::gridmap map(30, 100);
+	test::random_map(map, 3, 1);
+	domain::grid_components components(map);
+	uint32_t w = map.header_width(), h = map.header_height();
+
+	std::mt19937 rng;
+	for(uint32_t round = 0; round < 20; round++)
+	{
+		// toggle cells on the map and in the table
+		for(uint32_t i = 0; i < 25; i++)
+		{
+			uint32_t x = rng() % w, y = rng() % h;
+			bool label = !map.get_label(map.to_padded_id_from_unpadded(x, y));
+			map.set_label(x, y, label);
+			components.set_label(x, y, label);
+		}
+		domain::grid_components rebuilt(map);
+		CHECK(components.get_num_components() == rebuilt.get_num_components());
+		CHECK(same_partition(components, rebuilt, w * h));
+	}
+
+	SECTION("unconnected queries fail without search")
+	{
+		search::gridmap_expansion_policy expander(&map);
+		heuristic::octile_heuristic heuristic(map.width(), map.height());
+		util::pqueue_min open;
+		search::unidirectional_search astar(&heuristic, &expander, &open);
+		search::gridmap_expansion_policy ref_expander(&map);
+		util::pqueue_min ref_open;
+		search::unidirectional_search ref(
+		    &heuristic, &ref_expander, &ref_open);
+		expander.set_components(&components);
+
+		for(uint32_t i = 0; i < 100; i++)
+		{
+			search::problem_instance pi = test::random_query(map, rng);
+			search::search_parameters par;
+			search::solution expected, sol;
+			ref.get_pathcost(&pi, &par, &expected);
+			astar.get_pathcost(&pi, &par, &sol);
+			CHECK(sol.sum_of_edge_costs_ == expected.sum_of_edge_costs_);
+			if(!components.connected(pi.start_, pi.target_))
+			{
+				CHECK(sol.met_.nodes_expanded_ == 0);
+			}
+		}
+	}
+}
+
+TEST_CASE("grid components of blocked and off-map cells", "[grid_components]")
+{
+	using namespace warthog;
+	domain::gridmap map(8, 8);
+	test::open_map(map);
+	map.set_label(5, 5, false);
+	domain::grid_components components(map);
+	// past the last cell, in the padding below the map
+	pack_id off_map{8 * 8 + 3};
+	CHECK(components.get_component(off_map) == domain::grid_components::NONE);
+	CHECK(!components.connected(pack_id{0}, off_map));
+
+	search::gridmap_expansion_policy expander(&map);
+	expander.set_components(&components);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	util::pqueue_min open;
+	search::unidirectional_search astar(&heuristic, &expander, &open);
+	for(pack_id target : {pack_id{5 * 8 + 5}, off_map})
+	{
+		search::problem_instance pi(pack_id{0}, target);
+		search::search_parameters par;
+		search::solution sol;
+		astar.get_pathcost(&pi, &par, &sol);
+		CHECK(sol.sum_of_edge_costs_ == warthog::COST_MAX);
+		CHECK(sol.met_.nodes_expanded_ == 0);
+	}
+}
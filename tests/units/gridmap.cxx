@@ -0,0 +1,176 @@
+#include <catch2/catch_test_macros.hpp>
+#include <warthog/domain/gridmap.h>
+#include <warthog/heuristic/octile_heuristic.h>
+#include <warthog/search/gridmap_expansion_policy.h>
+#include <warthog/search/unidirectional_search.h>
+#include <warthog/util/pqueue.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+
+struct point
+{
+	int64_t x;
+	int64_t y;
+};
+
+int64_t
+orient(point a, point b, point c)
+{
+	int64_t v = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+	return (v > 0) - (v < 0);
+}
+
+bool
+on_segment(point a, point b, point p)
+{
+	return std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x)
+	    && std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+}
+
+// do the closed segments [a, b] and [c, d] meet?
+bool
+intersects(point a, point b, point c, point d)
+{
+	int64_t o1 = orient(a, b, c);
+	int64_t o2 = orient(a, b, d);
+	int64_t o3 = orient(c, d, a);
+	int64_t o4 = orient(c, d, b);
+	if(o1 != o2 && o3 != o4) { return true; }
+	return (o1 == 0 && on_segment(a, b, c))
+	    || (o2 == 0 && on_segment(a, b, d))
+	    || (o3 == 0 && on_segment(c, d, a))
+	    || (o4 == 0 && on_segment(c, d, b));
+}
+
+// line of sight by brute force: the segment between the cell centres may
+// not meet any closed blocked cell. coordinates are in half cells.
+bool
+reference_los(
+    const warthog::domain::gridmap& map, uint32_t x0, uint32_t y0,
+    uint32_t x1, uint32_t y1)
+{
+	point a{2 * int64_t(x0) + 1, 2 * int64_t(y0) + 1};
+	point b{2 * int64_t(x1) + 1, 2 * int64_t(y1) + 1};
+	int64_t lo_x = std::min(x0, x1), hi_x = std::max(x0, x1);
+	int64_t lo_y = std::min(y0, y1), hi_y = std::max(y0, y1);
+	for(int64_t y = lo_y - 1; y <= hi_y + 1; y++)
+	{
+		for(int64_t x = lo_x - 1; x <= hi_x + 1; x++)
+		{
+			// x = -1 is the padding at the end of the previous row
+			warthog::pad_id id(uint32_t(y * map.width() + x));
+			if(map.get_label(id)) { continue; }
+			point c[4]
+			    = {{2 * x, 2 * y},
+			       {2 * x + 2, 2 * y},
+			       {2 * x + 2, 2 * y + 2},
+			       {2 * x, 2 * y + 2}};
+			for(int i = 0; i < 4; i++)
+			{
+				if(intersects(a, b, c[i], c[(i + 1) % 4])) { return false; }
+			}
+		}
+	}
+	return true;
+}
+
+} // namespace
+
+TEST_CASE("gridmap line of sight", "[unit][gridmap]")
+{
+	using namespace warthog;
+	// wider than two words, so that rows span several 64-bit reads
+	domain::gridmap map(40, 150);
+	std::mt19937 rng(7);
+	std::bernoulli_distribution blocked(0.02);
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, !blocked(rng));
+		}
+
+	std::uniform_int_distribution<uint32_t> rx(0, map.header_width() - 1);
+	std::uniform_int_distribution<uint32_t> ry(0, map.header_height() - 1);
+	uint32_t seen = 0;
+	for(int i = 0; i < 20000; i++)
+	{
+		uint32_t x0 = rx(rng), y0 = ry(rng);
+		uint32_t x1 = rx(rng), y1 = i % 4 == 0 ? y0 : ry(rng);
+		pad_id a    = map.to_padded_id_from_unpadded(x0, y0);
+		pad_id b    = map.to_padded_id_from_unpadded(x1, y1);
+		if(!map.get_label(a) || !map.get_label(b)) { continue; }
+
+		uint32_t pa = domain::gridmap::PADDED_ROWS;
+		bool los    = map.line_of_sight(a, b);
+		REQUIRE(los == reference_los(map, x0, y0 + pa, x1, y1 + pa));
+		CHECK(los == map.line_of_sight(b, a));
+		CHECK(
+		    los
+		    == map.line_of_sight(
+		        map.to_unpadded_id_from_unpadded(x0, y0),
+		        map.to_unpadded_id_from_unpadded(x1, y1)));
+		seen += los;
+	}
+	// both outcomes are exercised
+	CHECK(seen > 1000);
+	CHECK(seen < 15000);
+}
+
+TEST_CASE("gridmap path smoothing", "[unit][gridmap]")
+{
+	using namespace warthog;
+	// a wall across the middle, open at the right
+	domain::gridmap map(32, 100);
+	for(uint32_t y = 0; y < map.header_height(); ++y)
+		for(uint32_t x = 0; x < map.header_width(); ++x)
+		{
+			map.set_label(x, y, !(y == 16 && x < 90));
+		}
+	search::gridmap_expansion_policy expander(&map);
+	heuristic::octile_heuristic heuristic(map.width(), map.height());
+	util::pqueue_min open;
+	search::unidirectional_search astar(&heuristic, &expander, &open);
+
+	SECTION("open ground leaves the end points")
+	{
+		search::problem_instance pi(
+		    expander.get_pack(2, 2), expander.get_pack(80, 10));
+		search::search_parameters par;
+		search::solution sol;
+		astar.get_path(&pi, &par, &sol);
+		REQUIRE(sol.path_.size() > 2);
+
+		double length = map.smooth_path(sol.path_);
+		REQUIRE(sol.path_.size() == 2);
+		CHECK(sol.path_.front() == map.to_unpadded_id_from_unpadded(2, 2));
+		CHECK(sol.path_.back() == map.to_unpadded_id_from_unpadded(80, 10));
+		CHECK(std::abs(length - std::sqrt(78.0 * 78 + 8 * 8)) < 1e-9);
+	}
+
+	SECTION("waypoints go around the wall")
+	{
+		search::problem_instance pi(
+		    expander.get_pack(2, 2), expander.get_pack(3, 30));
+		search::search_parameters par;
+		search::solution sol;
+		astar.get_path(&pi, &par, &sol);
+		REQUIRE(sol.sum_of_edge_costs_ != warthog::COST_MAX);
+		std::vector<pack_id> grid_path = sol.path_;
+
+		double length = map.smooth_path(sol.path_);
+		CHECK(sol.path_.size() >= 3);
+		CHECK(sol.path_.size() < grid_path.size());
+		CHECK(length <= sol.sum_of_edge_costs_);
+		CHECK(sol.path_.front() == grid_path.front());
+		CHECK(sol.path_.back() == grid_path.back());
+		for(size_t i = 1; i < sol.path_.size(); i++)
+		{
+			CHECK(map.line_of_sight(sol.path_[i - 1], sol.path_[i]));
+		}
+	}
+}